@@ -0,0 +1,1372 @@
+//============================================================================
+// Name         : Multi-language dictionary benchmarks
+// Description  : Micro-benchmarks for the HashTable lookup engine
+//============================================================================
+
+#include<iostream>
+#include<iomanip>
+#include<string>
+#include<vector>
+#include<chrono>
+#include<fstream>
+#include<sstream>
+#include<thread>
+#include<cstdio>
+#include<mutex>
+#include<atomic>
+#include<algorithm>
+#include<cctype>
+#include<cmath>
+#include<cstring>
+#include "hashtable.h"
+#include "concurrent.h"
+#include "frozen.h"
+using namespace std;
+//======================================================
+
+//deterministic generator of lowercase pseudo-words
+class WordGenerator
+{
+	private:
+		unsigned long state;
+	public:
+		WordGenerator(unsigned long seed) : state(seed) {}
+		unsigned long next() {
+			//64-bit linear congruential step (Knuth's MMIX constants)
+			state = state * 6364136223846793005UL + 1442695040888963407UL;
+			return state >> 33;
+		}
+		string word() {
+			string w;
+			unsigned int length = 4 + next() % 9;
+			for (unsigned int i = 0; i < length; i++) {
+				w += (char)('a' + next() % 26);
+			}
+			return w;
+		}
+};
+
+//builds count distinct words, all different from the words in avoid
+vector<string> makeWords(unsigned int count, unsigned long seed, const vector<string>& avoid) {
+	HashTable seen(2 * (count + avoid.size()));
+	for (const string& w : avoid) seen.insert(w, "x", "x");
+	WordGenerator gen(seed);
+	vector<string> words;
+	while (words.size() < count) {
+		string w = gen.word();
+		if (!seen.contains(w)) {
+			seen.insert(w, "x", "x");
+			words.push_back(w);
+		}
+	}
+	return words;
+}
+
+//reads the words of a dictionary file: the first line names the language, then one
+//word:meanings per line
+void readWords(const string& path, vector<string>& words) {
+	ifstream file(path);
+	string line;
+	getline(file, line);
+	while (getline(file, line)) {
+		size_t colon = line.find(':');
+		if (colon != string::npos && colon > 0) words.push_back(line.substr(0, colon));
+	}
+}
+
+//returns nanoseconds elapsed since start
+double nanosSince(chrono::steady_clock::time_point start) {
+	return chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+}
+
+//======================================================
+//the scalar quadratic-probing engine the group prober replaced, kept as a baseline
+class QuadraticTable
+{
+	private:
+		struct QSlot { unsigned int hash; unsigned int entry; unsigned char ctrl; };
+		vector<QSlot> slots;
+		vector<string> words;
+		static string lower(const string& s) {
+			string r = s;
+			for (char& c : r) c = tolower(c);
+			return r;
+		}
+		static unsigned int hashOf(const string& word) {
+			unsigned long hash = 0;
+			for (char c : lower(word)) hash = hash * 31 + (unsigned long)c;
+			return (unsigned int)(hash ^ (hash >> 32));
+		}
+	public:
+		QuadraticTable(unsigned int capacity) : slots(capacity) {
+			for (QSlot& s : slots) s.ctrl = 0;
+		}
+		void insert(const string& word) {
+			unsigned int hash = hashOf(word);
+			unsigned long cap = slots.size(), home = hash % cap, index = home;
+			for (unsigned long i = 1; slots[index].ctrl != 0; i++) {
+				//quadratic probing reaches half the table, then scan linearly
+				index = i < cap ? (home + i * i) % cap : (i - cap) % cap;
+			}
+			words.push_back(word);
+			slots[index].hash = hash;
+			slots[index].entry = words.size() - 1;
+			slots[index].ctrl = 1;
+		}
+		bool contains(const string& word) {
+			unsigned int hash = hashOf(word);
+			unsigned long cap = slots.size(), home = hash % cap;
+			for (unsigned long i = 0; i < cap; i++) {
+				const QSlot& s = slots[(home + i * i) % cap];
+				if (s.ctrl == 0) return false;
+				if (s.hash == hash && lower(words[s.entry]) == lower(word)) return true;
+			}
+			return false;
+		}
+};
+
+//======================================================
+//times lookups of hit and miss keys and prints one result row
+template<class Table>
+void timeLookups(Table& table, const string& engine, float load, const vector<string>& hits, const vector<string>& misses) {
+	unsigned int found = 0;
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (const string& w : hits) found += table.contains(w);
+	double hitNs = nanosSince(start) / hits.size();
+	start = chrono::steady_clock::now();
+	for (const string& w : misses) found += table.contains(w);
+	double missNs = nanosSince(start) / misses.size();
+	//the found count guards against the lookups being optimized away
+	cout << setw(6) << load << "  " << left << setw(10) << engine << right
+		<< setprecision(1) << setw(10) << hitNs << setw(10) << missNs << setprecision(2)
+		<< (found == hits.size() ? "" : "  (lookup mismatch!)") << endl;
+}
+
+//compares the group probing kernels with scalar quadratic probing across load factors
+void benchProbe(unsigned int keys) {
+	vector<string> hits = makeWords(keys, 1, vector<string>());
+	vector<string> misses = makeWords(keys, 2, hits);
+	const float loads[] = { 0.25f, 0.5f, 0.7f, 0.8f, 0.9f };
+	const char* kernelNames[] = { "scalar", "sse2", "avx2" };
+
+	cout << keys << " keys, ns per lookup" << endl;
+	cout << fixed << setprecision(2);
+	cout << setw(6) << "load" << "  " << left << setw(10) << "engine" << right
+		<< setw(10) << "hit" << setw(10) << "miss" << endl;
+	for (float load : loads) {
+		unsigned int capacity = keys / load;
+
+		QuadraticTable quadratic(capacity);
+		for (const string& w : hits) quadratic.insert(w);
+		timeLookups(quadratic, "quadratic", load, hits, misses);
+
+		//a ceiling above the target load keeps the table from growing
+		HashTable table(capacity, 0.95);
+		for (const string& w : hits) table.insert(w, "x", "x");
+		for (int k = KERNEL_SCALAR; k <= KERNEL_AVX2; k++) {
+			table.setProbeKernel((ProbeKernel)k);
+			//kernels this CPU lacks leave the previous one selected
+			if (table.getProbeKernel() == k) {
+				timeLookups(table, kernelNames[k], load, hits, misses);
+			}
+		}
+	}
+}
+
+//======================================================
+//writes a dictionary file of lines records drawn from a shared pool of words, so files overlap
+void writeDictionary(const string& path, const string& language, unsigned int lines, const vector<string>& pool, unsigned long seed) {
+	WordGenerator gen(seed);
+	ofstream out(path);
+	out << language << '\n';
+	for (unsigned int i = 0; i < lines; i++) {
+		out << pool[gen.next() % pool.size()] << ':';
+		unsigned int meanings = 1 + gen.next() % 3;
+		for (unsigned int m = 0; m < meanings; m++) {
+			out << (m > 0 ? ";" : "") << pool[gen.next() % pool.size()];
+		}
+		out << '\n';
+	}
+}
+
+//imports the files into a fresh table with the given thread count (0 = the sequential import) and returns seconds
+double timeImport(const vector<string>& files, unsigned int threads, string& exported) {
+	HashTable table(1000);
+	//the per-file messages would drown the results
+	streambuf* saved = cout.rdbuf(nullptr);
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	if (threads == 0) {
+		for (const string& f : files) table.import(f);
+	}
+	else {
+		table.setImportThreads(threads);
+		table.importParallel(files);
+	}
+	double seconds = nanosSince(start) / 1e9;
+	//export one language so runs can be checked against each other
+	table.exportData("de", "bench_import.out");
+	cout.rdbuf(saved);
+	//the import resets the float format it used for its own report
+	cout.clear();
+	cout << fixed;
+	ifstream in("bench_import.out");
+	stringstream text;
+	text << in.rdbuf();
+	exported = text.str();
+	remove("bench_import.out");
+	return seconds;
+}
+
+//times the sequential import against the parallel one on 1 to maxThreads threads
+void benchImport(unsigned int keys, unsigned int maxThreads) {
+	const char* languages[] = { "de", "fr", "es" };
+	vector<string> pool = makeWords(keys / 2, 3, vector<string>());
+	vector<string> files;
+	for (unsigned int i = 0; i < 3; i++) {
+		files.push_back(string("bench_import_") + languages[i] + ".txt");
+		writeDictionary(files.back(), languages[i], keys, pool, 10 + i);
+	}
+
+	cout << "3 files of " << keys << " lines, " << thread::hardware_concurrency() << " hardware threads" << endl;
+	cout << fixed << setprecision(3);
+	cout << left << setw(12) << "threads" << right << setw(10) << "seconds" << setw(14) << "lines/s" << setw(10) << "speedup" << endl;
+	string reference, exported;
+	double sequential = timeImport(files, 0, reference);
+	cout << left << setw(12) << "sequential" << right << setw(10) << setprecision(3) << sequential
+		<< setw(14) << setprecision(0) << 3 * keys / sequential << setw(10) << setprecision(2) << 1.0 << endl;
+	for (unsigned int threads = 1; threads <= maxThreads; threads = threads * 2 <= maxThreads || threads == maxThreads ? threads * 2 : maxThreads) {
+		double seconds = timeImport(files, threads, exported);
+		cout << left << setw(12) << threads << right << setw(10) << setprecision(3) << seconds
+			<< setw(14) << setprecision(0) << 3 * keys / seconds << setw(10) << setprecision(2) << sequential / seconds
+			<< (exported == reference ? "" : "  (result differs from sequential import!)") << endl;
+	}
+	for (const string& f : files) remove(f.c_str());
+}
+
+//reports what the store spends per entry on a dictionary of keys words in three languages
+void benchMemory(unsigned int keys) {
+	vector<string> words = makeWords(keys, 4, vector<string>());
+	const char* languages[] = { "German", "French", "Spanish" };
+	HashTable table(keys / 0.8 + 1);
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (unsigned int l = 0; l < 3; l++) {
+		for (unsigned int i = 0; i < keys; i++) {
+			//two meanings per word and language, drawn from the word list itself
+			const string& a = words[(i * 7 + l) % keys];
+			const string& b = words[(i * 13 + l + 1) % keys];
+			table.insert(words[i], a + ";" + b, languages[l]);
+		}
+	}
+	double seconds = nanosSince(start) / 1e9;
+
+	MemoryStats memory = table.getMemoryStats();
+	double entries = memory.entries;
+	cout << keys << " words, 3 languages, 2 meanings each, built in " << fixed << setprecision(3) << seconds << " s" << endl;
+	cout << setprecision(1);
+	cout << left << setw(12) << "part" << right << setw(14) << "bytes" << setw(14) << "per entry" << endl;
+	cout << left << setw(12) << "slots" << right << setw(14) << memory.tableBytes << setw(14) << memory.tableBytes / entries << endl;
+	cout << left << setw(12) << "pool" << right << setw(14) << memory.poolBytes << setw(14) << memory.poolBytes / entries << endl;
+	cout << left << setw(12) << "records" << right << setw(14) << memory.recordBytes << setw(14) << memory.recordBytes / entries << endl;
+	cout << left << setw(12) << "garbage" << right << setw(14) << memory.garbageBytes << setw(14) << memory.garbageBytes / entries << endl;
+	unsigned long total = memory.tableBytes + memory.poolBytes + memory.recordBytes;
+	cout << left << setw(12) << "total" << right << setw(14) << total << setw(14) << total / entries << endl;
+}
+
+//times single lookups against findBatch on batches of 1 to 1024 words, half of them misses
+void benchBatch(unsigned int keys) {
+	vector<string> words = makeWords(keys, 8, vector<string>());
+	vector<string> misses = makeWords(keys / 4, 9, words);
+	HashTable table(keys / 0.8 + 1);
+	for (const string& w : words) table.insert(w, "x", "German");
+	//queries in random order, so consecutive lookups land far apart in the table
+	WordGenerator gen(10);
+	vector<string> queries;
+	const unsigned int lookups = 1 << 20;
+	for (unsigned int i = 0; i < lookups; i++) {
+		queries.push_back(i % 2 ? words[gen.next() % words.size()] : misses[gen.next() % misses.size()]);
+	}
+
+	cout << keys << " words, " << lookups << " lookups, half of them misses" << endl;
+	cout << fixed << setprecision(1);
+	cout << left << setw(8) << "batch" << right << setw(12) << "single ns" << setw(12) << "batch ns" << setw(10) << "speedup" << endl;
+	vector<string> batch;
+	vector<EntryView> results;
+	for (unsigned int size = 1; size <= 1024; size *= 2) {
+		unsigned int found = 0, foundBatch = 0;
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		for (const string& q : queries) found += table.find(q).found();
+		double single = nanosSince(start) / lookups;
+		start = chrono::steady_clock::now();
+		for (unsigned int i = 0; i < lookups; i += size) {
+			batch.assign(queries.begin() + i, queries.begin() + min(i + size, lookups));
+			table.findBatch(batch, results);
+			for (const EntryView& r : results) foundBatch += r.found();
+		}
+		//copying the batch is part of what a caller pays, so it stays inside the timing
+		double batched = nanosSince(start) / lookups;
+		cout << left << setw(8) << size << right << setw(12) << single << setw(12) << batched << setw(10) << single / batched
+			<< (found == foundBatch ? "" : "  (lookup mismatch!)") << endl;
+	}
+}
+
+//times reverse lookups with the index against forward lookups and against scanning every entry
+void benchReverse(unsigned int keys) {
+	vector<string> words = makeWords(keys, 11, vector<string>());
+	const char* languages[] = { "German", "French", "Spanish" };
+	HashTable table(keys / 0.8 + 1);
+	for (unsigned int l = 0; l < 3; l++) {
+		for (unsigned int i = 0; i < keys; i++) {
+			//two meanings per word and language, each meaning shared by two words
+			table.insert(words[i], words[(i * 7 + l) % keys] + ";" + words[(i * 13 + l + 1) % keys], languages[l]);
+		}
+	}
+	WordGenerator gen(12);
+	vector<string> queries;
+	for (unsigned int i = 0; i < 100000; i++) queries.push_back(words[gen.next() % keys]);
+	vector<EntryView> results;
+	unsigned long found = 0;
+
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (const string& q : queries) found += table.find(q).found();
+	double forward = nanosSince(start) / queries.size();
+	//without the index a lookup reads every entry, a few of them show the cost
+	start = chrono::steady_clock::now();
+	for (unsigned int i = 0; i < 10; i++) {
+		table.findReverse(queries[i], "French", results);
+		found += results.size();
+	}
+	double scan = nanosSince(start) / 10;
+	start = chrono::steady_clock::now();
+	table.setReverseIndex(true);
+	double build = nanosSince(start) / 1e6;
+	start = chrono::steady_clock::now();
+	for (const string& q : queries) {
+		table.findReverse(q, "French", results);
+		found += results.size();
+	}
+	double indexed = nanosSince(start) / queries.size();
+
+	MemoryStats memory = table.getMemoryStats();
+	unsigned long total = memory.tableBytes + memory.poolBytes + memory.recordBytes;
+	cout << keys << " words, 3 languages, 2 meanings each (" << found << " results)" << endl;
+	cout << fixed << setprecision(1);
+	cout << left << setw(24) << "forward find" << right << setw(14) << forward << " ns" << endl;
+	cout << left << setw(24) << "reverse, index" << right << setw(14) << indexed << " ns" << endl;
+	cout << left << setw(24) << "reverse, scan" << right << setw(14) << scan << " ns" << endl;
+	cout << left << setw(24) << "index build" << right << setw(14) << build << " ms" << endl;
+	cout << left << setw(24) << "index bytes per entry" << right << setw(14) << (double)memory.indexBytes / memory.entries
+		<< " (" << 100.0 * memory.indexBytes / total << "% of the table)" << endl;
+}
+
+//times top-10 completions from the prefix trie against scanning every entry, by prefix length
+void benchComplete(unsigned int keys) {
+	vector<string> words = makeWords(keys, 13, vector<string>());
+	HashTable table(keys / 0.8 + 1);
+	for (const string& w : words) table.insert(w, "x", "German");
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	table.setPrefixIndex(true);
+	double build = nanosSince(start) / 1e6;
+	MemoryStats memory = table.getMemoryStats();
+
+	cout << keys << " words, trie built in " << fixed << setprecision(1) << build << " ms, "
+		<< (double)memory.trieBytes / memory.entries << " bytes per entry" << endl;
+	cout << left << setw(8) << "prefix" << right << setw(12) << "trie us" << setw(12) << "scan us" << setw(12) << "results" << endl;
+	WordGenerator gen(14);
+	vector<EntryView> results;
+	for (unsigned int length = 1; length <= 6; length++) {
+		//prefixes of stored words, so every query has completions to walk
+		vector<string> prefixes;
+		for (unsigned int i = 0; i < 10000; i++) {
+			const string& w = words[gen.next() % keys];
+			prefixes.push_back(w.substr(0, length));
+		}
+		unsigned long found = 0;
+		start = chrono::steady_clock::now();
+		for (const string& p : prefixes) {
+			table.complete(p, 10, results);
+			found += results.size();
+		}
+		double trie = nanosSince(start) / 1e3 / prefixes.size();
+		table.setPrefixIndex(false);
+		start = chrono::steady_clock::now();
+		for (unsigned int i = 0; i < 5; i++) table.complete(prefixes[i], 10, results);
+		double scan = nanosSince(start) / 1e3 / 5;
+		table.setPrefixIndex(true);
+		cout << left << setw(8) << length << right << setw(12) << setprecision(2) << trie << setw(12) << setprecision(0) << scan
+			<< setw(12) << setprecision(1) << (double)found / prefixes.size() << endl;
+	}
+}
+
+//replaces the dictionary ten times over by deleting and adding words, with and without the
+//automatic rehash and compaction, and reports probe chains, miss cost and memory as it goes
+void benchChurn(unsigned int keys) {
+	vector<string> words = makeWords(keys * 11, 19, vector<string>());
+	vector<string> misses = makeWords(100000, 20, words);
+	cout << keys << " live words; each round deletes and adds " << keys / 2 << endl;
+	for (unsigned int automatic = 0; automatic <= 1; automatic++) {
+		HashTable table(keys / 0.8 + 1);
+		if (!automatic) table.setCompaction(0, 0);
+		for (unsigned int i = 0; i < keys; i++) table.insert(words[i], "x;y", "German");
+		cout << (automatic ? "automatic rehash and compaction" : "no maintenance") << endl;
+		cout << left << setw(6) << "round" << right << setw(10) << "capacity" << setw(12) << "tombstones" << setw(10) << "miss run"
+			<< setw(10) << "miss ns" << setw(12) << "MB held" << setw(12) << "MB garbage" << setw(10) << "churn s" << endl;
+		//words[oldest, next) are live, the oldest half goes each round
+		unsigned int oldest = 0, next = keys;
+		for (unsigned int round = 0; round <= 20; round++) {
+			double churn = 0;
+			if (round > 0) {
+				chrono::steady_clock::time_point start = chrono::steady_clock::now();
+				for (unsigned int i = 0; i < keys / 2; i++) {
+					table.delWord(words[oldest++]);
+					table.insert(words[next++], "x;y", "German");
+				}
+				churn = nanosSince(start) / 1e9;
+			}
+			if (round % 4 != 0) continue;
+			unsigned int found = 0;
+			chrono::steady_clock::time_point start = chrono::steady_clock::now();
+			for (const string& w : misses) found += table.contains(w);
+			double missNs = nanosSince(start) / misses.size();
+			ProbeHealth health = table.getProbeHealth();
+			MemoryStats memory = table.getMemoryStats();
+			unsigned long held = memory.tableBytes + memory.poolBytes + memory.recordBytes;
+			cout << left << setw(6) << round << right << setw(10) << table.getCapacity() << setw(12) << health.tombstones
+				<< fixed << setprecision(2) << setw(10) << health.meanMissRun << setprecision(1) << setw(10) << missNs
+				<< setw(12) << held / 1e6 << setw(12) << memory.garbageBytes / 1e6 << setprecision(3) << setw(10) << churn
+				<< (found == 0 ? "" : "  (lookup mismatch!)") << endl;
+		}
+	}
+}
+
+//returns a misspelling of a word: an umlaut typed as its ae/oe/ue transliteration, or one byte
+//replaced, dropped, doubled or swapped with the next
+string misspell(const string& word, WordGenerator& gen) {
+	const char* umlauts[][2] = { { "\xc3\xa4", "ae" }, { "\xc3\xb6", "oe" }, { "\xc3\xbc", "ue" } };
+	for (unsigned int u = 0; u < 3; u++) {
+		size_t at = word.find(umlauts[u][0]);
+		if (at != string::npos && gen.next() % 2 == 0) {
+			return word.substr(0, at) + umlauts[u][1] + word.substr(at + 2);
+		}
+	}
+	string w = word;
+	//ASCII bytes only, so the result stays valid UTF-8
+	unsigned int at = gen.next() % w.size();
+	for (unsigned int tries = 0; tries < w.size() && (w[at] & 0x80); tries++) at = (at + 1) % w.size();
+	if (w[at] & 0x80) return w + "x";
+	switch (gen.next() % 4) {
+		case 0: w[at] = 'a' + gen.next() % 26; break;
+		case 1: if (w.size() > 1) w.erase(at, 1); break;
+		case 2: w.insert(at, 1, w[at]); break;
+		default: if (at + 1 < w.size() && !(w[at + 1] & 0x80)) swap(w[at], w[at + 1]); break;
+	}
+	return w;
+}
+
+//times "did you mean" suggestions for misspelled words from the prefix trie against a scan,
+//on a dictionary file, or on keys generated words when given a number
+void benchFuzzy(const string& source) {
+	vector<string> words;
+	HashTable table(1171891);
+	if (!source.empty() && isdigit(source[0])) {
+		words = makeWords(stoul(source), 17, vector<string>());
+		for (const string& w : words) table.insert(w, "x", "German");
+	}
+	else {
+		readWords(source, words);
+		streambuf* quiet = cout.rdbuf(nullptr);
+		table.import(source);
+		cout.rdbuf(quiet);
+		cout.clear();
+	}
+	if (words.empty()) {
+		cout << "No words in " << source << "." << endl;
+		return;
+	}
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	table.setPrefixIndex(true);
+	double build = nanosSince(start) / 1e6;
+	WordGenerator gen(18);
+	vector<string> queries, intended;
+	for (unsigned int i = 0; i < 20000; i++) {
+		intended.push_back(words[gen.next() % words.size()]);
+		queries.push_back(misspell(intended.back(), gen));
+	}
+	cout << table.getSize() << " words, trie built in " << fixed << setprecision(1) << build << " ms" << endl;
+	cout << left << setw(10) << "distance" << right << setw(10) << "mean us" << setw(10) << "p50 us" << setw(10) << "p99 us"
+		<< setw(10) << "scan us" << setw(12) << "suggested" << setw(12) << "intended" << endl;
+	vector<Suggestion> suggestions;
+	for (unsigned int distance = 1; distance <= 2; distance++) {
+		vector<double> latencies;
+		unsigned long suggested = 0, recovered = 0;
+		for (unsigned int i = 0; i < queries.size(); i++) {
+			start = chrono::steady_clock::now();
+			table.suggest(queries[i], distance, 5, suggestions);
+			latencies.push_back(nanosSince(start) / 1e3);
+			suggested += suggestions.size();
+			for (const Suggestion& s : suggestions) {
+				TextView w = s.entry.word();
+				recovered += string(w.data, w.length) == intended[i];
+			}
+		}
+		double mean = 0;
+		for (double l : latencies) mean += l;
+		mean /= latencies.size();
+		sort(latencies.begin(), latencies.end());
+		table.setPrefixIndex(false);
+		start = chrono::steady_clock::now();
+		for (unsigned int i = 0; i < 5; i++) table.suggest(queries[i], distance, 5, suggestions);
+		double scan = nanosSince(start) / 1e3 / 5;
+		table.setPrefixIndex(true);
+		cout << left << setw(10) << distance << right << setprecision(2) << setw(10) << mean << setw(10) << latencies[latencies.size() / 2]
+			<< setw(10) << latencies[latencies.size() * 99 / 100] << setprecision(0) << setw(10) << scan << setprecision(2)
+			<< setw(12) << (double)suggested / queries.size() << setw(11) << 100.0 * recovered / queries.size() << "%" << endl;
+	}
+}
+
+//lays the words out the way HashTable does with one hash and one reduction policy (linear
+//probing from the home slot, at load 0.8 or below where the reduction rounds the capacity up)
+//and prints one row: hashing cost, lookup cost,
+//collisions, probe lengths, and distinct words sharing a full 32-bit slot hash
+template<class Hash, class Reduce>
+void timePolicy(const vector<string>& words) {
+	unsigned int n = words.size();
+	unsigned int capacity = Reduce::capacityFor(n / 0.8 + 1);
+	unsigned long sink = 0;
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (const string& w : words) sink += Hash::hash(w.data(), w.size());
+	double hashNs = nanosSince(start) / n;
+
+	vector<Slot> slots(capacity);
+	for (Slot& s : slots) s.entry = ~0u;
+	vector<unsigned int> histogram(PROBE_HISTOGRAM_SIZE, 0);
+	unsigned long collisions = 0;
+	unsigned int longest = 0;
+	vector<unsigned int> hashes(n);
+	for (unsigned int i = 0; i < n; i++) {
+		hashes[i] = slotHashOf<Hash>(words[i].data(), words[i].size());
+		unsigned int pos = Reduce::home(hashes[i], capacity), distance = 0;
+		while (slots[pos].entry != ~0u) {
+			if (++pos == capacity) pos = 0;
+			distance++;
+		}
+		slots[pos].hash = hashes[i];
+		slots[pos].entry = i;
+		collisions += distance;
+		longest = max(longest, distance);
+		histogram[min(distance, PROBE_HISTOGRAM_SIZE - 1)]++;
+	}
+	//the probe length below which 99% of the words sit
+	unsigned int p99 = 0;
+	for (unsigned long seen = histogram[0]; seen < 0.99 * n && p99 + 1 < PROBE_HISTOGRAM_SIZE; seen += histogram[++p99]);
+
+	//every word looked up once in a scrambled order, hashing included
+	WordGenerator gen(21);
+	vector<unsigned int> order(n);
+	for (unsigned int i = 0; i < n; i++) order[i] = i;
+	for (unsigned int i = n - 1; i > 0; i--) swap(order[i], order[gen.next() % (i + 1)]);
+	unsigned int found = 0;
+	start = chrono::steady_clock::now();
+	for (unsigned int i : order) {
+		const string& w = words[i];
+		unsigned int hash = slotHashOf<Hash>(w.data(), w.size());
+		for (unsigned int pos = Reduce::home(hash, capacity); slots[pos].entry != ~0u; pos = pos + 1 == capacity ? 0 : pos + 1) {
+			if (slots[pos].hash == hash && words[slots[pos].entry] == w) {
+				found++;
+				break;
+			}
+		}
+	}
+	double lookupNs = nanosSince(start) / n;
+
+	sort(hashes.begin(), hashes.end());
+	unsigned int shared = 0;
+	for (unsigned int i = 1; i < n; i++) shared += hashes[i] == hashes[i - 1];
+	cout << left << setw(14) << Hash::name() << setw(11) << Reduce::name() << right << fixed << setprecision(2)
+		<< setw(6) << (double)n / capacity << setprecision(1) << setw(9) << hashNs << setw(11) << lookupNs << setprecision(3) << setw(12) << (double)collisions / n
+		<< setw(6) << p99 << setw(7) << longest << setw(9) << shared
+		<< (found == n ? "" : "  (lookup mismatch!)") << (sink == 1 ? " " : "") << endl;
+}
+
+//runs timePolicy for every reduction with one hash
+template<class Hash>
+void timeHash(const vector<string>& words) {
+	timePolicy<Hash, ModuloReduce>(words);
+	timePolicy<Hash, MaskReduce>(words);
+	timePolicy<Hash, FastRangeReduce>(words);
+}
+
+//compares every hash and reduction policy on the words of a dictionary file, or on keys
+//generated words when given a number
+void benchHash(const string& source) {
+	vector<string> words;
+	if (!source.empty() && isdigit(source[0])) {
+		words = makeWords(stoul(source), 22, vector<string>());
+	}
+	else {
+		readWords(source, words);
+		//a word listed twice would be stored once
+		sort(words.begin(), words.end());
+		words.erase(unique(words.begin(), words.end()), words.end());
+	}
+	if (words.empty()) {
+		cout << "No words in " << source << "." << endl;
+		return;
+	}
+	cout << words.size() << " words; this build uses " << KeyHash::name() << " with " << SlotReduce::name() << endl;
+	cout << left << setw(14) << "hash" << setw(11) << "reduce" << right << setw(6) << "load" << setw(9) << "hash ns" << setw(11) << "lookup ns"
+		<< setw(12) << "coll/entry" << setw(6) << "p99" << setw(7) << "max" << setw(9) << "shared" << endl;
+	timeHash<PolynomialHash>(words);
+	timeHash<CyclicShiftHash>(words);
+	timeHash<Djb2Hash>(words);
+	timeHash<WyHash>(words);
+	timeHash<XxHash64>(words);
+}
+
+//======================================================
+//a HashTable behind one mutex, the baseline the concurrent table is measured against
+class LockedTable
+{
+	private:
+		HashTable table;
+		mutex lock;
+	public:
+		LockedTable(int capacity) : table(capacity) {}
+		bool getMeanings(const string& word, const string& language, vector<string>& meanings) {
+			lock_guard<mutex> guard(lock);
+			return table.getMeanings(word, language, meanings);
+		}
+		void insert(const string& word, const string& meanings, const string& language) {
+			lock_guard<mutex> guard(lock);
+			table.insert(word, meanings, language);
+		}
+		void delMeaning(const string& word, const string& meaning, const string& language) {
+			lock_guard<mutex> guard(lock);
+			table.delMeaning(word, meaning, language);
+		}
+};
+
+//runs opsPerThread lookups and changes on each of threads threads, writeShare percent of them
+//changes, and returns the operations per second over all threads
+template<class Table>
+double timeMixed(Table& table, const vector<string>& words, unsigned int threads, unsigned int opsPerThread, unsigned int writeShare) {
+	vector<thread> workers;
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (unsigned int t = 0; t < threads; t++) {
+		workers.push_back(thread([&, t]() {
+			WordGenerator gen(100 + t);
+			vector<string> meanings;
+			bool added = false;
+			for (unsigned int i = 0; i < opsPerThread; i++) {
+				const string& word = words[gen.next() % words.size()];
+				if (gen.next() % 100 < writeShare) {
+					//changes alternate between adding a meaning and taking one away
+					if (added) table.delMeaning(word, "extra", "German");
+					else table.insert(word, "extra", "German");
+					added = !added;
+				}
+				else {
+					table.getMeanings(word, "German", meanings);
+				}
+			}
+		}));
+	}
+	for (thread& w : workers) w.join();
+	return (double)threads * opsPerThread / (nanosSince(start) / 1e9);
+}
+
+//compares the lock-free-reading table with a mutex-guarded one at several write ratios
+void benchConcurrent(unsigned int keys, unsigned int threads) {
+	vector<string> words = makeWords(keys, 5, vector<string>());
+	ConcurrentTable concurrent(keys / 0.8 + 1);
+	LockedTable locked(keys / 0.8 + 1);
+	for (unsigned int i = 0; i < keys; i++) {
+		concurrent.insert(words[i], words[(i * 7) % keys], "German");
+		locked.insert(words[i], words[(i * 7) % keys], "German");
+	}
+	const unsigned int writeShares[] = { 0, 1, 10, 50 };
+	const unsigned int opsPerThread = 200000;
+
+	cout << keys << " words, " << threads << " threads, " << opsPerThread << " operations per thread" << endl;
+	cout << fixed << setprecision(2);
+	cout << left << setw(10) << "writes %" << right << setw(16) << "left-right Mop/s" << setw(14) << "mutex Mop/s" << setw(10) << "speedup" << endl;
+	for (unsigned int share : writeShares) {
+		double lockFree = timeMixed(concurrent, words, threads, opsPerThread, share);
+		double mutexed = timeMixed(locked, words, threads, opsPerThread, share);
+		cout << left << setw(10) << share << right << setw(16) << lockFree / 1e6 << setw(14) << mutexed / 1e6 << setw(10) << lockFree / mutexed << endl;
+	}
+}
+
+//readers check words that never change while writers add and remove words of their own;
+//any reader seeing a wrong answer, or either copy differing at the end, fails the run
+void benchStress(unsigned int keys, unsigned int threads) {
+	unsigned int writers = max(threads / 2, 1u), readers = max(threads - writers, 1u);
+	const unsigned int volatileWords = 500, rounds = 20;
+	vector<string> stable = makeWords(keys, 6, vector<string>());
+	vector<string> changing = makeWords(writers * volatileWords, 7, stable);
+	//a small table makes the writers grow it while readers are on it
+	ConcurrentTable table(64);
+	for (unsigned int i = 0; i < keys; i++) {
+		table.insert(stable[i], "s" + to_string(i), "German");
+	}
+
+	atomic<unsigned long> reads(0), writes(0), errors(0);
+	atomic<bool> done(false);
+	vector<thread> workers;
+	for (unsigned int r = 0; r < readers; r++) {
+		workers.push_back(thread([&, r]() {
+			WordGenerator gen(200 + r);
+			vector<string> meanings;
+			unsigned long count = 0;
+			while (!done.load()) {
+				unsigned int i = gen.next() % keys;
+				if (!table.getMeanings(stable[i], "German", meanings) || meanings.size() != 1 || meanings[0] != "s" + to_string(i)) {
+					errors++;
+				}
+				//a changing word is either missing or carries its own meanings, nothing else
+				unsigned int j = gen.next() % changing.size();
+				if (table.getMeanings(changing[j], "French", meanings)) {
+					for (const string& m : meanings) {
+						if (m != "v" + to_string(j) && m != "w" + to_string(j)) errors++;
+					}
+				}
+				count += 2;
+			}
+			reads += count;
+		}));
+	}
+	vector<thread> writing;
+	for (unsigned int w = 0; w < writers; w++) {
+		writing.push_back(thread([&, w]() {
+			unsigned long count = 0;
+			for (unsigned int round = 0; round < rounds; round++) {
+				for (unsigned int k = w * volatileWords; k < (w + 1) * volatileWords; k++) {
+					//each writer owns its words, so every result is known in advance
+					if (table.insert(changing[k], "v" + to_string(k), "French") != EDIT_DONE) errors++;
+					if (table.insert(changing[k], "w" + to_string(k), "French") != EDIT_DONE) errors++;
+					if (table.delMeaning(changing[k], "v" + to_string(k), "French") != EDIT_DONE) errors++;
+					if (round % 2 == 0) {
+						if (table.delWord(changing[k]) != EDIT_DONE) errors++;
+					}
+					else if (table.delTranslation(changing[k], "French") != EDIT_DONE) errors++;
+					count += 4;
+				}
+			}
+			writes += count;
+		}));
+	}
+	for (thread& w : writing) w.join();
+	done.store(true);
+	for (thread& w : workers) w.join();
+
+	//check the copy readers are on, then flip to the other one with a change that undoes itself
+	vector<string> meanings;
+	for (unsigned int copy = 0; copy < 2; copy++) {
+		if (table.getSize() != keys) errors++;
+		for (unsigned int i = 0; i < keys; i++) {
+			if (!table.getMeanings(stable[i], "German", meanings) || meanings.size() != 1 || meanings[0] != "s" + to_string(i)) errors++;
+		}
+		for (const string& word : changing) {
+			if (table.contains(word)) errors++;
+		}
+		table.insert(changing[0], "x", "French");
+		table.delWord(changing[0]);
+	}
+
+	cout << readers << " readers, " << writers << " writers: " << reads.load() << " reads, " << writes.load() << " writes, "
+		<< errors.load() << " errors" << endl;
+	cout << (errors.load() == 0 ? "PASSED" : "FAILED") << endl;
+}
+
+//======================================================
+//shape of a generated multilingual dictionary
+struct DictionarySpec
+{
+	unsigned int keys;			// lines per language file
+	unsigned int languages;		// files, one language each
+	double shared;				// share of each file's words that every language lists
+	double meaningSkew;			// Zipf exponent meanings are drawn with (0 = uniform)
+	unsigned long seed;			// the same spec and seed write the same files
+};
+
+//languages of the generated files and the letters past a to z their words use
+const char* SUITE_LANGUAGES[] = { "German", "French", "Spanish", "Italian", "Dutch", "Swedish", "Polish", "Turkish" };
+const char* SUITE_LETTERS[] = { "\xC3\xA4\xC3\xB6\xC3\xBC\xC3\x9F", "\xC3\xA9\xC3\xA8\xC3\xA0\xC3\xA7", "\xC3\xB1\xC3\xA1\xC3\xB3", "",
+	"", "\xC3\xA5\xC3\xA4\xC3\xB6", "\xC5\x82\xC4\x85\xC5\xBC", "\xC3\xA7\xC4\x9F\xC3\xBC" };
+
+//draws ranks 0 to n-1 with probabilities proportional to 1/(rank+1)^s
+class ZipfSampler
+{
+	private:
+		vector<double> cdf;
+	public:
+		ZipfSampler(unsigned int n, double s) : cdf(n) {
+			double sum = 0;
+			for (unsigned int i = 0; i < n; i++) {
+				sum += pow(i + 1.0, -s);
+				cdf[i] = sum;
+			}
+		}
+		unsigned int next(WordGenerator& gen) {
+			//next() gives 31 random bits
+			double u = (gen.next() + 0.5) / 2147483648.0 * cdf.back();
+			return min((unsigned int)(lower_bound(cdf.begin(), cdf.end(), u) - cdf.begin()), (unsigned int)cdf.size() - 1);
+		}
+};
+
+//returns the name of the l-th generated language
+string suiteLanguage(unsigned int l) {
+	string name = SUITE_LANGUAGES[l % 8];
+	return l < 8 ? name : name + to_string(l / 8);
+}
+
+//returns a pseudo-word that mixes the language's own letters in among a to z
+string languageWord(WordGenerator& gen, unsigned int l) {
+	const char *letters = SUITE_LETTERS[l % 8];
+	//the extra letters are two-byte UTF-8 sequences
+	unsigned int extra = strlen(letters) / 2;
+	string w;
+	unsigned int length = 4 + gen.next() % 9;
+	for (unsigned int i = 0; i < length; i++) {
+		if (extra > 0 && gen.next() % 10 == 0) w.append(letters + 2 * (gen.next() % extra), 2);
+		else w += (char)('a' + gen.next() % 26);
+	}
+	return w;
+}
+
+//builds count distinct words spread over the styles of the given languages, all different from the words in avoid
+vector<string> makeLanguageWords(unsigned int count, unsigned int languages, unsigned long seed, const vector<string>& avoid) {
+	HashTable seen(2 * (count + avoid.size()));
+	for (const string& w : avoid) seen.insert(w, "x", "x");
+	WordGenerator gen(seed);
+	vector<string> words;
+	while (words.size() < count) {
+		string w = languageWord(gen, words.size() % languages);
+		if (!seen.contains(w)) {
+			seen.insert(w, "x", "x");
+			words.push_back(w);
+		}
+	}
+	return words;
+}
+
+//writes one dictionary file per language and returns their names; every file has spec.keys
+//distinct words, a share of them common to all languages, and one to three meanings per word
+//drawn from the common words with a Zipf skew. words receives every distinct word.
+vector<string> writeSuiteDictionaries(const DictionarySpec& spec, const string& prefix, vector<string>& words) {
+	unsigned int common = spec.keys * spec.shared;
+	words = makeWords(common, spec.seed, vector<string>());
+	vector<string> meanings = makeWords(max(spec.keys / 2, 1u), spec.seed + 1, words);
+	HashTable seen(2 * (spec.keys * spec.languages + meanings.size()) + 1);
+	for (const string& w : words) seen.insert(w, "x", "x");
+	ZipfSampler popularity(meanings.size(), spec.meaningSkew);
+	vector<string> files;
+	for (unsigned int l = 0; l < spec.languages; l++) {
+		WordGenerator gen(spec.seed * 1000 + l);
+		vector<string> own(words.begin(), words.begin() + common);
+		while (own.size() < spec.keys) {
+			string w = languageWord(gen, l);
+			//words differing only in case would share an entry
+			if (!seen.contains(w)) {
+				seen.insert(w, "x", "x");
+				own.push_back(w);
+				words.push_back(w);
+			}
+		}
+		files.push_back(prefix + suiteLanguage(l) + ".txt");
+		ofstream out(files.back());
+		out << suiteLanguage(l) << '\n';
+		//the common words are spread through the file rather than leading it
+		for (unsigned int i = own.size() - 1; i > 0; i--) swap(own[i], own[gen.next() % (i + 1)]);
+		for (const string& w : own) {
+			out << w << ':';
+			unsigned int count = 1 + gen.next() % 3;
+			for (unsigned int m = 0; m < count; m++) {
+				out << (m > 0 ? ";" : "") << meanings[popularity.next(gen)];
+			}
+			out << '\n';
+		}
+	}
+	return files;
+}
+
+//returns the q-quantile of sorted samples
+double percentile(const vector<double>& sorted, double q) {
+	return sorted.empty() ? 0 : sorted[min((size_t)(q * sorted.size()), sorted.size() - 1)];
+}
+
+//times every lookup on its own and returns the latencies in nanoseconds, sorted, less what
+//reading the clock costs
+vector<double> timeEachFind(HashTable& table, const vector<string>& queries, unsigned int &found) {
+	vector<double> overhead(1000);
+	for (double& o : overhead) {
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		o = nanosSince(start);
+	}
+	sort(overhead.begin(), overhead.end());
+	double clock = percentile(overhead, 0.5);
+	vector<double> latencies(queries.size());
+	found = 0;
+	for (size_t i = 0; i < queries.size(); i++) {
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		found += table.find(queries[i]).found();
+		latencies[i] = max(nanosSince(start) - clock, 0.0);
+	}
+	sort(latencies.begin(), latencies.end());
+	return latencies;
+}
+
+//named results of a suite run, written out as one JSON object
+class SuiteReport
+{
+	private:
+		vector<pair<string, string> > fields;
+	public:
+		void add(const string& name, double value) {
+			ostringstream text;
+			text << setprecision(10) << value;
+			fields.push_back(make_pair(name, text.str()));
+		}
+		void add(const string& name, const string& value) {
+			fields.push_back(make_pair(name, "\"" + value + "\""));
+		}
+		//adds the mean and percentiles of sorted latencies and prints them as one row
+		void addLatencies(const string& name, const vector<double>& sorted) {
+			double sum = 0;
+			for (double l : sorted) sum += l;
+			const double quantiles[] = { 0.5, 0.9, 0.99, 0.999 };
+			const char* labels[] = { "p50", "p90", "p99", "p999" };
+			add(name + "_mean_ns", sum / sorted.size());
+			cout << left << setw(12) << name << right << setprecision(1) << setw(9) << sum / sorted.size();
+			for (unsigned int q = 0; q < 4; q++) {
+				add(name + "_" + labels[q] + "_ns", percentile(sorted, quantiles[q]));
+				cout << setw(9) << percentile(sorted, quantiles[q]);
+			}
+			add(name + "_max_ns", sorted.back());
+			cout << setw(11) << sorted.back() << endl;
+		}
+		bool write(const string& path) {
+			ofstream out(path);
+			out << "{\n";
+			for (size_t i = 0; i < fields.size(); i++) {
+				out << "  \"" << fields[i].first << "\": " << fields[i].second << (i + 1 < fields.size() ? ",\n" : "\n");
+			}
+			out << "}\n";
+			return (bool)out;
+		}
+};
+
+//writes the suite's dictionary files for a spec and leaves them in place
+void benchGenerate(const DictionarySpec& spec, const string& prefix) {
+	vector<string> words;
+	vector<string> files = writeSuiteDictionaries(spec, prefix, words);
+	for (const string& f : files) cout << f << endl;
+	cout << files.size() << " files, " << spec.keys << " words each, " << words.size() << " distinct words" << endl;
+}
+
+//generates a dictionary, then measures import, lookup latencies for hits drawn with a Zipf skew
+//and for misses, insert throughput, delete churn and memory per entry, and writes every
+//number to a JSON file so runs can be compared
+void benchSuite(const DictionarySpec& spec, double querySkew, const string& resultsPath) {
+	SuiteReport report;
+	report.add("hash", KeyHash::name());
+	report.add("reduce", SlotReduce::name());
+	report.add("keys", spec.keys);
+	report.add("languages", spec.languages);
+	report.add("shared", spec.shared);
+	report.add("meaning_skew", spec.meaningSkew);
+	report.add("query_skew", querySkew);
+	report.add("seed", spec.seed);
+
+	vector<string> words;
+	vector<string> files = writeSuiteDictionaries(spec, "bench_suite_", words);
+	unsigned long bytes = 0;
+	for (const string& f : files) {
+		ifstream in(f, ios::binary | ios::ate);
+		bytes += in.tellg();
+	}
+	cout << spec.languages << " languages, " << spec.keys << " words each, " << words.size() << " distinct; queries with Zipf skew "
+		<< querySkew << "; " << KeyHash::name() << " with " << SlotReduce::name() << endl;
+	cout << fixed;
+
+	//import, quietly: the per-file messages would drown the results
+	HashTable table(1000);
+	streambuf* saved = cout.rdbuf(nullptr);
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (const string& f : files) table.import(f);
+	double seconds = nanosSince(start) / 1e9;
+	cout.rdbuf(saved);
+	cout.clear();
+	cout << fixed;
+	for (const string& f : files) remove(f.c_str());
+	unsigned long lines = (unsigned long)spec.keys * spec.languages;
+	report.add("import_seconds", seconds);
+	report.add("import_lines_per_second", lines / seconds);
+	report.add("import_mb_per_second", bytes / 1e6 / seconds);
+	cout << "import      " << setprecision(3) << seconds << " s, " << setprecision(0) << lines / seconds << " lines/s, "
+		<< setprecision(1) << bytes / 1e6 / seconds << " MB/s" << endl;
+
+	MemoryStats memory = table.getMemoryStats();
+	double entries = memory.entries;
+	unsigned long total = memory.tableBytes + memory.poolBytes + memory.recordBytes;
+	report.add("entries", entries);
+	report.add("slot_bytes_per_entry", memory.tableBytes / entries);
+	report.add("pool_bytes_per_entry", memory.poolBytes / entries);
+	report.add("record_bytes_per_entry", memory.recordBytes / entries);
+	report.add("bytes_per_entry", total / entries);
+	cout << "memory      " << setprecision(1) << total / entries << " bytes per entry (slots " << memory.tableBytes / entries
+		<< ", pool " << memory.poolBytes / entries << ", records " << memory.recordBytes / entries << ")" << endl;
+
+	//hits follow the skew over the words in a shuffled order, so popular words are spread over the table
+	unsigned int queryCount = max(words.size(), (size_t)100000);
+	WordGenerator gen(spec.seed + 2);
+	vector<string> ranked = words;
+	for (unsigned int i = ranked.size() - 1; i > 0; i--) swap(ranked[i], ranked[gen.next() % (i + 1)]);
+	ZipfSampler popularity(ranked.size(), querySkew);
+	vector<string> hits(queryCount);
+	for (string& q : hits) q = ranked[popularity.next(gen)];
+	//misses look like the words of the files, accented letters included
+	vector<string> misses = makeLanguageWords(queryCount, spec.languages, spec.seed + 3, words);
+
+	cout << left << setw(12) << "ns" << right << setw(9) << "mean" << setw(9) << "p50" << setw(9) << "p90"
+		<< setw(9) << "p99" << setw(9) << "p99.9" << setw(11) << "max" << endl;
+	unsigned int found;
+	report.addLatencies("find_hit", timeEachFind(table, hits, found));
+	unsigned int foundHits = found;
+	report.addLatencies("find_miss", timeEachFind(table, misses, found));
+	if (foundHits != hits.size() || found != 0) cout << "(lookup mismatch!)" << endl;
+
+	//inserts of new words into a table that starts small and grows
+	vector<string> fresh = makeWords(spec.keys, spec.seed + 4, vector<string>());
+	HashTable grown(1000);
+	start = chrono::steady_clock::now();
+	for (unsigned int i = 0; i < fresh.size(); i++) grown.insert(fresh[i], fresh[(i * 7 + 1) % fresh.size()], "German");
+	seconds = nanosSince(start) / 1e9;
+	report.add("insert_per_second", fresh.size() / seconds);
+	cout << "insert      " << setprecision(0) << fresh.size() / seconds << " words/s" << endl;
+
+	//churn: each step deletes one imported word and adds a new one, twice over half the words
+	unsigned int steps = words.size() / 2;
+	start = chrono::steady_clock::now();
+	for (unsigned int i = 0; i < steps; i++) {
+		table.delWord(words[i]);
+		table.insert(fresh[i % fresh.size()] + "x", "churn", "German");
+	}
+	seconds = nanosSince(start) / 1e9;
+	memory = table.getMemoryStats();
+	total = memory.tableBytes + memory.poolBytes + memory.recordBytes;
+	report.add("churn_ops_per_second", 2 * steps / seconds);
+	report.add("churn_bytes_per_entry", total / (double)memory.entries);
+	report.add("churn_garbage_bytes", memory.garbageBytes);
+	report.add("churn_tombstones", table.getTombstones());
+	cout << "churn       " << setprecision(0) << 2 * steps / seconds << " deletes and inserts/s, then " << setprecision(1)
+		<< total / (double)memory.entries << " bytes per entry, " << memory.garbageBytes / 1e6 << " MB garbage, "
+		<< table.getTombstones() << " tombstones" << endl;
+
+	if (report.write(resultsPath)) cout << "results written to " << resultsPath << endl;
+	else cout << "could not write " << resultsPath << endl;
+}
+
+//times exporting every language of a generated dictionary one file after another, and all of
+//them in one call on 1 to maxThreads threads
+void benchExport(unsigned int keys, unsigned int maxThreads) {
+	DictionarySpec spec;
+	spec.keys = keys;
+	spec.languages = 6;
+	spec.shared = 0.3;
+	spec.meaningSkew = 1.0;
+	spec.seed = 7;
+	vector<string> words;
+	vector<string> files = writeSuiteDictionaries(spec, "bench_export_", words);
+	HashTable table(1000);
+	streambuf* saved = cout.rdbuf(nullptr);
+	for (const string& f : files) table.import(f);
+	cout.rdbuf(saved);
+	cout.clear();
+	for (const string& f : files) remove(f.c_str());
+	vector<ExportTarget> targets(spec.languages);
+	for (unsigned int l = 0; l < spec.languages; l++) {
+		targets[l].language = suiteLanguage(l);
+		targets[l].path = "bench_export_" + suiteLanguage(l) + ".out";
+	}
+
+	cout << spec.languages << " languages, " << keys << " words each, " << words.size() << " entries" << endl;
+	cout << fixed << setprecision(3);
+	cout << left << setw(12) << "threads" << right << setw(10) << "seconds" << setw(10) << "MB/s" << setw(12) << "records" << endl;
+	long records = 0;
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (const ExportTarget& target : targets) records += table.exportData(target.language, target.path);
+	double seconds = nanosSince(start) / 1e9;
+	unsigned long bytes = 0;
+	for (const ExportTarget& target : targets) {
+		ifstream in(target.path, ios::binary | ios::ate);
+		bytes += in.tellg();
+	}
+	cout << left << setw(12) << "one by one" << right << setw(10) << seconds << setw(10) << setprecision(1) << bytes / 1e6 / seconds
+		<< setw(12) << records << endl;
+	for (unsigned int threads = 1; threads <= maxThreads; threads = threads * 2 <= maxThreads || threads == maxThreads ? threads * 2 : maxThreads) {
+		start = chrono::steady_clock::now();
+		table.exportLanguages(targets, threads);
+		seconds = nanosSince(start) / 1e9;
+		long together = 0;
+		for (const ExportTarget& target : targets) together += target.records;
+		cout << left << setw(12) << threads << right << setprecision(3) << setw(10) << seconds << setprecision(1) << setw(10)
+			<< bytes / 1e6 / seconds << setw(12) << together << (together == records ? "" : "  (record count differs!)") << endl;
+	}
+	for (const ExportTarget& target : targets) remove(target.path.c_str());
+}
+
+//imports generated language files one by one and through a manifest, checks both give the
+//same table, and shows where the manifest import's stages spent their time
+void benchPipeline(unsigned int keys) {
+	DictionarySpec spec;
+	spec.keys = keys;
+	spec.languages = 3;
+	spec.shared = 0.3;
+	spec.meaningSkew = 1.0;
+	spec.seed = 13;
+	vector<string> words;
+	vector<string> files = writeSuiteDictionaries(spec, "bench_pipeline_", words);
+	string manifest = "bench_pipeline.manifest";
+	{
+		ofstream list(manifest);
+		for (const string& f : files) list << f << '\n';
+	}
+
+	HashTable one(1000), piped(1000);
+	streambuf* saved = cout.rdbuf(nullptr);
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (const string& f : files) one.import(f);
+	double oneSeconds = nanosSince(start) / 1e9;
+	start = chrono::steady_clock::now();
+	piped.importManifest(manifest);
+	double pipedSeconds = nanosSince(start) / 1e9;
+	cout.rdbuf(saved);
+	cout.clear();
+	//every word must come back with the same meanings
+	unsigned int wrong = 0;
+	for (const string& w : words) {
+		vector<string> a, b;
+		for (unsigned int l = 0; l < spec.languages; l++) {
+			one.getMeanings(w, suiteLanguage(l), a);
+			piped.getMeanings(w, suiteLanguage(l), b);
+			wrong += a != b;
+		}
+	}
+	for (const string& f : files) remove(f.c_str());
+	remove(manifest.c_str());
+
+	PipelineStats stats = piped.getPipelineStats();
+	unsigned long bytes = stats.stages[STAGE_READ].bytes;
+	cout << spec.languages << " files of " << keys << " lines, " << bytes / 1000000 << " MB, "
+		<< thread::hardware_concurrency() << " hardware threads"
+		<< (wrong ? ", meanings differ for " + to_string(wrong) + " words!" : "") << endl;
+	cout << fixed << setprecision(3);
+	cout << left << setw(12) << "import" << right << setw(10) << "seconds" << setw(10) << "MB/s" << endl;
+	cout << left << setw(12) << "one by one" << right << setw(10) << oneSeconds << setw(10) << setprecision(1) << bytes / oneSeconds / 1e6 << endl;
+	cout << left << setw(12) << "manifest" << right << setw(10) << setprecision(3) << pipedSeconds << setw(10) << setprecision(1) << bytes / pipedSeconds / 1e6 << endl;
+	const char* names[STAGE_COUNT] = { "read", "parse", "insert" };
+	cout << left << setw(12) << "stage" << right << setw(10) << "blocks" << setw(10) << "busy s" << setw(12) << "starved s"
+		<< setw(12) << "blocked s" << setw(10) << "MB/s" << endl;
+	for (unsigned int s = 0; s < STAGE_COUNT; s++) {
+		const StageStats& stage = stats.stages[s];
+		cout << left << setw(12) << names[s] << right << setw(10) << stage.blocks << setprecision(3) << setw(10) << stage.busySeconds
+			<< setw(12) << stage.starvedSeconds << setw(12) << stage.blockedSeconds << setprecision(1)
+			<< setw(10) << stage.bytes / max(stage.busySeconds, 1e-9) / 1e6 << endl;
+	}
+	cout << stats.blocks << " blocks hold " << stats.bufferBytes / 1e6 << " MB of buffers" << endl;
+}
+
+//mean nanoseconds per lookup over the queries, best of three passes; found counts the hits
+template<class Find>
+double timeFinds(const vector<string>& queries, const Find& find, unsigned int &found) {
+	double best = 0;
+	for (unsigned int pass = 0; pass < 3; pass++) {
+		found = 0;
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		for (const string& q : queries) found += find(q);
+		double ns = nanosSince(start) / max(queries.size(), (size_t)1);
+		best = pass == 0 ? ns : min(best, ns);
+	}
+	return best;
+}
+
+//builds a frozen copy of a generated multilingual table and compares size and lookup cost
+//with the mutable table; every hit is checked against the mutable table's answer
+void benchFrozen(unsigned int keys) {
+	DictionarySpec spec;
+	spec.keys = keys;
+	spec.languages = 3;
+	spec.shared = 0.3;
+	spec.meaningSkew = 1.0;
+	spec.seed = 11;
+	vector<string> words;
+	vector<string> files = writeSuiteDictionaries(spec, "bench_frozen_", words);
+	HashTable table(1000);
+	streambuf* saved = cout.rdbuf(nullptr);
+	for (const string& f : files) table.import(f);
+	cout.rdbuf(saved);
+	cout.clear();
+	for (const string& f : files) remove(f.c_str());
+	FrozenTable frozen;
+	if (!frozen.build(table)) return;
+
+	//every entry must come back with the same word, languages and meanings
+	unsigned int wrong = 0;
+	FrozenEntry entry;
+	for (const string& w : words) {
+		int comparisons;
+		EntryView view = table.findReadOnly(w, comparisons);
+		bool same = frozen.find(w, entry) && view.found() && entry.word.size() == view.word().length
+			&& entry.languages.size() == view.translationCount();
+		for (unsigned int t = 0, m = 0; same && t < view.translationCount(); t++) {
+			TranslationView translation = view.translation(t);
+			same = frozen.languageName(entry.languages[t]) == translation.language();
+			for (unsigned int i = 0; same && i < translation.meaningCount(); i++, m++) {
+				TextView a = translation.meaning(i), b = entry.meanings[m];
+				same = m < entry.meaningEnds[t] && a.length == b.length && memcmp(a.data, b.data, a.length) == 0;
+			}
+		}
+		wrong += !same;
+	}
+
+	MemoryStats memory = table.getMemoryStats();
+	FrozenStats stats = frozen.getStats();
+	double mutableBits = 8.0 * (memory.tableBytes + memory.poolBytes + memory.recordBytes) / words.size();
+	double frozenBits = 8.0 * (stats.hashBytes + stats.rankBytes + stats.blockBytes) / words.size();
+	vector<string> hits(words);
+	WordGenerator gen(spec.seed);
+	for (size_t i = hits.size() - 1; i > 0; i--) swap(hits[i], hits[gen.next() % (i + 1)]);
+	vector<string> misses = makeLanguageWords(min((size_t)keys, words.size()), spec.languages, spec.seed + 1, words);
+
+	unsigned int found;
+	cout << spec.languages << " languages, " << keys << " words each, " << words.size() << " entries; frozen in "
+		<< fixed << setprecision(1) << stats.buildSeconds * 1000 << " ms with " << stats.pilotBits << "-bit pilots"
+		<< (wrong ? ", answers differ for " + to_string(wrong) + " words!" : "") << endl;
+	cout << left << setw(10) << "table" << right << setw(14) << "bits/entry" << setw(12) << "index" << setw(10) << "hit ns"
+		<< setw(10) << "miss ns" << endl;
+	double hitNs = timeFinds(hits, [&](const string& w) { int c; return table.findReadOnly(w, c).found(); }, found);
+	double missNs = timeFinds(misses, [&](const string& w) { int c; return table.findReadOnly(w, c).found(); }, found);
+	cout << left << setw(10) << "mutable" << right << setw(14) << mutableBits
+		<< setw(12) << 8.0 * memory.tableBytes / words.size() << setw(10) << hitNs << setw(10) << missNs << endl;
+	hitNs = timeFinds(hits, [&](const string& w) { return frozen.find(w, entry); }, found);
+	missNs = timeFinds(misses, [&](const string& w) { return frozen.find(w, entry); }, found);
+	cout << left << setw(10) << "frozen" << right << setw(14) << frozenBits
+		<< setw(12) << 8.0 * (stats.hashBytes + stats.rankBytes) / words.size() << setw(10) << hitNs << setw(10) << missNs << endl;
+}
+
+//gives words hundreds of meanings, a quarter of them repeated in another case, added eight
+//to an insert and then merged from a second file of the same language; the cost per meaning
+//stays flat as the meanings per word grow when checking a new one does not scan the others
+void benchMeanings(unsigned int total) {
+	cout << left << setw(10) << "meanings" << right << setw(8) << "words" << setw(14) << "insert ns" << setw(14) << "merge ns"
+		<< setw(10) << "kept" << endl;
+	for (unsigned int perWord = 50; perWord <= 800; perWord *= 2) {
+		unsigned int words = max(total / perWord, 1u);
+		WordGenerator gen(perWord);
+		vector<string> keys = makeWords(words, perWord, vector<string>());
+		//the meanings of each word, every fourth one a case variant of an earlier one
+		vector<vector<string>> meanings(words);
+		for (vector<string>& list : meanings) {
+			for (unsigned int m = 0; m < perWord; m++) {
+				string meaning = m % 4 == 3 ? list[gen.next() % m] : gen.word();
+				if (m % 4 == 3) meaning[0] = toupper(meaning[0]);
+				list.push_back(meaning);
+			}
+		}
+
+		HashTable table(2 * words);
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		for (unsigned int w = 0; w < words; w++) {
+			for (unsigned int m = 0; m < perWord; m += 8) {
+				string batch;
+				for (unsigned int i = m; i < min(m + 8, perWord); i++) batch += (i > m ? ";" : "") + meanings[w][i];
+				table.insert(keys[w], batch, "German");
+			}
+		}
+		double insertNs = nanosSince(start) / ((double)words * perWord);
+
+		//the second file repeats half of each word's meanings and brings as many new ones
+		string path = "bench_meanings.txt";
+		{
+			ofstream file(path);
+			file << "German\n";
+			for (unsigned int w = 0; w < words; w++) {
+				file << keys[w] << ':';
+				for (unsigned int m = 0; m < perWord; m++) {
+					file << (m ? ";" : "") << (m % 2 ? meanings[w][m] : gen.word());
+				}
+				file << '\n';
+			}
+		}
+		streambuf* saved = cout.rdbuf(nullptr);
+		start = chrono::steady_clock::now();
+		table.import(path);
+		double mergeNs = nanosSince(start) / ((double)words * perWord);
+		cout.rdbuf(saved);
+		cout.clear();
+		remove(path.c_str());
+
+		int comparisons;
+		EntryView entry = table.findReadOnly(keys[0], comparisons);
+		cout << left << setw(10) << perWord << right << setw(8) << words << fixed << setprecision(1) << setw(14) << insertNs
+			<< setw(14) << mergeNs << setw(10) << entry.translation(0).meaningCount() << endl;
+	}
+}
+
+void usage()
+{
+	cout<<"bench probe [keys]                  : Group probing kernels vs. quadratic probing across load factors."<<endl;
+	cout<<"bench import [lines] [threads]      : Sequential import vs. parallel import on 1 to threads threads."<<endl;
+	cout<<"bench memory [keys]                 : Bytes per entry spent on slots, string pool and records."<<endl;
+	cout<<"bench export [keys] [threads]       : Six languages exported one by one vs. together on 1 to threads threads."<<endl;
+	cout<<"bench pipeline [keys]               : Language files imported one by one vs. through a manifest, with stage timings."<<endl;
+	cout<<"bench frozen [keys]                 : Bits per entry and lookup cost of the frozen perfect-hash table vs. the mutable one."<<endl;
+	cout<<"bench meanings [meanings]           : Cost per meaning added and merged as words reach 50 to 800 meanings."<<endl;
+	cout<<"bench batch [keys]                  : Single lookups vs. findBatch on batches of 1 to 1024 words."<<endl;
+	cout<<"bench reverse [keys]                : Reverse lookups with the index vs. forward lookups and a scan."<<endl;
+	cout<<"bench complete [keys]               : Top-10 completions from the prefix trie vs. a scan, by prefix length."<<endl;
+	cout<<"bench churn [keys]                  : Probe chains, miss cost and memory under deletions, with and without compaction."<<endl;
+	cout<<"bench hash [dictionary|keys]        : Hash and slot reduction policies: speed, collisions, probe lengths (en-de.txt)."<<endl;
+	cout<<"bench fuzzy [dictionary|keys]       : Suggestions for misspelled words from the trie vs. a scan (en-de.txt)."<<endl;
+	cout<<"bench concurrent [keys] [threads]   : Mixed lookups and changes, Left-Right table vs. one mutex."<<endl;
+	cout<<"bench stress [keys] [threads]       : Readers check answers while writers change the table."<<endl;
+	cout<<"bench generate [keys] [languages] [shared] [skew] [seed] [prefix]"<<endl;
+	cout<<"                                    : Writes one dictionary file per language (3, 0.3, 1.0, 1, gen_)."<<endl;
+	cout<<"bench suite [keys] [languages] [shared] [skew] [seed] [query skew] [results]"<<endl;
+	cout<<"                                    : Import, hit and miss latency percentiles, inserts, churn and memory"<<endl;
+	cout<<"                                      on generated files, written as JSON (0.99, bench_suite.json)."<<endl;
+}
+//======================================================
+int main(int argc, char** args)
+{
+	string which = argc > 1 ? args[1] : "";
+	unsigned int keys = argc > 2 && isdigit(args[2][0]) ? stoul(args[2]) : 200000;
+
+	if(which == "probe")		benchProbe(keys);
+	else if(which == "memory")	benchMemory(keys);
+	else if(which == "batch")	benchBatch(keys);
+	else if(which == "reverse")	benchReverse(keys);
+	else if(which == "complete")	benchComplete(keys);
+	else if(which == "churn")	benchChurn(keys);
+	else if(which == "frozen")	benchFrozen(keys);
+	else if(which == "meanings")	benchMeanings(keys);
+	else if(which == "pipeline")	benchPipeline(keys);
+	else if(which == "hash")	benchHash(argc > 2 ? args[2] : "en-de.txt");
+	else if(which == "fuzzy")	benchFuzzy(argc > 2 ? args[2] : "en-de.txt");
+	else if(which == "import")	benchImport(keys, argc > 3 ? stoul(args[3]) : max(thread::hardware_concurrency(), 1u));
+	else if(which == "export")	benchExport(keys, argc > 3 ? stoul(args[3]) : max(thread::hardware_concurrency(), 1u));
+	else if(which == "concurrent")	benchConcurrent(keys, argc > 3 ? stoul(args[3]) : max(thread::hardware_concurrency(), 1u));
+	else if(which == "generate" || which == "suite") {
+		DictionarySpec spec;
+		spec.keys = keys;
+		spec.languages = argc > 3 ? stoul(args[3]) : 3;
+		spec.shared = argc > 4 ? stod(args[4]) : 0.3;
+		spec.meaningSkew = argc > 5 ? stod(args[5]) : 1.0;
+		spec.seed = argc > 6 ? stoul(args[6]) : 1;
+		if (which == "generate") benchGenerate(spec, argc > 7 ? args[7] : "gen_");
+		else benchSuite(spec, argc > 7 ? stod(args[7]) : 0.99, argc > 8 ? args[8] : "bench_suite.json");
+	}
+	else if(which == "stress")	benchStress(keys, argc > 3 ? stoul(args[3]) : max(thread::hardware_concurrency(), 2u));
+	else usage();
+	return 0;
+}
@@ -0,0 +1,124 @@
+#include "concurrent.h"
+#include <thread>
+#include <functional>
+using namespace std;
+
+//constructor, both copies start out empty and readers are sent to the left one
+ConcurrentTable::ConcurrentTable(int capacity, float maxLoadFactor) : left(capacity, maxLoadFactor), right(capacity, maxLoadFactor) {
+	tables[0] = &left;
+	tables[1] = &right;
+	leftRight.store(0);
+	versionIndex.store(0);
+	for (unsigned int v = 0; v < 2; v++) {
+		for (unsigned int i = 0; i < READER_STRIPES; i++) {
+			indicators[v][i].readers.store(0);
+		}
+	}
+}
+
+//registers a reader on the current version; returns the version and the stripe it used
+unsigned int ConcurrentTable::arrive(unsigned int &stripe) {
+	//each thread keeps to one stripe, so readers on different threads rarely touch the same line
+	static thread_local unsigned int mine = hash<thread::id>()(this_thread::get_id()) % READER_STRIPES;
+	stripe = mine;
+	unsigned int version = versionIndex.load();
+	indicators[version][stripe].readers.fetch_add(1);
+	return version;
+}
+
+//unregisters a reader from the version it arrived at
+void ConcurrentTable::depart(unsigned int version, unsigned int stripe) {
+	indicators[version][stripe].readers.fetch_sub(1);
+}
+
+//spins until no reader is registered on a version
+void ConcurrentTable::waitForReaders(unsigned int version) {
+	for (unsigned int i = 0; i < READER_STRIPES; i++) {
+		while (indicators[version][i].readers.load() != 0) {
+			this_thread::yield();
+		}
+	}
+}
+
+//applies a change to both copies without ever touching the copy readers are on; returns what
+//the change returned for the first copy (the second copy holds the same words, so it agrees)
+template<class Change>
+int ConcurrentTable::write(const Change& change) {
+	lock_guard<mutex> lock(writer);
+	int reading = leftRight.load();
+	//change the copy no reader is sent to, then send new readers there
+	int result = change(*tables[1 - reading]);
+	leftRight.store(1 - reading);
+	//readers that arrived before the switch may still be on the old copy. Toggle the version
+	//new readers register on, and wait for both versions to drain so none of them is left.
+	unsigned int version = versionIndex.load();
+	waitForReaders(1 - version);
+	versionIndex.store(1 - version);
+	waitForReaders(version);
+	//nobody reads the old copy now, bring it up to date
+	change(*tables[reading]);
+	return result;
+}
+
+//loads a dictionary file into both copies
+void ConcurrentTable::import(string path) {
+	write([&](HashTable& table) {
+		table.import(path);
+		return 0;
+	});
+}
+
+//returns true if the word is in the dictionary; never blocks
+bool ConcurrentTable::contains(const string& word) {
+	unsigned int stripe;
+	unsigned int version = arrive(stripe);
+	bool found = tables[leftRight.load()]->locateWord(word) >= 0;
+	depart(version, stripe);
+	return found;
+}
+
+//copies a word's meanings in a language; returns false if the word or the translation is missing. Never blocks.
+bool ConcurrentTable::getMeanings(const string& word, const string& language, vector<string>& meanings) {
+	unsigned int stripe;
+	unsigned int version = arrive(stripe);
+	bool found = tables[leftRight.load()]->getMeanings(word, language, meanings);
+	depart(version, stripe);
+	return found;
+}
+
+//adds meanings of a word in a language
+EditResult ConcurrentTable::insert(const string& word, const string& meanings, const string& language) {
+	return (EditResult)write([&](HashTable& table) {
+		return (int)table.insert(word, meanings, language);
+	});
+}
+
+//deletes a word entirely
+EditResult ConcurrentTable::delWord(const string& word) {
+	return (EditResult)write([&](HashTable& table) {
+		return (int)table.delWord(word);
+	});
+}
+
+//deletes a word's translation in a language
+EditResult ConcurrentTable::delTranslation(const string& word, const string& language) {
+	return (EditResult)write([&](HashTable& table) {
+		return (int)table.delTranslation(word, language);
+	});
+}
+
+//deletes one meaning of a word's translation
+EditResult ConcurrentTable::delMeaning(const string& word, const string& meaning, const string& language) {
+	return (EditResult)write([&](HashTable& table) {
+		return (int)table.delMeaning(word, meaning, language);
+	});
+}
+
+//returns the number of words; never blocks
+unsigned int ConcurrentTable::getSize() {
+	unsigned int stripe;
+	unsigned int version = arrive(stripe);
+	unsigned int size = tables[leftRight.load()]->getSize();
+	depart(version, stripe);
+	return size;
+}
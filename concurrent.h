@@ -0,0 +1,50 @@
+#ifndef _CONCURRENT
+#define _CONCURRENT
+#include <string>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include "hashtable.h"
+using namespace std;
+
+//reader counters per version are striped over this many cache lines
+const unsigned int READER_STRIPES = 16;
+
+//one stripe of a reader indicator, alone on its cache line so readers on different cores do not share it
+struct ReaderStripe
+{
+	atomic<long> readers;
+	char padding[64 - sizeof(atomic<long>)];
+};
+
+//dictionary that any number of threads may read while others change it (Left-Right).
+//It keeps two copies of the table: readers run on one without taking a lock, a writer
+//changes the other, points new readers at it, waits for the last reader of the old copy
+//to leave, then repeats the change there. Readers never wait; writers run one at a time.
+class ConcurrentTable
+{
+	private:
+		HashTable left;
+		HashTable right;
+		HashTable *tables[2];
+		mutex writer;							// Serializes writers
+		atomic<int> leftRight;					// Copy readers are sent to
+		atomic<int> versionIndex;				// Reader indicator new readers arrive at
+		ReaderStripe indicators[2][READER_STRIPES];
+		unsigned int arrive(unsigned int &stripe);
+		void depart(unsigned int version, unsigned int stripe);
+		void waitForReaders(unsigned int version);
+		template<class Change>
+		int write(const Change& change);
+	public:
+		ConcurrentTable(int capacity, float maxLoadFactor = 0.8);
+		void import(string path);
+		bool contains(const string& word);
+		bool getMeanings(const string& word, const string& language, vector<string>& meanings);
+		EditResult insert(const string& word, const string& meanings, const string& language);
+		EditResult delWord(const string& word);
+		EditResult delTranslation(const string& word, const string& language);
+		EditResult delMeaning(const string& word, const string& meaning, const string& language);
+		unsigned int getSize();
+};
+#endif
@@ -0,0 +1,411 @@
+#include "frozen.h"
+#include "unicode.h"
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <climits>
+using namespace std;
+
+//share of the keys sent to the dense buckets, and share of the buckets they are; PTHash's
+//skew puts the big buckets first, while there are still free positions for them
+const unsigned int FROZEN_DENSE_KEYS = 2576980377u;	// 0.6 * 2^32
+const unsigned int FROZEN_DENSE_BUCKETS = 30;			// percent
+
+//murmur3's 64-bit finalizer: every output bit depends on every input bit
+static inline unsigned long mix64(unsigned long x) {
+	x ^= x >> 33;
+	x *= 0xff51afd7ed558ccdUL;
+	x ^= x >> 33;
+	x *= 0xc4ceb9fe1a85ec53UL;
+	x ^= x >> 33;
+	return x;
+}
+
+//64-bit hash of a case-folded key, mixed unless the hash policy avalanches on its own
+static inline unsigned long frozenHash(const char *data, size_t length) {
+	unsigned long hash = KeyHash::hash(data, length);
+	return KeyHash::AVALANCHES ? hash : mix64(hash);
+}
+
+//bits of the hash kept next to the rank, independent of the ones that pick the position
+static inline unsigned long fingerprint(unsigned long hash) {
+	return (hash >> 16) & ((1UL << FROZEN_FINGERPRINT_BITS) - 1);
+}
+
+//bits needed to store every value up to v
+static unsigned int bitsFor(unsigned long v) {
+	return v == 0 ? 0 : 64 - __builtin_clzl(v);
+}
+
+//appends a number 7 bits at a time, the high bit of each byte marking that more follow
+static void putVarint(PodArray<char>& out, unsigned long v) {
+	while (v >= 0x80) {
+		out.push_back((char)(v | 0x80));
+		v >>= 7;
+	}
+	out.push_back((char)v);
+}
+
+//reads a number written by putVarint and moves past it
+static inline unsigned long readVarint(const char *&p) {
+	unsigned long v = 0;
+	unsigned int shift = 0;
+	while ((unsigned char)*p >= 0x80) {
+		v |= (unsigned long)(*p++ & 0x7F) << shift;
+		shift += 7;
+	}
+	return v | ((unsigned long)(unsigned char)*p++ << shift);
+}
+
+//constructor, an empty frozen table finds nothing
+FrozenTable::FrozenTable() {
+	this->count = 0;
+	this->positions = 0;
+	this->bucketCount = 0;
+	this->buildSeconds = 0;
+}
+
+//returns the bucket of a key hash: the low half decides between the dense and the sparse
+//buckets, the high half picks one of them
+unsigned int FrozenTable::bucketOf(unsigned long hash) const {
+	unsigned int dense = (unsigned long)bucketCount * FROZEN_DENSE_BUCKETS / 100;
+	unsigned long high = hash >> 32;
+	if (dense == 0) {
+		return (high * bucketCount) >> 32;
+	}
+	if ((unsigned int)hash < FROZEN_DENSE_KEYS) {
+		return (high * dense) >> 32;
+	}
+	return dense + ((high * (bucketCount - dense)) >> 32);
+}
+
+//returns the position a pilot sends a key hash to. The pilot is mixed in before the
+//reduction, so every pilot gives its bucket's keys an independent set of positions.
+unsigned int FrozenTable::positionOf(unsigned long hash, unsigned long pilot) const {
+	unsigned long mixed = mix64(hash ^ mix64(pilot + 1));
+	return (unsigned int)(((unsigned __int128)mixed * positions) >> 64);
+}
+
+//finds a pilot for every bucket, largest bucket first, trying 0, 1, 2... until all of its keys
+//land on free positions that differ from each other; then maps the positions past count onto
+//the free ones below it. position[i] is where key i ends up. Returns false if two keys share
+//a hash, which no pilot can separate.
+bool FrozenTable::placeBuckets(const vector<unsigned long>& hashes, vector<unsigned int>& position) {
+	vector<unsigned long> check(hashes);
+	sort(check.begin(), check.end());
+	if (adjacent_find(check.begin(), check.end()) != check.end()) {
+		return false;
+	}
+	//keys grouped by bucket
+	vector<unsigned int> bucketStart(bucketCount + 1, 0);
+	for (unsigned long hash : hashes) {
+		bucketStart[bucketOf(hash) + 1]++;
+	}
+	unsigned int largest = 0;
+	for (unsigned int b = 0; b < bucketCount; b++) {
+		largest = max(largest, bucketStart[b + 1]);
+		bucketStart[b + 1] += bucketStart[b];
+	}
+	vector<unsigned int> keys(hashes.size());
+	vector<unsigned int> fill(bucketStart.begin(), bucketStart.end() - 1);
+	for (unsigned int i = 0; i < hashes.size(); i++) {
+		keys[fill[bucketOf(hashes[i])]++] = i;
+	}
+	//buckets by size, largest first
+	vector<unsigned int> sizeStart(largest + 2, 0);
+	for (unsigned int b = 0; b < bucketCount; b++) {
+		sizeStart[largest - (bucketStart[b + 1] - bucketStart[b]) + 1]++;
+	}
+	for (unsigned int s = 0; s <= largest; s++) {
+		sizeStart[s + 1] += sizeStart[s];
+	}
+	vector<unsigned int> order(bucketCount);
+	for (unsigned int b = 0; b < bucketCount; b++) {
+		order[sizeStart[largest - (bucketStart[b + 1] - bucketStart[b])]++] = b;
+	}
+
+	vector<unsigned long> taken((positions + 63) / 64, 0);
+	vector<unsigned long> pilotOf(bucketCount, 0);
+	vector<unsigned int> trial;
+	position.assign(hashes.size(), 0);
+	unsigned long maxPilot = 0;
+	for (unsigned int b : order) {
+		unsigned int first = bucketStart[b], last = bucketStart[b + 1];
+		if (first == last) {
+			break;
+		}
+		for (unsigned long pilot = 0; ; pilot++) {
+			trial.clear();
+			bool fits = true;
+			for (unsigned int k = first; k < last && fits; k++) {
+				unsigned int p = positionOf(hashes[keys[k]], pilot);
+				fits = (taken[p >> 6] >> (p & 63) & 1) == 0 && std::find(trial.begin(), trial.end(), p) == trial.end();
+				trial.push_back(p);
+			}
+			if (fits) {
+				for (unsigned int k = first; k < last; k++) {
+					unsigned int p = trial[k - first];
+					taken[p >> 6] |= 1UL << (p & 63);
+					position[keys[k]] = p;
+				}
+				pilotOf[b] = pilot;
+				maxPilot = max(maxPilot, pilot);
+				break;
+			}
+		}
+	}
+	pilots.assign(bucketCount, bitsFor(maxPilot));
+	for (unsigned int b = 0; b < bucketCount; b++) {
+		pilots.set(b, pilotOf[b]);
+	}
+	//positions past count, in order, take the free positions below it, in order
+	overflow.assign(positions - count, bitsFor(count - 1));
+	unsigned int nextFree = 0;
+	for (unsigned int p = count; p < positions; p++) {
+		if ((taken[p >> 6] >> (p & 63) & 1) == 0) {
+			continue;
+		}
+		while (taken[nextFree >> 6] >> (nextFree & 63) & 1) {
+			nextFree++;
+		}
+		overflow.set(p - count, nextFree++);
+	}
+	for (unsigned int& p : position) {
+		if (p >= count) {
+			p = overflow.get(p - count);
+		}
+	}
+	return true;
+}
+
+//writes the entries, in sorted order, into blocks of FROZEN_BLOCK. A block starts with the
+//size of its key section; each key is the length it shares with the key before it (0 for
+//the first), the rest of it, and the size of its record. The records follow the keys: the
+//word (0 if it is the key itself, else its length + 1, then its bytes), then the translations,
+//each a language id and its meanings. Returns false if the blocks outgrow 32-bit offsets.
+bool FrozenTable::encodeBlocks(const EntryStore& store, const vector<unsigned int>& sorted) {
+	blockOffsets.resize((count + FROZEN_BLOCK - 1) / FROZEN_BLOCK);
+	PodArray<char> keySection, records;
+	for (unsigned int first = 0; first < count; first += FROZEN_BLOCK) {
+		if (blocks.size() > UINT_MAX) {
+			return false;
+		}
+		blockOffsets[first / FROZEN_BLOCK] = blocks.size();
+		keySection.resize(0);
+		records.resize(0);
+		const char *previous = nullptr;
+		unsigned int previousLength = 0;
+		for (unsigned int r = first; r < count && r < first + FROZEN_BLOCK; r++) {
+			const Entry& entry = store.entry(sorted[r]);
+			const char *key = store.text(entry.key);
+			unsigned int shared = 0;
+			while (shared < previousLength && shared < entry.key.length && previous[shared] == key[shared]) {
+				shared++;
+			}
+			putVarint(keySection, shared);
+			putVarint(keySection, entry.key.length - shared);
+			keySection.append(key + shared, entry.key.length - shared);
+			previous = key;
+			previousLength = entry.key.length;
+
+			size_t start = records.size();
+			const char *word = store.text(entry.word);
+			bool same = entry.word.length == entry.key.length && memcmp(word, key, entry.key.length) == 0;
+			putVarint(records, same ? 0 : entry.word.length + 1);
+			if (!same) {
+				records.append(word, entry.word.length);
+			}
+			putVarint(records, entry.translationCount);
+			for (unsigned int t = 0; t < entry.translationCount; t++) {
+				const Translation& translation = store.translation(entry, t);
+				putVarint(records, translation.language);
+				putVarint(records, translation.meaningCount);
+				for (unsigned int m = 0; m < translation.meaningCount; m++) {
+					StrRef meaning = store.meaning(translation, m);
+					putVarint(records, meaning.length);
+					records.append(store.text(meaning), meaning.length);
+				}
+			}
+			putVarint(keySection, records.size() - start);
+		}
+		putVarint(blocks, keySection.size());
+		blocks.append(keySection.data(), keySection.size());
+		blocks.append(records.data(), records.size());
+	}
+	blocks.shrink();
+	return blocks.size() <= UINT_MAX;
+}
+
+//replaces this table with a frozen copy of the live entries of a table. Returns false, and
+//is left empty, if the keys cannot be told apart by their hashes or the data is too large.
+bool FrozenTable::build(const HashTable& table) {
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	clear();
+	const EntryStore& store = table.store;
+	for (unsigned int l = 0; l < store.languageCount(); l++) {
+		languages.push_back(store.languageName(l));
+	}
+	//byte order of the keys, so neighbours share prefixes. The first 8 bytes of each key, read
+	//big-endian, settle most comparisons without going back to the pool.
+	vector<pair<unsigned long, unsigned int> > order;
+	order.reserve(table.size);
+	for (unsigned int i = 0; i < store.size(); i++) {
+		const Entry& entry = store.entry(i);
+		if (!entry.deleted) {
+			unsigned long prefix = 0;
+			const char *key = store.text(entry.key);
+			for (unsigned int b = 0; b < 8; b++) {
+				prefix = prefix << 8 | (b < entry.key.length ? (unsigned char)key[b] : 0);
+			}
+			order.push_back(make_pair(prefix, i));
+		}
+	}
+	sort(order.begin(), order.end(), [&store](const pair<unsigned long, unsigned int>& a, const pair<unsigned long, unsigned int>& b) {
+		if (a.first != b.first) {
+			return a.first < b.first;
+		}
+		const Entry& x = store.entry(a.second);
+		const Entry& y = store.entry(b.second);
+		int difference = memcmp(store.text(x.key), store.text(y.key), min(x.key.length, y.key.length));
+		return difference != 0 ? difference < 0 : x.key.length < y.key.length;
+	});
+	vector<unsigned int> sorted(order.size());
+	for (size_t r = 0; r < order.size(); r++) {
+		sorted[r] = order[r].second;
+	}
+	count = sorted.size();
+	if (count == 0) {
+		buildSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+		return true;
+	}
+	positions = max(count, (unsigned int)(count / FROZEN_FILL));
+	bucketCount = (count + FROZEN_BUCKET_SIZE - 1) / FROZEN_BUCKET_SIZE;
+
+	//key i is the key of rank i
+	vector<unsigned long> hashes(count);
+	for (unsigned int r = 0; r < count; r++) {
+		const Entry& entry = store.entry(sorted[r]);
+		hashes[r] = frozenHash(store.text(entry.key), entry.key.length);
+	}
+	vector<unsigned int> position;
+	if (!placeBuckets(hashes, position)) {
+		cout << "Could not freeze the dictionary: two words share a hash." << '\n';
+		clear();
+		return false;
+	}
+	ranks.assign(count, bitsFor(count - 1) + FROZEN_FINGERPRINT_BITS);
+	for (unsigned int r = 0; r < count; r++) {
+		ranks.set(position[r], (unsigned long)r << FROZEN_FINGERPRINT_BITS | fingerprint(hashes[r]));
+	}
+	if (!encodeBlocks(store, sorted)) {
+		cout << "Could not freeze the dictionary: it holds more than 4 GB of text." << '\n';
+		clear();
+		return false;
+	}
+	buildSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	return true;
+}
+
+//looks a word up; on a hit fills entry with its word and translations and returns true.
+//It changes nothing, so any number of threads may look up at once.
+bool FrozenTable::find(const string& word, FrozenEntry& entry) const {
+	entry.found = false;
+	entry.word.clear();
+	entry.languages.clear();
+	entry.meaningEnds.clear();
+	entry.meanings.clear();
+	if (count == 0 || word.empty()) {
+		return false;
+	}
+	static thread_local string key, decoded;
+	foldCase(word, key);
+	unsigned long hash = frozenHash(key.data(), key.size());
+	unsigned int position = positionOf(hash, pilots.get(bucketOf(hash)));
+	if (position >= count) {
+		position = overflow.get(position - count);
+	}
+	unsigned long packed = ranks.get(position);
+	if ((packed & ((1UL << FROZEN_FINGERPRINT_BITS) - 1)) != fingerprint(hash)) {
+		return false;
+	}
+	unsigned long rank = packed >> FROZEN_FINGERPRINT_BITS;
+
+	//walk the keys of the block up to the rank, adding up the records passed
+	const char *p = blocks.data() + blockOffsets[rank / FROZEN_BLOCK];
+	unsigned long keyBytes = readVarint(p);
+	const char *record = p + keyBytes;
+	unsigned long recordLength = 0;
+	decoded.clear();
+	for (unsigned int i = 0; i <= rank % FROZEN_BLOCK; i++) {
+		record += recordLength;
+		unsigned long shared = readVarint(p);
+		unsigned long suffix = readVarint(p);
+		decoded.resize(shared);
+		decoded.append(p, suffix);
+		p += suffix;
+		recordLength = readVarint(p);
+	}
+	if (decoded != key) {
+		return false;
+	}
+
+	unsigned long wordLength = readVarint(record);
+	if (wordLength == 0) {
+		entry.word = decoded;
+	}
+	else {
+		entry.word.assign(record, wordLength - 1);
+		record += wordLength - 1;
+	}
+	unsigned long translations = readVarint(record);
+	for (unsigned long t = 0; t < translations; t++) {
+		entry.languages.push_back(readVarint(record));
+		unsigned long meanings = readVarint(record);
+		for (unsigned long m = 0; m < meanings; m++) {
+			TextView meaning;
+			meaning.length = readVarint(record);
+			meaning.data = record;
+			record += meaning.length;
+			entry.meanings.push_back(meaning);
+		}
+		entry.meaningEnds.push_back(entry.meanings.size());
+	}
+	entry.found = true;
+	return true;
+}
+
+//returns the display name of a language id
+const string& FrozenTable::languageName(unsigned short language) const {
+	return languages[language];
+}
+
+//returns the number of words
+unsigned int FrozenTable::size() const {
+	return count;
+}
+
+//returns the bytes each part takes
+FrozenStats FrozenTable::getStats() const {
+	FrozenStats stats;
+	stats.keys = count;
+	stats.hashBytes = pilots.bytes() + overflow.bytes();
+	stats.rankBytes = ranks.bytes() + blockOffsets.bytes();
+	stats.blockBytes = blocks.bytes();
+	stats.pilotBits = pilots.bits();
+	stats.buildSeconds = buildSeconds;
+	return stats;
+}
+
+//empties the table
+void FrozenTable::clear() {
+	count = 0;
+	positions = 0;
+	bucketCount = 0;
+	pilots.clear();
+	overflow.clear();
+	ranks.clear();
+	blockOffsets.clear();
+	blocks.clear();
+	languages.clear();
+	buildSeconds = 0;
+}
@@ -0,0 +1,129 @@
+#ifndef _FROZEN
+#define _FROZEN
+#include <string>
+#include <vector>
+#include "store.h"
+#include "hashtable.h"
+using namespace std;
+
+//keys front-coded together; a hit decodes at most this many keys of its block
+const unsigned int FROZEN_BLOCK = 8;
+//average keys per bucket of the perfect hash; larger buckets need fewer pilots but longer searches
+const unsigned int FROZEN_BUCKET_SIZE = 4;
+//share of the positions the perfect hash fills before free ones are mapped back (PTHash's alpha)
+const double FROZEN_FILL = 0.99;
+//bits of the key hash kept next to each rank, so most misses end without decoding a block
+const unsigned int FROZEN_FINGERPRINT_BITS = 8;
+
+//fixed-width unsigned integers packed back to back into 64-bit words; reading one touches
+//a single word, or two neighbouring ones when it straddles them
+class PackedArray
+{
+	private:
+		PodArray<unsigned long> words;		// one spare word at the end, so reads never check the bounds
+		unsigned int width;					// bits per value, 0 to 64
+		unsigned long mask;
+		PackedArray(const PackedArray&);
+		PackedArray& operator=(const PackedArray&);
+	public:
+		PackedArray() : width(0), mask(0) {}
+		//makes room for count values of width bits, all zero
+		void assign(size_t count, unsigned int width) {
+			this->width = width;
+			mask = width == 64 ? ~0UL : (1UL << width) - 1;
+			size_t n = ((unsigned long)count * width + 63) / 64 + 1;
+			words.resize(n);
+			memset(&words[0], 0, n * sizeof(unsigned long));
+		}
+		unsigned long get(size_t i) const {
+			unsigned long bit = (unsigned long)i * width;
+			size_t w = bit >> 6;
+			unsigned int shift = bit & 63;
+			unsigned long value = words[w] >> shift;
+			if (shift + width > 64) {
+				value |= words[w + 1] << (64 - shift);
+			}
+			return value & mask;
+		}
+		void set(size_t i, unsigned long value) {
+			unsigned long bit = (unsigned long)i * width;
+			size_t w = bit >> 6;
+			unsigned int shift = bit & 63;
+			value &= mask;
+			words[w] = (words[w] & ~(mask << shift)) | (value << shift);
+			if (shift + width > 64) {
+				unsigned int high = 64 - shift;
+				words[w + 1] = (words[w + 1] & ~(mask >> high)) | (value >> high);
+			}
+		}
+		unsigned int bits() const {
+			return width;
+		}
+		unsigned long bytes() const {
+			return words.bytes();
+		}
+		void clear() {
+			words.clear();
+			width = 0;
+			mask = 0;
+		}
+};
+
+//a word found in a frozen dictionary; the meanings point into the table and stay valid while it lives
+struct FrozenEntry
+{
+	bool found;
+	string word;							// as it was first inserted
+	vector<unsigned short> languages;		// language id of each translation
+	vector<unsigned int> meaningEnds;		// end of each translation's meanings in meanings
+	vector<TextView> meanings;
+};
+
+//bytes a frozen dictionary takes, by part
+struct FrozenStats
+{
+	unsigned int keys;
+	unsigned long hashBytes;				// pilots and the map of the overflow positions
+	unsigned long rankBytes;				// rank and fingerprint per position, offset per block
+	unsigned long blockBytes;				// front-coded keys, words, translations and meanings
+	unsigned int pilotBits;					// width of a pilot
+	double buildSeconds;
+};
+
+//read-only dictionary built from a table for read-mostly deployments. Keys go through a
+//minimal perfect hash (PTHash: the key hash picks a bucket, and each bucket stores a small
+//pilot that moves its keys to free positions), so there are no empty slots and no stored
+//hashes. The position holds the key's rank in sorted order next to a fingerprint; keys are
+//front-coded in blocks of FROZEN_BLOCK in that order, and after the keys of a block come
+//their words and translations as varint-prefixed strings. A lookup reads a pilot and a
+//rank, then the keys of one block; a miss usually ends at the fingerprint.
+class FrozenTable
+{
+	private:
+		unsigned int count;					// keys
+		unsigned int positions;				// positions the pilots map to, count / FROZEN_FILL
+		unsigned int bucketCount;
+		PackedArray pilots;					// per bucket
+		PackedArray overflow;				// per position past count, the free position below count it stands for
+		PackedArray ranks;					// per position: rank << FROZEN_FINGERPRINT_BITS | fingerprint
+		PodArray<unsigned int> blockOffsets;// per block, where it starts in blocks
+		PodArray<char> blocks;
+		vector<string> languages;			// display name per language id
+		double buildSeconds;
+		unsigned int bucketOf(unsigned long hash) const;
+		unsigned int positionOf(unsigned long hash, unsigned long pilot) const;
+		bool placeBuckets(const vector<unsigned long>& hashes, vector<unsigned int>& position);
+		bool encodeBlocks(const EntryStore& store, const vector<unsigned int>& sorted);
+		FrozenTable(const FrozenTable&);
+		FrozenTable& operator=(const FrozenTable&);
+	public:
+		FrozenTable();
+		bool build(const HashTable& table);
+		bool find(const string& word, FrozenEntry& entry) const;
+		const string& languageName(unsigned short language) const;
+		unsigned int size() const;
+		FrozenStats getStats() const;
+		void clear();
+};
+
+#endif
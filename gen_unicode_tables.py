@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+# Generates unicode_tables.h, the data behind unicode.cpp's case folding and
+# NFC normalization, from the Unicode database bundled with Python.
+#
+#   python3 gen_unicode_tables.py > unicode_tables.h
+
+import sys
+import unicodedata
+
+HANGUL_FIRST, HANGUL_LAST = 0xAC00, 0xD7A3
+
+
+def chars():
+    for cp in range(0x110000):
+        # surrogates are not characters
+        if 0xD800 <= cp <= 0xDFFF:
+            continue
+        yield cp
+
+
+def emit_rows(name, ctype, rows, per_line):
+    width = len(rows[0])
+    out = ["static const %s %s[][%d] = {" % (ctype, name, width)]
+    for i in range(0, len(rows), per_line):
+        chunk = rows[i:i + per_line]
+        out.append("\t" + " ".join("{" + ",".join("0x%X" % v for v in r) + "}," for r in chunk))
+    out.append("};")
+    return "\n".join(out)
+
+
+def emit_flat(name, ctype, values, per_line):
+    out = ["static const %s %s[] = {" % (ctype, name)]
+    for i in range(0, len(values), per_line):
+        out.append("\t" + ",".join("0x%X" % v for v in values[i:i + per_line]) + ",")
+    out.append("};")
+    return "\n".join(out)
+
+
+def main():
+    decomp_index, decomp_data = [], []
+    ccc_ranges = []
+    compose = []
+    fold_single, fold_multi = [], []
+
+    for cp in chars():
+        c = chr(cp)
+        # full canonical decomposition (Hangul syllables are handled algorithmically)
+        if not HANGUL_FIRST <= cp <= HANGUL_LAST:
+            nfd = unicodedata.normalize("NFD", c)
+            if nfd != c:
+                decomp_index.append((cp, len(decomp_data), len(nfd)))
+                decomp_data.extend(ord(x) for x in nfd)
+
+        # canonical combining classes, as ranges of equal class
+        ccc = unicodedata.combining(c)
+        if ccc:
+            if ccc_ranges and ccc_ranges[-1][1] == cp - 1 and ccc_ranges[-1][2] == ccc:
+                ccc_ranges[-1][1] = cp
+            else:
+                ccc_ranges.append([cp, cp, ccc])
+
+        # primary composites: two-character mappings that NFC recomposes
+        mapping = unicodedata.decomposition(c)
+        if mapping and not mapping.startswith("<"):
+            parts = [int(x, 16) for x in mapping.split()]
+            if len(parts) == 2 and unicodedata.normalize("NFC", chr(parts[0]) + chr(parts[1])) == c:
+                compose.append((parts[0], parts[1], cp))
+
+        # full case folding
+        folded = c.casefold()
+        if folded != c:
+            if len(folded) == 1:
+                fold_single.append((cp, ord(folded)))
+            else:
+                fold_multi.append(tuple([cp] + [ord(x) for x in folded] + [0] * (3 - len(folded))))
+
+    compose.sort()
+    print("// Generated by gen_unicode_tables.py from Unicode %s -- do not edit." % unicodedata.unidata_version)
+    print("// Every table is sorted by its first column for binary search.")
+    print("#ifndef _UNICODE_TABLES")
+    print("#define _UNICODE_TABLES")
+    print()
+    print("// code point, offset into DECOMP_DATA, length of its full canonical decomposition")
+    print(emit_rows("DECOMP_INDEX", "unsigned int", decomp_index, 6))
+    print(emit_flat("DECOMP_DATA", "unsigned int", decomp_data, 12))
+    print()
+    print("// first code point, last code point, canonical combining class (0 if absent)")
+    print(emit_rows("CCC_RANGES", "unsigned int", [tuple(r) for r in ccc_ranges], 6))
+    print()
+    print("// first, second, primary composite")
+    print(emit_rows("COMPOSE_PAIRS", "unsigned int", compose, 5))
+    print()
+    print("// code point, its case folding")
+    print(emit_rows("FOLD_SINGLE", "unsigned int", fold_single, 8))
+    print()
+    print("// code point, the two or three code points it folds to (0 pads)")
+    print(emit_rows("FOLD_MULTI", "unsigned int", fold_multi, 5))
+    print()
+    print("#endif")
+
+
+if __name__ == "__main__":
+    sys.exit(main())
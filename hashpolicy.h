@@ -0,0 +1,277 @@
+#ifndef _HASHPOLICY
+#define _HASHPOLICY
+#include <cstring>
+#include <cstddef>
+using namespace std;
+
+//Hash policies turn the bytes of a case-folded key into 64 bits. AVALANCHES tells the table
+//whether every output bit already depends on every input bit; if not, the result is mixed
+//before the slot and control bits are taken from it.
+//Reduction policies map a 32-bit slot hash onto a slot and pick the capacities they work with.
+//The table is built with one of each, chosen at compile time (see the end of this file).
+
+//returns the smallest prime greater than or equal to n
+inline unsigned int nextPrime(unsigned int n) {
+	if (n <= 2) return 2;
+	//only odd numbers can be prime past 2
+	if (n % 2 == 0) n++;
+	while (true) {
+		bool prime = true;
+		for (unsigned int d = 3; (unsigned long)d * d <= n; d += 2) {
+			if (n % d == 0) {
+				prime = false;
+				break;
+			}
+		}
+		if (prime) return n;
+		n += 2;
+	}
+}
+
+//unaligned little-endian reads of 8 and 4 bytes
+inline unsigned long read64(const char *p) {
+	unsigned long v;
+	memcpy(&v, p, 8);
+	return v;
+}
+
+inline unsigned long read32(const char *p) {
+	unsigned int v;
+	memcpy(&v, p, 4);
+	return v;
+}
+
+inline unsigned long rotl64(unsigned long x, int r) {
+	return (x << r) | (x >> (64 - r));
+}
+
+//polynomial rolling hash with base 31, one byte at a time (the table's original hash)
+struct PolynomialHash
+{
+	static const bool AVALANCHES = false;
+	static const char* name() { return "polynomial"; }
+	static unsigned long hash(const char *data, size_t length) {
+		unsigned long hash = 0;
+		for (size_t i = 0; i < length; i++) {
+			//bytes are added as signed chars, as they always were, so snapshots stay valid
+			hash = hash * 31 + (unsigned long)data[i];
+		}
+		return hash;
+	}
+};
+
+//32-bit cyclic shift hash: rotate by 5, add the byte
+struct CyclicShiftHash
+{
+	static const bool AVALANCHES = false;
+	static const char* name() { return "cyclic shift"; }
+	static unsigned long hash(const char *data, size_t length) {
+		unsigned int hash = 0;
+		for (size_t i = 0; i < length; i++) {
+			hash = (hash << 5) | (hash >> 27);
+			hash += (unsigned char)data[i];
+		}
+		return hash;
+	}
+};
+
+//Bernstein's DJB2: hash * 33 + byte, starting from 5381
+struct Djb2Hash
+{
+	static const bool AVALANCHES = false;
+	static const char* name() { return "djb2"; }
+	static unsigned long hash(const char *data, size_t length) {
+		unsigned long hash = 5381;
+		for (size_t i = 0; i < length; i++) {
+			hash = ((hash << 5) + hash) + (unsigned char)data[i];
+		}
+		return hash;
+	}
+};
+
+//wyhash (final version 4, seed 0): 8 or 16 bytes at a time folded through 64x64->128-bit multiplies
+struct WyHash
+{
+	static const bool AVALANCHES = true;
+	static const char* name() { return "wyhash"; }
+	//multiplies and folds the 128-bit product back into 64 bits
+	static unsigned long mix(unsigned long a, unsigned long b) {
+		unsigned __int128 r = (unsigned __int128)a * b;
+		return (unsigned long)r ^ (unsigned long)(r >> 64);
+	}
+	static unsigned long hash(const char *data, size_t length) {
+		const unsigned long s0 = 0xa0761d6478bd642fUL, s1 = 0xe7037ed1a0b428dbUL;
+		const unsigned long s2 = 0x8ebc6af09c88c6e3UL, s3 = 0x589965cc75374cc3UL;
+		const unsigned char *u = (const unsigned char*)data;
+		unsigned long seed = mix(s0, s1);
+		unsigned long a, b;
+		if (length <= 16) {
+			//short keys are read as two overlapping halves
+			if (length >= 4) {
+				size_t k = (length >> 3) << 2;
+				a = (read32(data) << 32) | read32(data + k);
+				b = (read32(data + length - 4) << 32) | read32(data + length - 4 - k);
+			}
+			else if (length > 0) {
+				a = ((unsigned long)u[0] << 16) | ((unsigned long)u[length >> 1] << 8) | u[length - 1];
+				b = 0;
+			}
+			else {
+				a = b = 0;
+			}
+		}
+		else {
+			const char *p = data;
+			size_t i = length;
+			//three independent lanes for long keys
+			if (i > 48) {
+				unsigned long see1 = seed, see2 = seed;
+				do {
+					seed = mix(read64(p) ^ s1, read64(p + 8) ^ seed);
+					see1 = mix(read64(p + 16) ^ s2, read64(p + 24) ^ see1);
+					see2 = mix(read64(p + 32) ^ s3, read64(p + 40) ^ see2);
+					p += 48;
+					i -= 48;
+				} while (i > 48);
+				seed ^= see1 ^ see2;
+			}
+			while (i > 16) {
+				seed = mix(read64(p) ^ s1, read64(p + 8) ^ seed);
+				p += 16;
+				i -= 16;
+			}
+			a = read64(p + i - 16);
+			b = read64(p + i - 8);
+		}
+		unsigned __int128 r = (unsigned __int128)(a ^ s1) * (b ^ seed);
+		return mix((unsigned long)r ^ s0 ^ length, (unsigned long)(r >> 64) ^ s1);
+	}
+};
+
+//xxHash64 (seed 0): four independent 8-byte lanes per 32-byte stripe, which the CPU (or a
+//vectorizer) can run side by side, then the tail and a final avalanche
+struct XxHash64
+{
+	static const bool AVALANCHES = true;
+	static const char* name() { return "xxh64"; }
+	static const unsigned long P1 = 11400714785074694791UL;
+	static const unsigned long P2 = 14029467366897019727UL;
+	static const unsigned long P3 = 1609587929392839161UL;
+	static const unsigned long P4 = 9650029242287828579UL;
+	static const unsigned long P5 = 2870177450012600261UL;
+	static unsigned long round(unsigned long acc, unsigned long input) {
+		return rotl64(acc + input * P2, 31) * P1;
+	}
+	static unsigned long merge(unsigned long acc, unsigned long lane) {
+		return (acc ^ round(0, lane)) * P1 + P4;
+	}
+	static unsigned long hash(const char *data, size_t length) {
+		const char *p = data;
+		const char *end = data + length;
+		unsigned long h;
+		if (length >= 32) {
+			unsigned long v1 = P1 + P2, v2 = P2, v3 = 0, v4 = 0 - P1;
+			do {
+				v1 = round(v1, read64(p));
+				v2 = round(v2, read64(p + 8));
+				v3 = round(v3, read64(p + 16));
+				v4 = round(v4, read64(p + 24));
+				p += 32;
+			} while (p + 32 <= end);
+			h = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+			h = merge(merge(merge(merge(h, v1), v2), v3), v4);
+		}
+		else {
+			h = P5;
+		}
+		h += length;
+		for (; p + 8 <= end; p += 8) {
+			h = rotl64(h ^ round(0, read64(p)), 27) * P1 + P4;
+		}
+		if (p + 4 <= end) {
+			h = rotl64(h ^ read32(p) * P1, 23) * P2 + P3;
+			p += 4;
+		}
+		for (; p < end; p++) {
+			h = rotl64(h ^ (unsigned char)*p * P5, 11) * P1;
+		}
+		h ^= h >> 33;
+		h *= P2;
+		h ^= h >> 29;
+		h *= P3;
+		h ^= h >> 32;
+		return h;
+	}
+};
+
+//the 32-bit value a slot stores for a key: the policy's hash, mixed with the murmur3
+//finalizer unless it avalanches on its own, so short words also fill the high bits the
+//control byte is taken from
+template<class Hash>
+inline unsigned int slotHashOf(const char *data, size_t length) {
+	unsigned long hash = Hash::hash(data, length);
+	if (!Hash::AVALANCHES) {
+		hash ^= hash >> 33;
+		hash *= 0xff51afd7ed558ccdUL;
+		hash ^= hash >> 33;
+		hash *= 0xc4ceb9fe1a85ec53UL;
+		hash ^= hash >> 33;
+	}
+	return (unsigned int)(hash ^ (hash >> 32));
+}
+
+//home slot = hash modulo a prime capacity: every hash bit counts, at the price of a division
+struct ModuloReduce
+{
+	static const unsigned int ID = 0;
+	static const char* name() { return "modulo"; }
+	static unsigned int home(unsigned int hash, unsigned int capacity) {
+		return hash % capacity;
+	}
+	static unsigned int capacityFor(unsigned int n) {
+		return nextPrime(n);
+	}
+};
+
+//home slot = the low bits of the hash under a power-of-two capacity: a single AND
+struct MaskReduce
+{
+	static const unsigned int ID = 1;
+	static const char* name() { return "mask"; }
+	static unsigned int home(unsigned int hash, unsigned int capacity) {
+		return hash & (capacity - 1);
+	}
+	static unsigned int capacityFor(unsigned int n) {
+		unsigned int capacity = 1;
+		while (capacity < n) capacity <<= 1;
+		return capacity;
+	}
+};
+
+//home slot = (hash * capacity) >> 32 (Lemire's fastrange): a multiply, any capacity. The hash
+//is rotated first so the slot comes from other bits than the 7 top ones the control byte keeps.
+struct FastRangeReduce
+{
+	static const unsigned int ID = 2;
+	static const char* name() { return "fastrange"; }
+	static unsigned int home(unsigned int hash, unsigned int capacity) {
+		unsigned int rotated = (hash << 7) | (hash >> 25);
+		return (unsigned int)(((unsigned long)rotated * capacity) >> 32);
+	}
+	static unsigned int capacityFor(unsigned int n) {
+		return n;
+	}
+};
+
+//policies the table is built with; choose others with -DHASHTABLE_HASH=... and
+//-DHASHTABLE_REDUCE=... (make HASH=WyHash REDUCE=MaskReduce)
+#ifndef HASHTABLE_HASH
+#define HASHTABLE_HASH WyHash
+#endif
+#ifndef HASHTABLE_REDUCE
+#define HASHTABLE_REDUCE ModuloReduce
+#endif
+typedef HASHTABLE_HASH KeyHash;
+typedef HASHTABLE_REDUCE SlotReduce;
+
+#endif
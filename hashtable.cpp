@@ -1,539 +1,2379 @@
-#include "hashtable.h"
-#include <vector>
-#include <string>
-#include <iostream>
-#include <fstream>
-#include <iomanip>
-using namespace std;
-
-//function to convert a string to lowercase
-string toLower(const string& str) {
-    string lowerStr = str;
-    for (char& c : lowerStr) {
-    	//convert each character to lowercase
-        c = tolower(c);
-    }
-    return lowerStr;
-}
-
-//constructor for Translation class
-Translation::Translation(string meanings,string language) {
-	//set the language of the translation
-	this->language = language;
-	//temporary string to store a meaning
-	string cur = "";
-	//add delimiter at the end to process last meaning
-	meanings += ";";
-	for (unsigned int i = 0; i < meanings.length(); i++) {
-		if (meanings[i] != ';') {
-			//build the meaning until ';' is found
-			cur += meanings[i];
-		}
-		else {
-			//if meaning is non-empty, add it
-			if (!cur.empty()) {
-				this->meanings.push_back(cur);
-				//reset for the next meaning
-				cur = "";
-			}
- 		}
-	}
-}
-
-//add new meanings to an existing translation
-void Translation::addMeaning(string newMeanings) {
-	string cur = "";	
-	//add delimiter to process the final meaning
-    newMeanings += ";";  
-
-    for (unsigned int i = 0; i < newMeanings.length(); i++) {
-        if (newMeanings[i] != ';') {
-        	//build current meaning
-            cur += newMeanings[i];
-        } 
-		else {
-            if (!cur.empty()) {
-                //check if the meaning already exists (case-insensitive)
-                bool exists = false;
-                for (const string& meaning : meanings) {
-                    if (toLower(meaning) == toLower(cur)) {
-                        exists = true;
-                        break;
-                    }
-                }
-                if (!exists) {
-                	//add new unique meaning
-                    meanings.push_back(cur);
-                }
-                //reset for next meaning
-                cur = "";
-            }
-        }
-    }
-}
-
-//constructor for entry class
-Entry::Entry(string word, string meanings,string language) {
-	//set the word for the entry
-	this->word = word;
-	//set the deleted flag to false by default
-	this->deleted = false;
-	//create a Translation object with the provided meanings and language and add it to the translations list
-	this->translations.push_back(Translation(meanings, language));
-}
-
-//add a new translation or update an existing one
-void Entry::addTranslation(string newMeanings, string language) {
-	for (unsigned int i = 0; i < translations.size(); i++) {
-		//check if translation in given language exists (case-insensitive)
-		if (toLower(translations[i].language) == toLower(language)) {
-			//add meanings to existing translation
-			translations[i].addMeaning(newMeanings);
-			return;
-		}
-	}
-
-	//if no existing translation found, create a new one
-	translations.push_back(Translation(newMeanings, language));
-}
-
-//print the word's translations and meanings
-void Entry::print() {
-	//set column width for language name formatting
-	const int width = 10;
-	for (unsigned int i = 0; i < translations.size(); i++) { 
-		//print language       
-        cout << left << setw(width) << translations[i].language;
-        //print colon
-		cout << ": ";
-       	//print meanings separated by semicolons
-        for (unsigned int j = 0; j < translations[i].meanings.size(); j++) {
-            cout << translations[i].meanings[j];
-            if (j < translations[i].meanings.size() - 1) {
-                cout << "; ";
-            }
-        }
-
-        cout << endl;
-    }
-}
-
-//constructor for hashtable, initializes buckets with nullptrs
-HashTable::HashTable(int capacity) {
-    buckets = new Entry*[capacity];		
-	for(int i=0; i<capacity; i++)
-		buckets[i] = nullptr;
-
-	//store the given capacity
-	this->capacity = capacity;
-	//initialize number of entries to 0
-	this->size = 0;
-	//initialize collision count to 0
-	this->collisions = 0;
-}
-
-//computes the hash code for a given word
-unsigned long HashTable::hashCode(string word) {
-
-	//cyclic shift hash method
-	// word = toLower(word);
-	//initialize the hash value to 0
-	// unsigned long hash = 0;
-	//iterate over each character in the input string
-	// for (char c : word) {
-		//cyclic-shift hash function
-		//perform a bitwise left shift by 5 (equivalent to multiplying by 32)
-		//and a right shift by 27
-		// hash = (hash << 5) | (hash>>27);
-		//add the ASCII value of the character to the hash
-		// hash = hash + (unsigned long) c;
-	// }
-	//return the computed hash value
-	// return hash;
-
-	//polynomial hash method
-	word = toLower(word);
-	//initialize the hash value to 0
-	unsigned long hash = 0;
-	//choose a base value which is usually a small prime no. e.g. 31
-	unsigned long base = 31;
-	//iterate through each character in the word
-	for (char c : word) {
-		//update the hash value using the polynomial rolling formula:
-    	//multiply current hash by base and add the ASCII value of the character
-		hash = hash * base + (unsigned long)c;
-	}
-	//return the computed hash value
-	return hash;
-
-	//DJB2 hash method
-	// word = toLower(word);
-	//initialize the hash value with a magic number (5381) as per the DJB2 algorithm
-	// unsigned long hash = 5381;
-	//iterate through each character in the word
-	// for (char c : word) {
-		//perform the DJB2 hash calculation:
-    	//hash * 33 is implemented as (hash << 5) + hash for efficiency
-    	//then add the ASCII value of the current character
-		// hash = ((hash << 5) + hash) + (unsigned char)c;
-	// }
-	//return the computed hash value
-	// return hash;
-
-}
-
-//returns the current number of stored entries
-unsigned int HashTable::getSize() {
-    return size;
-}
-
-//returns the number of collisions that occurred during insertions
-unsigned int HashTable::getCollisions() {
-    return collisions;
-}
-
-//global flag to prevent insert error message from being printed when calling import
-bool insertCalledFromImport = false;
-
-//imports entries from a file at the given path
-void HashTable::import(string path) {
-
-	//check if user didn't enter file name
-	if (path.empty()) {
-		cout << "Please provide the file name you wish to import from." << endl;
-		return;
-	}
-
-	ifstream file(path);
-	//check if file opened successfully 
-	if (!file.is_open()) {
-		cout << "Could not open the file." << endl;
-		return;
-	}
-
-	//disable errors in insert
-	insertCalledFromImport = true;
-
-	string line;
-	string language;
-
-	//read the first line to get the language
-	if (getline(file, line)) {
-		language = line;
-	}
-	else {
-		cout << "Could not find the language." << endl;
-		return;
-	}
-
-	int linesProcessed = 0;
-	string word;
-	string meanings;
-
-	//process each remaining line
-	while (getline(file, line)) {
-		if (line.empty()) {
-			continue;
-		}
-		//find the position of the colon separator
-		size_t colonidx = line.find(':');
-		if (colonidx == string::npos) continue;
-		//extract the word and its meanings
-		word = line.substr(0, colonidx);
-		meanings = line.substr(colonidx + 1);
-		//insert the entry into the table
-		insert(word, meanings, language);
-		linesProcessed++;
-	}
-	//confirmation message
-	cout << linesProcessed << " " << language << " words have been imported successfully." << endl;
-	//re-enable error messages in insert
-	insertCalledFromImport = false;
-	//close the file
-	file.close();
-}
-
-//inserts a new word with its meanings and language into the hashtable
-void HashTable::insert(string word, string meanings,string language) {
-
-	//validate user input
-	if (!insertCalledFromImport && (word.empty() || meanings.empty() || language.empty())) {
-    cout << "Error: Please provide a word, at least one meaning, and the language." << endl;
-    return;
-	}
-	
-	//compute the initial index in the table
-	unsigned long hashIndex = hashCode(toLower(word)) % capacity;
-	//probing attempt counter
-	unsigned int i = 0;
-	//final index after probing
-	unsigned int index = hashIndex;
-	//quadratic probing to find an empty slot or the word if it already exists
-	while (buckets[index] != nullptr && (toLower(buckets[index]->word)) != toLower(word) && !buckets[index]->deleted) {
-		//count each collision
-		collisions++;
-		//increase the probe count
-		i++;
-		//quadratic probing formula
-		index = (hashIndex + i*i) % capacity;	
-	}
-
-	//check if slot is empty or was marked as deleted. If either, then insert a new Entry
-	if (buckets[index] == nullptr || buckets[index]->deleted) {
-		buckets[index] = new Entry(word, meanings, language);
-		//increase total number of stored entries
-		size++;
-		return;
-	}	
-	//if the word already exists, add translation to the entry
-	Entry* entry = buckets[index];
-	entry->addTranslation(meanings, language);
-}
-
-//delete a word entirely from the dictionary
-void HashTable::delWord(string word) {
-
-	//validate user input
-	if (word.empty()) {
-		cout << "Please provide the word you wish to delete." << endl;
-		return;
-	}
-
-	//compute hash index using quadratic probing
-	unsigned long hashIndex = hashCode(toLower(word)) % capacity;
-	for (unsigned int i = 0; i < capacity; i++) {
-        unsigned int index = (hashIndex + i * i) % capacity;
-		
-		//if empty slot is found, word does not exist
-		if (buckets[index] == nullptr) {
-			cout << word << " not found in the Dictionary." << endl;
-			return;
-		}
-		//check for matching word that is not deleted
-		if (!buckets[index]->deleted && (toLower(buckets[index]->word)) == toLower(word)) {
-			buckets[index]->deleted = true;
-			//decrement size
-			size--;
-			//confirmation message
-			cout << word << " has been successfully deleted from the Dictionary." << endl;
-			return;
-		}
-	}
-
-	cout << word << " not found in the Dictionary." << endl;
-}
-
-//delete a translation of a word in a specific language
-void HashTable::delTranslation(string word, string language) {
-	//check if either word or language input is empty
-	if (word.empty() || language.empty()) {
-		cout << "Please provide the word and the language of its translation you wish to delete." << endl;
-		return;
-	}
-
-	//compute the hash index using the lowercased word
-	unsigned long hashIndex = hashCode(toLower(word)) % capacity;
-	//perform quadratic probing to resolve collisions
-	for (unsigned int i = 0; i < capacity; i++) {
-        unsigned int index = (hashIndex + i * i) % capacity;
-        //if a null bucket is reached, the word does not exist in the table
-		if (buckets[index] == nullptr) {
-			cout << word << " not found in the Dictionary." << endl;
-			return;
-		}
-
-		//if the current bucket is not marked deleted and matches the word
-		if (!buckets[index]->deleted && (toLower(buckets[index]->word)) == toLower(word)) {
-
-			//access the list of translations for this word
-			vector<Translation>& translations = buckets[index]->translations;
-
-			//iterate through all translations to find the one matching the given language
-			for (vector<Translation>::iterator p = translations.begin(); p != translations.end(); ++p) {
-				//compare language case-insensitively
-				if (toLower(p->language) == toLower(language)) {
-					//remove the translation from the list
-					translations.erase(p);
-					cout << "Translation has been successfully deleted from the Dictionary." << endl;
-
-					//if the word now has no translations, mark the bucket as deleted
-					if (translations.empty()) {
-						buckets[index]->deleted = true;
-						size--;						
-					}
-					return;
-				}
-			}
-			//if loop completes without match, the translation was not found
-			cout << "Translation not found in the Dictionary." << endl;
-			return;
-		}
-	}
-	//if the word was never found in the probing sequence
-	cout << word << " not found in the Dictionary." << endl;
-}
-
-//delete a specific meaning of a word in a certain language
-void HashTable::delMeaning(string word, string meaning, string language) {
-
-	//check if any of the input fields are empty
-	if (word.empty() || language.empty() || meaning.empty()) {
-		cout << "Please provide the word, its meaning, and its language that you wish to delete." << endl;
-		return;
-	}
-
-	//compute initial index using the lowercase of the word
-	unsigned long hashIndex = hashCode(toLower(word)) % capacity;
-
-	//probe through the table using quadratic probing
-	for (unsigned int i = 0; i < capacity; i++) {
-        unsigned int index = (hashIndex + i * i) % capacity;
-
-        //if a null slot is found, the word doesn't exist in the dictionary
-		if (buckets[index] == nullptr) {
-			cout << word << " not found in the Dictionary." << endl;
-			return;
-		}
-
-		//if the slot is not marked deleted and the word matches
-		if (!buckets[index]->deleted && (toLower(buckets[index]->word)) == toLower(word)) {
-			//access the list of translations for this word
-			vector<Translation>& translations = buckets[index]->translations;
-
-			//iterate through each translation to find matching language
-			for (unsigned int j = 0; j < translations.size(); j++) {
-				if (toLower(translations[j].language) == toLower(language)) {
-					//access the list of meanings for this translation
-					vector<string>& meanings = translations[j].meanings;
-
-					//search for the specific meaning to delete
-					for (vector<string>::iterator p = meanings.begin(); p != meanings.end(); ++p) {
-						if (toLower(*p) == toLower(meaning)) {
-
-							//remove the meaning
-							meanings.erase(p);
-
-							//confirmation message
-							cout << "Meaning has been successfully deleted from the Translation." << endl;
-
-							//if no meanings remain, remove the entire translation
-							if (meanings.empty()) {
-								translations.erase(translations.begin() + j);
-							}
-
-							//if no translations remain, mark the bucket as deleted
-							if (translations.empty()) {
-								buckets[index]->deleted = true;
-								size--;
-							}							
-
-							return;
-						}
-					}
-					
-					//meaning was not found in the translation
-					cout << "Meaning not found in the Dictionary." << endl;
-					return;
-				}
-			}
-			//language was not found for the word
-			cout << "Language not found in the Dictionary." << endl;
-			return;
-		}
-	}
-	//word was not found in the dictionary
-	cout << word << " not found in the Dictionary." << endl;
-}
-
-//export all words of a given language to a file
-void HashTable::exportData(string language, string filePath) {
-
-	//attempt to open output file
-	ofstream outFile(filePath);
-	if (!outFile.is_open()) {
-		cout << "Could not open the required file for writing." << endl;
-		return;
-	}
-	//write the language as the first line in the file
-	outFile << language << endl;
-	int cnt = 0;
-	//traverse all entries in the table
-	for (unsigned int i = 0; i < capacity; i++) {
-		Entry* entry = buckets[i];
-
-		//skip null or deleted entries
-		if (entry != nullptr && !entry->deleted) {
-			//check each translation for the target language
-			for (const Translation& T : entry->translations) {
-				if (toLower(T.language) == toLower(language)) {
-					//write the word followed by a colon
-					outFile << entry->word << ":";
-
-					//write all meanings separated by semicolons
-					for (unsigned int j = 0; j < T.meanings.size(); j++) {
-						outFile << T.meanings[j];
-						if (j < T.meanings.size() - 1) {
-							outFile << ";";
-						}
-					}
-
-					outFile << endl;
-					cnt++;
-				}
-			}
-		}
-	}
-	//close the file after writing all the records
-	outFile.close();
-	//confirmation message
-	cout << cnt << " records have been successfully exported to " << filePath << endl;
-}
-
-//searches for a word in the dictionary and prints its translations
-void HashTable::find(string word) {
-
-	//check if the input is empty
-	if (word.empty()) {
-		cout << "Please provide the word you wish to find." << endl;
-		return;
-	}
-
-	//compute initial index using hash function
-	unsigned long hashIndex = hashCode(toLower(word)) % capacity;
-	int comparisons = 0;
-
-	//probe the table using quadratic probing
-	for (unsigned int i = 0; i < capacity; i++) {
-        unsigned int index = (hashIndex + i * i) % capacity;
-		comparisons++;
-
-		//if a null slot is found, the word doesn't exist
-		if (buckets[index] == nullptr) {
-			cout << word << " not found in the Dictionary." << endl;
-			return;
-		}
-
-		//if the slot is not deleted and the word matches
-		if (!buckets[index]->deleted && (toLower(buckets[index]->word)) == toLower(word)) {
-			cout << word << " found in the Dictionary after " << comparisons << " comparisons."<< endl;
-			//print all translations and meanings
-			buckets[index]->print();
-			return;
-		}
-	}
-	//word was not found in the dictionary after full probing
-	cout << word << " not found in the Dictionary." << endl;
-}
-
-//destructor for hashtable, frees memory used by entries
-HashTable::~HashTable() {
-
-	//delete each entry in the hastable
-	for (unsigned int i=0; i < capacity; i++) {
-		if (buckets[i] != nullptr) {
-			delete buckets[i];
-		}
-	}
-	//delete the entire bucket array
-	delete[] buckets;
-}
+#include "hashtable.h"
+#include "unicode.h"
+#include "stats.h"
+#include <vector>
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <cstring>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <algorithm>
+#include <cstdio>
+#include <cstddef>
+#include <cerrno>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define HASHTABLE_X86 1
+#endif
+using namespace std;
+
+//case-folds and NFC-normalizes a word into a per-thread buffer, so normalizing a query does not allocate once the buffer has grown
+static const string& foldKey(const string& word) {
+	static thread_local string buffer;
+	foldCase(word, buffer);
+	return buffer;
+}
+
+//SWAR group of 8 control bytes, used where no vector unit is available
+struct ScalarGroup {
+	static const unsigned int WIDTH = 8;
+	unsigned long ctrl;
+	ScalarGroup(const unsigned char *p) {
+		ctrl = 0;
+		for (unsigned int i = 0; i < WIDTH; i++) {
+			ctrl |= (unsigned long)p[i] << (8 * i);
+		}
+	}
+	//gathers the top bit of every byte into one bit per slot
+	static unsigned int pack(unsigned long msbs) {
+		return (unsigned int)(((msbs >> 7) * 0x0102040810204080UL) >> 56);
+	}
+	//slots whose control byte may equal h2 (false positives are weeded out by the key check)
+	unsigned int match(unsigned char h2) const {
+		unsigned long x = ctrl ^ (0x0101010101010101UL * h2);
+		return pack((x - 0x0101010101010101UL) & ~x & 0x8080808080808080UL);
+	}
+	//empty slots have the top bit set and bit 1 clear, tombstones have both set
+	unsigned int matchEmpty() const {
+		return pack(ctrl & ~(ctrl << 6) & 0x8080808080808080UL);
+	}
+	//empty slots and tombstones
+	unsigned int matchFree() const {
+		return pack(ctrl & 0x8080808080808080UL);
+	}
+};
+
+#ifdef HASHTABLE_X86
+//group of 16 control bytes compared with one SSE2 instruction each
+struct Sse2Group {
+	static const unsigned int WIDTH = 16;
+	__m128i ctrl;
+	Sse2Group(const unsigned char *p) {
+		ctrl = _mm_loadu_si128((const __m128i*)p);
+	}
+	unsigned int match(unsigned char h2) const {
+		return _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)h2)));
+	}
+	unsigned int matchEmpty() const {
+		return _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)CTRL_EMPTY)));
+	}
+	unsigned int matchFree() const {
+		return _mm_movemask_epi8(ctrl);
+	}
+};
+
+//group of 32 control bytes; keeps a pointer so no AVX value crosses a non-AVX2 function
+struct Avx2Group {
+	static const unsigned int WIDTH = 32;
+	const unsigned char *p;
+	Avx2Group(const unsigned char *p) : p(p) {}
+	__attribute__((target("avx2"))) unsigned int match(unsigned char h2) const {
+		__m256i ctrl = _mm256_loadu_si256((const __m256i*)p);
+		return _mm256_movemask_epi8(_mm256_cmpeq_epi8(ctrl, _mm256_set1_epi8((char)h2)));
+	}
+	__attribute__((target("avx2"))) unsigned int matchEmpty() const {
+		__m256i ctrl = _mm256_loadu_si256((const __m256i*)p);
+		return _mm256_movemask_epi8(_mm256_cmpeq_epi8(ctrl, _mm256_set1_epi8((char)CTRL_EMPTY)));
+	}
+	__attribute__((target("avx2"))) unsigned int matchFree() const {
+		return _mm256_movemask_epi8(_mm256_loadu_si256((const __m256i*)p));
+	}
+};
+#endif
+
+//the 7 hash bits kept in the control byte of a full slot
+static inline unsigned char h2Of(unsigned int hash) {
+	return hash >> 25;
+}
+
+//scans the table one group at a time from the home slot until equal() accepts a candidate or an empty slot shows up
+template<class Group, class Equal>
+static inline int groupProbe(const unsigned char *ctrl, unsigned int cap, unsigned int hash, const Equal &equal, int &probes) {
+	unsigned char h2 = h2Of(hash);
+	unsigned int pos = SlotReduce::home(hash, cap);
+	for (unsigned int scanned = 0; scanned < cap; scanned += Group::WIDTH) {
+		Group group(ctrl + pos);
+		probes++;
+		STAT_ADD(STAT_PROBE_TOMBSTONES, __builtin_popcount(group.matchFree() & ~group.matchEmpty()));
+		//only slots whose control byte carries the same 7 hash bits are looked at
+		for (unsigned int mask = group.match(h2); mask != 0; mask &= mask - 1) {
+			unsigned int index = pos + __builtin_ctz(mask);
+			if (index >= cap) index -= cap;
+			if (equal(index)) return index;
+		}
+		//a key is never stored past an empty slot of its probe sequence
+		if (group.matchEmpty() != 0) return -1;
+		pos += Group::WIDTH;
+		if (pos >= cap) pos -= cap;
+	}
+	return -1;
+}
+
+//returns the first empty slot or tombstone of the probe sequence and how far it is from home
+template<class Group>
+static inline unsigned int groupFree(const unsigned char *ctrl, unsigned int cap, unsigned int hash, unsigned int &distance) {
+	unsigned int pos = SlotReduce::home(hash, cap);
+	for (distance = 0; ; distance += Group::WIDTH) {
+		unsigned int mask = Group(ctrl + pos).matchFree();
+		if (mask != 0) {
+			distance += __builtin_ctz(mask);
+			unsigned int index = pos + __builtin_ctz(mask);
+			return index >= cap ? index - cap : index;
+		}
+		pos += Group::WIDTH;
+		if (pos >= cap) pos -= cap;
+	}
+}
+
+#ifdef HASHTABLE_X86
+//AVX2 entry points, compiled for AVX2 regardless of the flags the rest of the file uses
+template<class Equal>
+__attribute__((target("avx2"))) static int avx2Probe(const unsigned char *ctrl, unsigned int cap, unsigned int hash, const Equal &equal, int &probes) {
+	return groupProbe<Avx2Group>(ctrl, cap, hash, equal, probes);
+}
+
+__attribute__((target("avx2"))) static unsigned int avx2Free(const unsigned char *ctrl, unsigned int cap, unsigned int hash, unsigned int &distance) {
+	return groupFree<Avx2Group>(ctrl, cap, hash, distance);
+}
+#endif
+
+//picks the widest group comparison the running CPU supports
+static ProbeKernel detectProbeKernel() {
+#ifdef HASHTABLE_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2")) return KERNEL_AVX2;
+	if (__builtin_cpu_supports("sse2")) return KERNEL_SSE2;
+#endif
+	return KERNEL_SCALAR;
+}
+
+//writes a control byte and its mirror past the end of the table
+static inline void setCtrl(unsigned char *ctrl, unsigned int cap, unsigned int index, unsigned char value) {
+	ctrl[index] = value;
+	if (index < CTRL_MIRROR) {
+		ctrl[cap + index] = value;
+	}
+}
+
+//allocates a control byte array (plus its mirrored tail) with every slot marked empty
+static unsigned char* newCtrl(unsigned int capacity) {
+	unsigned char* ctrl = new unsigned char[capacity + CTRL_MIRROR];
+	for (unsigned int i = 0; i < capacity + CTRL_MIRROR; i++) {
+		ctrl[i] = CTRL_EMPTY;
+	}
+	return ctrl;
+}
+
+//constructor for hashtable, initializes all slots as empty
+HashTable::HashTable(int capacity, float maxLoadFactor) {
+	//the table must be at least as large as the mirrored tail of control bytes
+	if (capacity < (int)CTRL_MIRROR + 1) capacity = CTRL_MIRROR + 1;
+	capacity = SlotReduce::capacityFor(capacity);
+	ctrl = newCtrl(capacity);
+	slots = new Slot[capacity];
+
+	//store the given capacity
+	this->capacity = capacity;
+	//initialize number of entries to 0
+	this->size = 0;
+	//initialize collision count to 0
+	this->collisions = 0;
+	//no key comparisons performed yet
+	this->keyComparisons = 0;
+	//one histogram bucket per probe length, the last one collects longer chains
+	this->probeHistogram.assign(PROBE_HISTOGRAM_SIZE, 0);
+	//no slots are occupied yet
+	this->used = 0;
+	this->tombstones = 0;
+	//rehash and compact on their own once deletions leave enough behind
+	this->maxTombstoneRatio = MAX_TOMBSTONE_RATIO;
+	this->maxGarbageRatio = MAX_GARBAGE_RATIO;
+	//resize once the ceiling is crossed
+	this->maxLoadFactor = 0.8;
+	setMaxLoadFactor(maxLoadFactor);
+	//rehash everything at once unless asked otherwise
+	this->incremental = false;
+	this->rehashStep = 64;
+	//compare control bytes with the widest instructions available
+	this->kernel = detectProbeKernel();
+	//no rehash in progress
+	this->oldCtrl = nullptr;
+	this->oldSlots = nullptr;
+	this->oldCapacity = 0;
+	this->rehashIndex = 0;
+	//nothing imported yet
+	this->importStats.lines = 0;
+	this->importStats.bytes = 0;
+	this->importStats.seconds = 0;
+	this->importStats.threads = 1;
+	memset(&this->pipelineStats, 0, sizeof(this->pipelineStats));
+	//import on the calling thread unless asked otherwise
+	this->importThreads = 1;
+	//the table owns its storage until a snapshot is loaded
+	this->snapshot = nullptr;
+	//no reverse index or prefix trie until one is asked for
+	this->reverse = nullptr;
+	this->trie = nullptr;
+}
+
+//computes the hash code for a given key (the caller has already case-folded it) with the
+//hash policy the table is built with
+unsigned long HashTable::hashCode(const string& word) const {
+	return KeyHash::hash(word.data(), word.size());
+}
+
+//returns the current number of stored entries
+unsigned int HashTable::getSize() {
+    return size;
+}
+
+//returns the number of collisions that occurred during insertions
+unsigned int HashTable::getCollisions() {
+    return collisions;
+}
+
+//returns how many insertions needed each number of collisions; the last bucket counts longer chains
+const vector<unsigned int>& HashTable::getProbeHistogram() {
+	return probeHistogram;
+}
+
+//returns the instruction set used to compare groups of control bytes
+ProbeKernel HashTable::getProbeKernel() {
+	return kernel;
+}
+
+//forces a group comparison kernel; kernels the CPU lacks are ignored
+void HashTable::setProbeKernel(ProbeKernel kernel) {
+	if (kernel == KERNEL_SCALAR || kernel <= detectProbeKernel()) {
+		this->kernel = kernel;
+	}
+}
+
+//returns the number of full word comparisons made after a stored hash matched
+unsigned long HashTable::getKeyComparisons() {
+	return keyComparisons;
+}
+
+//returns the number of slots in the (new) table
+unsigned int HashTable::getCapacity() {
+	return capacity;
+}
+
+//returns the fraction of slots occupied by entries or tombstones
+float HashTable::getLoadFactor() {
+	return float(used) / capacity;
+}
+
+//returns true while an incremental rehash is still draining the old table
+bool HashTable::isRehashing() {
+	return oldSlots != nullptr;
+}
+
+//returns the number of tombstones in the current table
+unsigned int HashTable::getTombstones() {
+	return tombstones;
+}
+
+//measures the probe chains of the current table: how far live entries sit from their home
+//slots, and how many slots a lookup that misses passes before it reaches an empty one
+ProbeHealth HashTable::getProbeHealth() {
+	ProbeHealth health;
+	health.live = 0;
+	health.tombstones = 0;
+	health.empty = 0;
+	health.displacement.assign(PROBE_HISTOGRAM_SIZE, 0);
+	unsigned long displaced = 0;
+	int lastEmpty = -1;
+	for (unsigned int i = 0; i < capacity; i++) {
+		if ((ctrl[i] & 0x80) == 0) {
+			unsigned int distance = (i + capacity - SlotReduce::home(slots[i].hash, capacity)) % capacity;
+			health.live++;
+			displaced += distance;
+			health.displacement[distance < PROBE_HISTOGRAM_SIZE ? distance : PROBE_HISTOGRAM_SIZE - 1]++;
+		}
+		else if (ctrl[i] == CTRL_DELETED) {
+			health.tombstones++;
+		}
+		else {
+			health.empty++;
+			lastEmpty = i;
+		}
+	}
+	health.meanDisplacement = health.live > 0 ? (double)displaced / health.live : 0;
+	//a miss starting at slot i passes every full slot and tombstone up to the next empty one;
+	//walking backwards from an empty slot gives each run length from the one after it
+	unsigned long passed = 0;
+	unsigned int run = 0;
+	for (unsigned int n = 0; lastEmpty >= 0 && n < capacity; n++) {
+		unsigned int i = (lastEmpty + capacity - n) % capacity;
+		run = ctrl[i] == CTRL_EMPTY ? 0 : run + 1;
+		passed += run;
+	}
+	health.meanMissRun = lastEmpty >= 0 ? (double)passed / capacity : capacity;
+	return health;
+}
+
+//sets the tombstone share of the slots that makes a change rehash the table in place, and the
+//garbage share of the store that makes it compact everything; 0 turns either off
+void HashTable::setCompaction(float maxTombstoneRatio, float maxGarbageRatio) {
+	this->maxTombstoneRatio = maxTombstoneRatio;
+	this->maxGarbageRatio = maxGarbageRatio;
+}
+
+//returns true if the word is in the dictionary, without printing anything
+bool HashTable::contains(const string& word) {
+	const string& key = foldKey(word);
+	return lookup(key, slotHash(key)) != nullptr;
+}
+
+//copies a word's meanings in a language into meanings; returns false if the word or the
+//translation is missing. It changes nothing, not even a pending rehash, so it is safe to run
+//from many threads at once as long as no thread changes the table meanwhile.
+bool HashTable::getMeanings(const string& word, const string& language, vector<string>& meanings) const {
+	meanings.clear();
+	int entry = locateWord(word);
+	int languageId = entry >= 0 ? store.findLanguage(language) : -1;
+	int t = languageId >= 0 ? store.findTranslation(entry, languageId) : -1;
+	if (t < 0) {
+		return false;
+	}
+	const Translation& T = store.translation(store.entry(entry), t);
+	for (unsigned int m = 0; m < T.meaningCount; m++) {
+		meanings.push_back(store.str(store.meaning(T, m)));
+	}
+	return true;
+}
+
+//sets the load factor above which the table grows
+void HashTable::setMaxLoadFactor(float maxLoadFactor) {
+	//ignore values that could never be satisfied
+	if (maxLoadFactor <= 0 || maxLoadFactor >= 1) {
+		return;
+	}
+	this->maxLoadFactor = maxLoadFactor;
+}
+
+//switches between rehashing all at once and moving a few slots per operation
+void HashTable::setIncrementalRehash(bool enabled, unsigned int bucketsPerStep) {
+	//a pending rehash must complete before leaving incremental mode
+	if (!enabled && oldSlots != nullptr) {
+		finishRehash();
+	}
+	this->incremental = enabled;
+	this->rehashStep = bucketsPerStep > 0 ? bucketsPerStep : 1;
+}
+
+//returns the value stored in the slot of a case-folded key
+unsigned int HashTable::slotHash(const string& key) const {
+	return slotHashOf<KeyHash>(key.data(), key.size());
+}
+
+//runs groupProbe with the selected kernel
+template<class Equal>
+static inline int kernelProbe(ProbeKernel kernel, const unsigned char *ctrl, unsigned int cap, unsigned int hash, const Equal &equal, int &probes) {
+	switch (kernel) {
+#ifdef HASHTABLE_X86
+		case KERNEL_AVX2:
+			return avx2Probe(ctrl, cap, hash, equal, probes);
+		case KERNEL_SSE2:
+			return groupProbe<Sse2Group>(ctrl, cap, hash, equal, probes);
+#endif
+		default:
+			return groupProbe<ScalarGroup>(ctrl, cap, hash, equal, probes);
+	}
+}
+
+//returns the slot index of the live entry for a case-folded key in the given table, or -1
+int HashTable::probe(const unsigned char *ctrl, Slot *table, unsigned int cap, const string& key, unsigned int hash, int &probes) {
+	//a candidate must carry the full stored hash before its key is compared, length first
+	auto equal = [&](unsigned int index) {
+		if (table[index].hash != hash) return false;
+		keyComparisons++;
+		StrRef stored = store.entry(table[index].entry).key;
+		return stored.length == key.size() && memcmp(store.text(stored), key.data(), key.size()) == 0;
+	};
+	return kernelProbe(kernel, ctrl, cap, hash, equal, probes);
+}
+
+//returns the entry index of a case-folded key, or -1, without advancing a rehash or counting
+//comparisons; it writes nothing, so any number of threads may run it while no one changes the table
+int HashTable::locate(const string& key, unsigned int hash, int &probes) const {
+	probes = 0;
+	const Slot *table = slots;
+	auto equal = [&](unsigned int index) {
+		if (table[index].hash != hash) return false;
+		StrRef stored = store.entry(table[index].entry).key;
+		return stored.length == key.size() && memcmp(store.text(stored), key.data(), key.size()) == 0;
+	};
+	int index = kernelProbe(kernel, ctrl, capacity, hash, equal, probes);
+	if (index >= 0) {
+		return slots[index].entry;
+	}
+	//entries not migrated yet still live in the old table
+	if (oldSlots != nullptr) {
+		table = oldSlots;
+		index = kernelProbe(kernel, oldCtrl, oldCapacity, hash, equal, probes);
+		if (index >= 0) {
+			return oldSlots[index].entry;
+		}
+	}
+	return -1;
+}
+
+//returns the first free slot for a hash, and how many slots past home it is
+unsigned int HashTable::freeSlot(const unsigned char *ctrl, unsigned int cap, unsigned int hash, unsigned int &distance) {
+	switch (kernel) {
+#ifdef HASHTABLE_X86
+		case KERNEL_AVX2:
+			return avx2Free(ctrl, cap, hash, distance);
+		case KERNEL_SSE2:
+			return groupFree<Sse2Group>(ctrl, cap, hash, distance);
+#endif
+		default:
+			return groupFree<ScalarGroup>(ctrl, cap, hash, distance);
+	}
+}
+
+//returns the entry index of a word as typed, or -1, with the same guarantees as locate
+int HashTable::locateWord(const string& word) const {
+	const string& key = foldKey(word);
+	int probes;
+	return locate(key, slotHash(key), probes);
+}
+
+//finds the slot of a live entry for a case-folded key in either table, advancing a pending rehash
+Slot* HashTable::lookup(const string& key, unsigned int hash) {
+	migrate(rehashStep);
+	int probes = 0;
+	int index = probe(ctrl, slots, capacity, key, hash, probes);
+	if (index >= 0) {
+		return &slots[index];
+	}
+	//entries not migrated yet still live in the old table
+	if (oldSlots != nullptr) {
+		index = probe(oldCtrl, oldSlots, oldCapacity, key, hash, probes);
+		if (index >= 0) {
+			return &oldSlots[index];
+		}
+	}
+	return nullptr;
+}
+
+//tombstones a slot and the entry it points to
+void HashTable::remove(Slot *slot) {
+	//the slot belongs to whichever table's range it falls in
+	if (slot >= slots && slot < slots + capacity) {
+		setCtrl(ctrl, capacity, slot - slots, CTRL_DELETED);
+		tombstones++;
+	}
+	else {
+		setCtrl(oldCtrl, oldCapacity, slot - oldSlots, CTRL_DELETED);
+	}
+	store.entry(slot->entry).deleted = true;
+	store.unlist(slot->entry);
+	//the word no longer completes any prefix
+	if (trie != nullptr) {
+		StrRef key = store.entry(slot->entry).key;
+		trie->remove(store.text(key), key.length);
+	}
+	size--;
+}
+
+//allocates a table twice as large and moves the entries over
+void HashTable::grow() {
+	resize(SlotReduce::capacityFor(2 * capacity));
+}
+
+//grows once, up front, so that count more entries fit under the load factor ceiling
+void HashTable::reserve(unsigned int count) {
+	finishRehash();
+	if (used + count <= maxLoadFactor * capacity) {
+		return;
+	}
+	resize(SlotReduce::capacityFor((unsigned int)((used + count) / maxLoadFactor) + 1));
+	//a bulk load is about to follow, so the move is not spread over operations
+	finishRehash();
+}
+
+//allocates a table of the given capacity and moves the entries over
+void HashTable::resize(unsigned int newCapacity) {
+	//only one rehash can be in flight at a time
+	finishRehash();
+	STAT_ADD(STAT_REHASHES, 1);
+
+	oldCtrl = ctrl;
+	oldSlots = slots;
+	oldCapacity = capacity;
+	rehashIndex = 0;
+
+	capacity = newCapacity;
+	ctrl = newCtrl(capacity);
+	slots = new Slot[capacity];
+	used = 0;
+	tombstones = 0;
+
+	//in blocking mode drain the old table right away
+	if (!incremental) {
+		finishRehash();
+	}
+}
+
+//moves up to count slots from the old table into the new one
+void HashTable::migrate(unsigned int count) {
+	if (oldSlots == nullptr) {
+		return;
+	}
+	for (unsigned int moved = 0; moved < count && rehashIndex < oldCapacity; moved++, rehashIndex++) {
+		Slot &slot = oldSlots[rehashIndex];
+		//the stored hash lets the entry move without touching its word
+		if ((oldCtrl[rehashIndex] & 0x80) == 0) {
+			unsigned int distance;
+			unsigned int index = freeSlot(ctrl, capacity, slot.hash, distance);
+			//a tombstone left by a deletion since the rehash began is reused, releasing its entry;
+			//an empty slot raises the load
+			if (ctrl[index] == CTRL_EMPTY) {
+				used++;
+			}
+			else {
+				store.release(slots[index].entry);
+				tombstones--;
+			}
+			slots[index].hash = slot.hash;
+			slots[index].entry = slot.entry;
+			setCtrl(ctrl, capacity, index, h2Of(slot.hash));
+			//the moved slot stays occupied so probe sequences through it still reach later keys
+			setCtrl(oldCtrl, oldCapacity, rehashIndex, CTRL_DELETED);
+		}
+		//tombstones are dropped instead of copied, releasing what their entry still holds
+		else if (oldCtrl[rehashIndex] == CTRL_DELETED) {
+			store.release(slot.entry);
+		}
+	}
+	//release the old table once it is empty
+	if (rehashIndex == oldCapacity) {
+		delete[] oldCtrl;
+		delete[] oldSlots;
+		oldCtrl = nullptr;
+		oldSlots = nullptr;
+		oldCapacity = 0;
+		rehashIndex = 0;
+	}
+}
+
+//completes a pending rehash in one go
+void HashTable::finishRehash() {
+	if (oldSlots != nullptr) {
+		migrate(oldCapacity - rehashIndex);
+	}
+}
+
+//returns the first position in [p, end) holding a or b, or end; compares 16 bytes at a time with SSE2
+static const char* scanFor(const char *p, const char *end, char a, char b) {
+#ifdef __SSE2__
+	__m128i va = _mm_set1_epi8(a);
+	__m128i vb = _mm_set1_epi8(b);
+	while (end - p >= 16) {
+		__m128i chunk = _mm_loadu_si128((const __m128i*)p);
+		unsigned int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, va), _mm_cmpeq_epi8(chunk, vb)));
+		if (mask != 0) {
+			return p + __builtin_ctz(mask);
+		}
+		p += 16;
+	}
+#endif
+	while (p < end && *p != a && *p != b) {
+		p++;
+	}
+	return p;
+}
+
+//returns the end of the line starting at p, or end if it is the last one
+static const char* lineEnd(const char *p, const char *end) {
+	const char *newline = (const char*)memchr(p, '\n', end - p);
+	return newline != nullptr ? newline : end;
+}
+
+//drops the '\r' a CRLF file leaves in front of the newline
+static const char* trimCR(const char *begin, const char *stop) {
+	return (stop > begin && stop[-1] == '\r') ? stop - 1 : stop;
+}
+
+//returns the statistics of the most recent import
+ImportStats HashTable::getImportStats() {
+	return importStats;
+}
+
+//returns the stages of the most recent manifest import
+PipelineStats HashTable::getPipelineStats() {
+	return pipelineStats;
+}
+
+//sets how many threads import() parses and builds with; 1 keeps the sequential path
+void HashTable::setImportThreads(unsigned int threads) {
+	this->importThreads = threads > 0 ? threads : 1;
+}
+
+//returns the number of threads import() uses
+unsigned int HashTable::getImportThreads() {
+	return importThreads;
+}
+
+//a dictionary file mapped into memory, or read into a buffer where it cannot be mapped
+struct MappedFile {
+	const char *data;
+	size_t length;
+	void *mapping;
+	string buffer;
+	MappedFile() : data(nullptr), length(0), mapping(MAP_FAILED) {}
+	//returns false if the file cannot be opened
+	bool open(const string& path) {
+		int fd = ::open(path.c_str(), O_RDONLY);
+		if (fd < 0) {
+			return false;
+		}
+		struct stat info;
+		length = fstat(fd, &info) == 0 ? info.st_size : 0;
+		//map the whole file; the records are parsed straight out of the mapping
+		mapping = length > 0 ? mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+		if (mapping != MAP_FAILED) {
+			//the file is read front to back exactly once
+			madvise(mapping, length, MADV_SEQUENTIAL);
+			data = (const char*)mapping;
+		}
+		else {
+			//pipes and other unmappable files are read into memory instead
+			ifstream file(path, ios::binary);
+			buffer.assign(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+			data = buffer.data();
+			length = buffer.size();
+		}
+		close(fd);
+		return true;
+	}
+	~MappedFile() {
+		if (mapping != MAP_FAILED) {
+			munmap(mapping, length);
+		}
+	}
+};
+
+//calls record(word, wordLength, meanings, meaningsLength) for every "word:meanings" line in [p, end)
+template<class Record>
+static void forEachRecord(const char *p, const char *end, const Record &record) {
+	while (p < end) {
+		//find the colon separator, or the end of a line that has none
+		const char *colon = scanFor(p, end, ':', '\n');
+		if (colon == end || *colon == '\n') {
+			p = colon + 1;
+			continue;
+		}
+		const char *eol = lineEnd(colon + 1, end);
+		record(p, colon - p, colon + 1, trimCR(colon + 1, eol) - (colon + 1));
+		p = eol + 1;
+	}
+}
+
+//prints the throughput of the import that just finished
+static void printImportStats(const ImportStats &stats) {
+	double seconds = stats.seconds > 0 ? stats.seconds : 1e-9;
+	cout << "Imported " << stats.bytes << " bytes in " << fixed << setprecision(3) << stats.seconds << " s ("
+		<< setprecision(0) << stats.lines / seconds << " lines/s, "
+		<< setprecision(1) << stats.bytes / seconds / 1e6 << " MB/s";
+	if (stats.threads > 1) {
+		cout << ", " << stats.threads << " threads";
+	}
+	cout << ")." << '\n';
+	cout.unsetf(ios::floatfield);
+	cout << setprecision(6);
+}
+
+//imports entries from a file at the given path; false if nothing could be imported
+bool HashTable::import(string path) {
+
+	//check if user didn't enter file name
+	if (path.empty()) {
+		cout << "Please provide the file name you wish to import from." << '\n';
+		return false;
+	}
+	//large imports are spread over the configured threads
+	if (importThreads > 1) {
+		return importParallel(vector<string>(1, path));
+	}
+
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	MappedFile file;
+	//check if file opened successfully 
+	if (!file.open(path)) {
+		cout << "Could not open the file." << '\n';
+		return false;
+	}
+
+	const char *data = file.data;
+	const char *end = data + file.length;
+	//read the first line to get the language
+	const char *eol = lineEnd(data, end);
+	if (file.length == 0) {
+		cout << "Could not find the language." << '\n';
+		return false;
+	}
+	string language(data, trimCR(data, eol) - data);
+	//the language is interned once for the whole file
+	materialize();
+	unsigned short languageId = store.internLanguage(language);
+
+	int linesProcessed = 0;
+
+	//insert each remaining line without copying the word and its meanings out of the file first;
+	//a file that is only the language line has none
+	const char *body = eol < end ? eol + 1 : end;
+	forEachRecord(body, end, [&](const char *word, size_t wordLength, const char *meanings, size_t meaningsLength) {
+		insertRecord(word, wordLength, meanings, meaningsLength, languageId);
+		linesProcessed++;
+	});
+
+	//confirmation message
+	cout << linesProcessed << " " << language << " words have been imported successfully." << '\n';
+
+	//report the throughput of this import
+	importStats.lines = linesProcessed;
+	importStats.bytes = file.length;
+	importStats.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	importStats.threads = 1;
+	STAT_ADD(STAT_IMPORT_LINES, importStats.lines);
+	STAT_ADD(STAT_IMPORT_BYTES, importStats.bytes);
+	STAT_ADD(STAT_IMPORT_NANOS, importStats.seconds * 1e9);
+	printImportStats(importStats);
+	return true;
+}
+
+//runs task(i) for every i in [0, count) on up to threads threads, the calling one included
+template<class Task>
+static void parallelFor(unsigned int count, unsigned int threads, const Task &task) {
+	//tasks are handed out one at a time, so uneven ones still balance
+	atomic<unsigned int> next(0);
+	auto worker = [&]() {
+		for (unsigned int i = next++; i < count; i = next++) {
+			task(i);
+		}
+	};
+	vector<thread> pool;
+	for (unsigned int t = 1; t < threads && t < count; t++) {
+		pool.push_back(thread(worker));
+	}
+	worker();
+	for (thread &t : pool) {
+		t.join();
+	}
+}
+
+//one record parsed out of a mapped file, already normalized and hashed
+struct ParsedRecord {
+	const char *word;
+	const char *meanings;
+	unsigned int wordLength;
+	unsigned int meaningsLength;
+	unsigned int keyOffset;		// case-folded word, in the chunk's key buffer
+	unsigned int keyLength;
+	unsigned int hash;
+	unsigned int file;
+	unsigned int order;			// position of the record within its chunk
+};
+
+//a run of whole lines of one file, parsed by a single thread
+struct ImportChunk {
+	unsigned int file;
+	const char *begin;
+	const char *end;
+	string keys;						// case-folded words of all records, back to back
+	vector<vector<ParsedRecord> > shards;	// records split by the shard their hash falls in
+};
+
+//chunks smaller than this are not worth a task of their own
+const size_t IMPORT_CHUNK_MIN = 1 << 16;
+
+//imports several files at once: chunks are parsed on a thread pool, records are built into
+//hash-partitioned shards that never share a key (so no lock is needed), and the shards are merged in.
+//Every word sees its records in file and line order, so the result equals importing the files one by one.
+bool HashTable::importParallel(const vector<string>& paths) {
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	materialize();
+	unsigned int threads = importThreads;
+	//more shards than threads keeps the build balanced
+	unsigned int shardCount = threads * 4;
+
+	//map every file and cut it into chunks that end on line boundaries
+	vector<MappedFile> files(paths.size());
+	vector<string> languages(paths.size());
+	vector<bool> usable(paths.size(), false);
+	vector<ImportChunk> chunks;
+	unsigned long bytes = 0;
+	for (unsigned int f = 0; f < paths.size(); f++) {
+		if (paths[f].empty()) {
+			cout << "Please provide the file name you wish to import from." << '\n';
+			continue;
+		}
+		if (!files[f].open(paths[f])) {
+			cout << "Could not open the file." << '\n';
+			continue;
+		}
+		if (files[f].length == 0) {
+			cout << "Could not find the language." << '\n';
+			continue;
+		}
+		usable[f] = true;
+		bytes += files[f].length;
+		const char *data = files[f].data;
+		const char *end = data + files[f].length;
+		//the first line holds the language
+		const char *eol = lineEnd(data, end);
+		languages[f] = string(data, trimCR(data, eol) - data);
+		const char *body = eol < end ? eol + 1 : end;
+		size_t length = end - body;
+		size_t pieces = min<size_t>(threads * 4, length / IMPORT_CHUNK_MIN + 1);
+		const char *begin = body;
+		for (size_t k = 1; k <= pieces; k++) {
+			const char *stop = end;
+			if (k < pieces) {
+				//move the cut just past the end of the line it falls in
+				stop = body + length * k / pieces;
+				stop = stop > begin ? lineEnd(stop - 1, end) : begin;
+				stop = stop < end ? stop + 1 : end;
+			}
+			if (stop > begin) {
+				ImportChunk chunk;
+				chunk.file = f;
+				chunk.begin = begin;
+				chunk.end = stop;
+				chunks.push_back(chunk);
+			}
+			begin = stop;
+		}
+	}
+
+	//parse: fold and hash every word and sort the records into shards
+	parallelFor(chunks.size(), threads, [&](unsigned int c) {
+		ImportChunk &chunk = chunks[c];
+		chunk.shards.resize(shardCount);
+		unsigned int order = 0;
+		static thread_local string raw;
+		forEachRecord(chunk.begin, chunk.end, [&](const char *word, size_t wordLength, const char *meanings, size_t meaningsLength) {
+			raw.assign(word, wordLength);
+			const string& key = foldKey(raw);
+			ParsedRecord record;
+			record.word = word;
+			record.meanings = meanings;
+			record.wordLength = wordLength;
+			record.meaningsLength = meaningsLength;
+			record.keyOffset = chunk.keys.size();
+			record.keyLength = key.size();
+			record.hash = slotHash(key);
+			record.file = chunk.file;
+			record.order = order++;
+			chunk.keys += key;
+			chunk.shards[((unsigned long)record.hash * shardCount) >> 32].push_back(record);
+		});
+	});
+
+	//languages are interned up front so every shard numbers them the same way
+	vector<unsigned short> languageIds(paths.size(), 0);
+	for (unsigned int f = 0; f < paths.size(); f++) {
+		if (usable[f]) {
+			languageIds[f] = store.internLanguage(languages[f]);
+		}
+	}
+
+	//build: each shard replays its records in file and line order into a table of its own
+	vector<HashTable*> shards(shardCount);
+	//position of the record that created each shard entry, as (chunk << 32) | order
+	vector<vector<unsigned long> > firstSeen(shardCount);
+	parallelFor(shardCount, threads, [&](unsigned int s) {
+		unsigned long records = 0;
+		for (const ImportChunk &chunk : chunks) {
+			records += chunk.shards[s].size();
+		}
+		HashTable *shard = new HashTable(records / maxLoadFactor + 1, maxLoadFactor);
+		shard->kernel = kernel;
+		shard->store.shareLanguages(store);
+		static thread_local string key;
+		for (unsigned int c = 0; c < chunks.size(); c++) {
+			const ImportChunk &chunk = chunks[c];
+			for (const ParsedRecord &record : chunk.shards[s]) {
+				key.assign(chunk.keys, record.keyOffset, record.keyLength);
+				unsigned int before = shard->store.size();
+				shard->insertHashed(key, record.hash, record.word, record.wordLength, record.meanings, record.meaningsLength, languageIds[record.file]);
+				if (shard->store.size() > before) {
+					firstSeen[s].push_back((unsigned long)c << 32 | record.order);
+				}
+			}
+		}
+		shards[s] = shard;
+	});
+
+	//count the records of every file for the confirmation messages
+	vector<unsigned long> lines(paths.size(), 0);
+	unsigned long newEntries = 0;
+	for (const ImportChunk &chunk : chunks) {
+		for (const vector<ParsedRecord> &records : chunk.shards) {
+			lines[chunk.file] += records.size();
+		}
+	}
+	for (HashTable *shard : shards) {
+		newEntries += shard->store.size();
+	}
+
+	//merge: words already in the table take the shard's translations, new words are
+	//adopted in the order their first record appeared, as a sequential import would add them
+	struct Pending { unsigned long order; unsigned int shard; unsigned int entry; unsigned int hash; };
+	vector<Pending> pending;
+	string key;
+	reserve(newEntries);
+	for (unsigned int s = 0; s < shardCount; s++) {
+		HashTable *shard = shards[s];
+		for (unsigned int i = 0; i < shard->capacity; i++) {
+			if ((shard->ctrl[i] & 0x80) != 0) {
+				continue;
+			}
+			const Slot &slot = shard->slots[i];
+			Slot *existing = nullptr;
+			if (size > 0) {
+				key = shard->store.str(shard->store.entry(slot.entry).key);
+				existing = lookup(key, slot.hash);
+			}
+			if (existing != nullptr) {
+				store.mergeTranslations(existing->entry, shard->store, slot.entry);
+			}
+			else {
+				Pending p = { firstSeen[s][slot.entry], s, slot.entry, slot.hash };
+				pending.push_back(p);
+			}
+		}
+	}
+	sort(pending.begin(), pending.end(), [](const Pending &a, const Pending &b) { return a.order < b.order; });
+	for (const Pending &p : pending) {
+		adopt(store.copyEntry(shards[p.shard]->store, p.entry), p.hash);
+	}
+	//merged records bypassed the reverse index, index everything again
+	if (reverse != nullptr) {
+		rebuildReverseIndex();
+	}
+	for (HashTable *shard : shards) {
+		delete shard;
+	}
+
+	//confirmation messages, one per file as the sequential import prints them
+	unsigned long total = 0;
+	for (unsigned int f = 0; f < paths.size(); f++) {
+		if (usable[f]) {
+			cout << lines[f] << " " << languages[f] << " words have been imported successfully." << '\n';
+			total += lines[f];
+		}
+	}
+
+	//report the throughput of this import
+	importStats.lines = total;
+	importStats.bytes = bytes;
+	importStats.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	importStats.threads = threads;
+	STAT_ADD(STAT_IMPORT_LINES, importStats.lines);
+	STAT_ADD(STAT_IMPORT_BYTES, importStats.bytes);
+	STAT_ADD(STAT_IMPORT_NANOS, importStats.seconds * 1e9);
+	printImportStats(importStats);
+	return std::find(usable.begin(), usable.end(), true) != usable.end();
+}
+
+//bytes of lines the reader hands on at a time; a longer line gets a block of its own
+const size_t PIPELINE_BLOCK = 1 << 18;
+//blocks a queue between two stages holds at most
+const unsigned int PIPELINE_DEPTH = 4;
+
+//one record of a block, by offsets into its text; the keys follow each other in record order
+struct BlockRecord {
+	unsigned int word;
+	unsigned int wordLength;
+	unsigned int meanings;
+	unsigned int meaningsLength;
+	unsigned int keyLength;
+	unsigned int hash;
+};
+
+//a run of whole lines of one file, passed from stage to stage and then reused
+struct PipelineBlock {
+	unsigned int file;
+	PodArray<char> text;
+	size_t start;						// where the records begin, past the language line
+	string keys;						// case-folded words of all records, back to back
+	vector<BlockRecord> records;
+};
+
+//queue between two stages: push waits while it is full and pop while it is empty, adding
+//the time spent waiting to the caller's statistics
+class BlockQueue {
+	private:
+		mutex lock;
+		condition_variable notEmpty;
+		condition_variable notFull;
+		deque<PipelineBlock*> blocks;
+		size_t capacity;
+		bool closed;
+	public:
+		BlockQueue(size_t capacity) : capacity(capacity), closed(false) {}
+		void push(PipelineBlock *block, double &waited) {
+			unique_lock<mutex> guard(lock);
+			if (blocks.size() >= capacity) {
+				chrono::steady_clock::time_point start = chrono::steady_clock::now();
+				notFull.wait(guard, [&]() { return blocks.size() < capacity; });
+				waited += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+			}
+			blocks.push_back(block);
+			notEmpty.notify_one();
+		}
+		//returns false once the queue is closed and empty
+		bool pop(PipelineBlock *&block, double &waited) {
+			unique_lock<mutex> guard(lock);
+			if (blocks.empty() && !closed) {
+				chrono::steady_clock::time_point start = chrono::steady_clock::now();
+				notEmpty.wait(guard, [&]() { return !blocks.empty() || closed; });
+				waited += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+			}
+			if (blocks.empty()) {
+				return false;
+			}
+			block = blocks.front();
+			blocks.pop_front();
+			notFull.notify_one();
+			return true;
+		}
+		//no more blocks will come; pop returns false once the rest are taken
+		void close() {
+			lock_guard<mutex> guard(lock);
+			closed = true;
+			notEmpty.notify_all();
+		}
+};
+
+//prints how the stages of the manifest import that just finished spent their time
+static void printPipelineStats(const PipelineStats &stats) {
+	static const char *names[STAGE_COUNT] = { "read", "parse", "insert" };
+	for (unsigned int s = 0; s < STAGE_COUNT; s++) {
+		const StageStats &stage = stats.stages[s];
+		double busy = stage.busySeconds > 0 ? stage.busySeconds : 1e-9;
+		cout << "  " << names[s] << ": " << stage.blocks << " blocks, " << fixed << setprecision(1)
+			<< stage.bytes / busy / 1e6 << " MB/s while busy " << setprecision(3) << stage.busySeconds
+			<< " s, waited " << stage.starvedSeconds << " s for input and " << stage.blockedSeconds << " s for room." << '\n';
+	}
+	cout << "  buffers: " << setprecision(1) << stats.bufferBytes / 1e6 << " MB in " << stats.blocks << " blocks." << '\n';
+	cout.unsetf(ios::floatfield);
+	cout << setprecision(6);
+}
+
+//reads the files a manifest lists into paths and languages: one file per line, as "path" when
+//its first line names the language or "language:path" when every line is a record. Blank lines
+//and lines starting with '#' are skipped; relative paths start at the manifest's directory.
+static bool readManifest(const string& manifestPath, vector<string>& paths, vector<string>& languages) {
+	ifstream manifest(manifestPath);
+	if (!manifest) {
+		return false;
+	}
+	size_t slash = manifestPath.rfind('/');
+	string directory = slash != string::npos ? manifestPath.substr(0, slash + 1) : "";
+	string line;
+	while (getline(manifest, line)) {
+		line.erase(trimCR(line.data(), line.data() + line.size()) - line.data());
+		if (line.empty() || line[0] == '#') {
+			continue;
+		}
+		size_t colon = line.find(':');
+		string path = colon != string::npos ? line.substr(colon + 1) : line;
+		languages.push_back(colon != string::npos ? line.substr(0, colon) : "");
+		paths.push_back(!path.empty() && path[0] != '/' ? directory + path : path);
+	}
+	return true;
+}
+
+//imports the files a manifest lists, streaming each through three stages that overlap: a reader
+//fills blocks of whole lines with read(), a parser folds and hashes their words, and the calling
+//thread inserts them. The queues between the stages are bounded and the blocks are reused, so
+//memory beyond the table stays the same however large the files are, and a slow stage holds the
+//ones before it back. Files are inserted in manifest order, as if imported one by one.
+//Returns false if none of the files could be imported.
+bool HashTable::importManifest(const string& manifestPath) {
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	vector<string> paths;
+	vector<string> languages;
+	if (!readManifest(manifestPath, paths, languages)) {
+		cout << "Could not open the manifest." << '\n';
+		return false;
+	}
+	materialize();
+	memset(&pipelineStats, 0, sizeof(pipelineStats));
+	StageStats *stages = pipelineStats.stages;
+
+	//every block is either free, queued, or held by one stage
+	vector<PipelineBlock> pool(2 * PIPELINE_DEPTH + STAGE_COUNT);
+	BlockQueue idle(pool.size()), parsed(PIPELINE_DEPTH), toParse(PIPELINE_DEPTH);
+	double unused = 0;
+	for (PipelineBlock &block : pool) {
+		idle.push(&block, unused);
+	}
+	//0 read, 1 could not be opened, 2 had no language line, 3 failed partway; languages the reader finds are
+	//written before the first block of their file is queued
+	vector<int> failures(paths.size(), 0);
+	vector<bool> headers(paths.size());
+	for (unsigned int f = 0; f < paths.size(); f++) {
+		headers[f] = languages[f].empty();
+	}
+
+	//read: whole lines into free blocks, the partial last line carried to the next one
+	thread reader([&]() {
+		chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+		StageStats &stage = stages[STAGE_READ];
+		string carry;
+		for (unsigned int f = 0; f < paths.size(); f++) {
+			int fd = paths[f].empty() ? -1 : ::open(paths[f].c_str(), O_RDONLY);
+			if (fd < 0) {
+				failures[f] = 1;
+				continue;
+			}
+			posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+			carry.clear();
+			off_t offset = 0;
+			bool eof = false, first = true;
+			while (!eof) {
+				PipelineBlock *block;
+				idle.pop(block, stage.blockedSeconds);
+				PodArray<char> &text = block->text;
+				text.resize(0);
+				text.append(carry.data(), carry.size());
+				//read until the block is full and holds a line end, or the file ends; the
+				//line end is kept as an offset, as reading on may move the text
+				size_t cut = 0;
+				while (!eof && (text.size() < PIPELINE_BLOCK || cut == 0)) {
+					size_t used = text.size();
+					text.resize(used + max(PIPELINE_BLOCK - min(used, PIPELINE_BLOCK), (size_t)1 << 16));
+					ssize_t got = ::read(fd, &text[used], text.size() - used);
+					if (got < 0 && errno == EINTR) {
+						text.resize(used);
+						continue;
+					}
+					text.resize(used + max(got, (ssize_t)0));
+					eof = got <= 0;
+					failures[f] = got < 0 ? 3 : 0;
+					const char *newline = got > 0 ? (const char*)memrchr(&text[used], '\n', got) : nullptr;
+					cut = newline != nullptr ? newline + 1 - text.data() : cut;
+				}
+				//the pages are in the block now, so the page cache may let them go
+				posix_fadvise(fd, offset, text.size() - carry.size(), POSIX_FADV_DONTNEED);
+				offset += text.size() - carry.size();
+				cut = !eof ? cut : text.size();
+				carry.assign(text.data() + cut, text.size() - cut);
+				text.resize(cut);
+				block->file = f;
+				block->start = 0;
+				if (first && headers[f]) {
+					//the first line holds the language
+					const char *data = text.data(), *end = data + text.size();
+					const char *eol = lineEnd(data, end);
+					if (text.size() == 0) {
+						//nothing could be read at all, or there was nothing to read
+						failures[f] = failures[f] == 3 ? 1 : 2;
+						idle.push(block, stage.blockedSeconds);
+						break;
+					}
+					languages[f] = string(data, trimCR(data, eol) - data);
+					block->start = eol < end ? eol + 1 - data : text.size();
+				}
+				first = false;
+				stage.blocks++;
+				stage.bytes += text.size();
+				toParse.push(block, stage.blockedSeconds);
+			}
+			close(fd);
+		}
+		toParse.close();
+		stage.busySeconds = chrono::duration<double>(chrono::steady_clock::now() - begin).count() - stage.blockedSeconds;
+	});
+
+	//parse: fold and hash the words of every record
+	thread parser([&]() {
+		chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+		StageStats &stage = stages[STAGE_PARSE];
+		static thread_local string raw;
+		PipelineBlock *block;
+		while (toParse.pop(block, stage.starvedSeconds)) {
+			block->keys.clear();
+			block->records.clear();
+			const char *text = block->text.data();
+			forEachRecord(text + block->start, text + block->text.size(),
+				[&](const char *word, size_t wordLength, const char *meanings, size_t meaningsLength) {
+				raw.assign(word, wordLength);
+				const string& key = foldKey(raw);
+				BlockRecord record;
+				record.word = word - text;
+				record.wordLength = wordLength;
+				record.meanings = meanings - text;
+				record.meaningsLength = meaningsLength;
+				record.keyLength = key.size();
+				record.hash = slotHash(key);
+				block->keys += key;
+				block->records.push_back(record);
+			});
+			stage.blocks++;
+			stage.bytes += block->text.size();
+			parsed.push(block, stage.blockedSeconds);
+		}
+		parsed.close();
+		stage.busySeconds = chrono::duration<double>(chrono::steady_clock::now() - begin).count()
+			- stage.starvedSeconds - stage.blockedSeconds;
+	});
+
+	//insert: in file and line order, on this thread, the only one that changes the table
+	chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+	StageStats &stage = stages[STAGE_INSERT];
+	vector<int> languageIds(paths.size(), -1);
+	vector<unsigned long> lines(paths.size(), 0);
+	string key;
+	PipelineBlock *block;
+	while (parsed.pop(block, stage.starvedSeconds)) {
+		if (languageIds[block->file] < 0) {
+			languageIds[block->file] = store.internLanguage(languages[block->file]);
+		}
+		unsigned short languageId = languageIds[block->file];
+		const char *text = block->text.data();
+		size_t keyOffset = 0;
+		for (const BlockRecord &record : block->records) {
+			key.assign(block->keys, keyOffset, record.keyLength);
+			keyOffset += record.keyLength;
+			insertHashed(key, record.hash, text + record.word, record.wordLength, text + record.meanings, record.meaningsLength, languageId);
+		}
+		lines[block->file] += block->records.size();
+		stage.blocks++;
+		stage.bytes += block->text.size();
+		idle.push(block, stage.blockedSeconds);
+	}
+	stage.busySeconds = chrono::duration<double>(chrono::steady_clock::now() - begin).count() - stage.starvedSeconds;
+	reader.join();
+	parser.join();
+
+	//confirmation messages, one per file as import prints them
+	unsigned long total = 0, bytes = 0;
+	for (unsigned int f = 0; f < paths.size(); f++) {
+		if (failures[f] == 1) {
+			cout << "Could not open the file " << paths[f] << "." << '\n';
+		}
+		else if (failures[f] == 2) {
+			cout << "Could not find the language of " << paths[f] << "." << '\n';
+		}
+		else {
+			if (failures[f] == 3) {
+				cout << "Could not read all of " << paths[f] << "." << '\n';
+			}
+			cout << lines[f] << " " << languages[f] << " words have been imported successfully." << '\n';
+			pipelineStats.files++;
+			total += lines[f];
+		}
+	}
+	bytes = stages[STAGE_READ].bytes;
+	pipelineStats.blocks = pool.size();
+	for (const PipelineBlock &block : pool) {
+		pipelineStats.bufferBytes += block.text.bytes() + block.keys.capacity() + block.records.capacity() * sizeof(BlockRecord);
+	}
+
+	//report the throughput of this import
+	importStats.lines = total;
+	importStats.bytes = bytes;
+	importStats.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	importStats.threads = STAGE_COUNT;
+	STAT_ADD(STAT_IMPORT_LINES, importStats.lines);
+	STAT_ADD(STAT_IMPORT_BYTES, importStats.bytes);
+	STAT_ADD(STAT_IMPORT_NANOS, importStats.seconds * 1e9);
+	printImportStats(importStats);
+	printPipelineStats(pipelineStats);
+	return pipelineStats.files > 0;
+}
+
+//inserts a new word with its meanings and language into the hashtable
+EditResult HashTable::insert(const string& word, const string& meanings, const string& language) {
+	STAT_TIME(STAT_INSERT_NANOS);
+	STAT_ADD(STAT_INSERTS, 1);
+
+	//validate user input
+	if (word.empty() || meanings.empty() || language.empty()) {
+		return EDIT_MISSING_INPUT;
+	}
+	materialize();
+	insertRecord(word.data(), word.size(), meanings.data(), meanings.size(), store.internLanguage(language));
+	maintain();
+	return EDIT_DONE;
+}
+
+//inserts a record whose word and meanings may point into a mapped file
+void HashTable::insertRecord(const char *word, size_t wordLength, const char *meanings, size_t meaningsLength, unsigned short language) {
+	//a snapshot is read-only, the first change copies it into owned storage
+	materialize();
+	//normalize and hash the word once for the whole operation
+	static thread_local string raw;
+	raw.assign(word, wordLength);
+	const string& key = foldKey(raw);
+	insertHashed(key, slotHash(key), word, wordLength, meanings, meaningsLength, language);
+}
+
+//inserts a record whose case-folded key and slot hash are already known
+void HashTable::insertHashed(const string& key, unsigned int hash, const char *word, size_t wordLength, const char *meanings, size_t meaningsLength, unsigned short language) {
+	//an existing word only gains a translation, wherever it currently lives
+	Slot* slot = lookup(key, hash);
+	if (slot != nullptr) {
+		//meanings are appended, so the ones past the old count are the new ones
+		int t = reverse != nullptr ? store.findTranslation(slot->entry, language) : -1;
+		unsigned int before = t >= 0 ? store.translation(store.entry(slot->entry), t).meaningCount : 0;
+		store.addTranslation(slot->entry, meanings, meaningsLength, language);
+		if (reverse != nullptr) {
+			indexMeanings(slot->entry, store.findTranslation(slot->entry, language), before, true);
+		}
+		return;
+	}
+	unsigned int entry = store.addEntry(word, wordLength, key, meanings, meaningsLength, language);
+	if (reverse != nullptr) {
+		indexMeanings(entry, 0, 0, true);
+	}
+	adopt(entry, hash);
+}
+
+//gives a stored entry, whose key is known not to be in the table yet, a slot
+void HashTable::adopt(unsigned int entry, unsigned int hash) {
+	//grow before the new entry would push the table past its load factor ceiling, unless mostly
+	//tombstones fill it: then a rehash at the same capacity clears them out instead
+	if (used + 1 > maxLoadFactor * capacity) {
+		if (size + 1 <= maxLoadFactor * capacity / 2) {
+			resize(capacity);
+		}
+		else {
+			grow();
+		}
+	}
+
+	//the new entry takes the first empty slot or tombstone of its probe sequence
+	unsigned int distance;
+	unsigned int index = freeSlot(ctrl, capacity, hash, distance);
+	//only a previously empty slot raises the load; a reused tombstone releases what its entry still holds
+	if (ctrl[index] == CTRL_EMPTY) {
+		used++;
+	}
+	else {
+		store.release(slots[index].entry);
+		tombstones--;
+	}
+	//every occupied slot passed on the way counts as a collision
+	collisions += distance;
+	probeHistogram[distance < PROBE_HISTOGRAM_SIZE ? distance : PROBE_HISTOGRAM_SIZE - 1]++;
+	//the payload is stored once and referenced by index
+	slots[index].hash = hash;
+	slots[index].entry = entry;
+	setCtrl(ctrl, capacity, index, h2Of(hash));
+	//every new word, inserted or merged in by a parallel import, passes through here
+	if (trie != nullptr) {
+		StrRef key = store.entry(entry).key;
+		trie->insert(store.text(key), key.length, entry);
+	}
+	//increase total number of stored entries
+	size++;
+}
+
+//delete a word entirely from the dictionary
+EditResult HashTable::delWord(const string& word) {
+	STAT_TIME(STAT_DELETE_NANOS);
+	STAT_ADD(STAT_DELETES, 1);
+	//validate user input
+	if (word.empty()) {
+		return EDIT_MISSING_INPUT;
+	}
+
+	//locate the word by its normalized key
+	materialize();
+	const string& key = foldKey(word);
+	Slot* slot = lookup(key, slotHash(key));
+	//if no live entry is found, word does not exist
+	if (slot == nullptr) {
+		return EDIT_NO_WORD;
+	}
+	//drop its meanings from the reverse index, then mark the slot deleted and decrement size
+	for (unsigned int t = 0; reverse != nullptr && t < store.entry(slot->entry).translationCount; t++) {
+		indexMeanings(slot->entry, t, 0, false);
+	}
+	remove(slot);
+	maintain();
+	return EDIT_DONE;
+}
+
+//delete a translation of a word in a specific language, and the word with its last translation
+EditResult HashTable::delTranslation(const string& word, const string& language) {
+	STAT_TIME(STAT_DELETE_NANOS);
+	STAT_ADD(STAT_DELETES, 1);
+	//check if either word or language input is empty
+	if (word.empty() || language.empty()) {
+		return EDIT_MISSING_INPUT;
+	}
+
+	//locate the word by its normalized key
+	materialize();
+	const string& key = foldKey(word);
+	Slot* slot = lookup(key, slotHash(key));
+	//if the word was never found in the probing sequence
+	if (slot == nullptr) {
+		return EDIT_NO_WORD;
+	}
+
+	//languages are compared case-insensitively by their interned ids
+	int languageId = store.findLanguage(language);
+	int t = languageId >= 0 ? store.findTranslation(slot->entry, languageId) : -1;
+	if (t < 0) {
+		return EDIT_NO_LANGUAGE;
+	}
+	//remove the translation from the list, and its meanings from the reverse index
+	if (reverse != nullptr) {
+		indexMeanings(slot->entry, t, 0, false);
+	}
+	store.eraseTranslation(slot->entry, t);
+	//if the word now has no translations, mark the slot as deleted
+	if (store.entry(slot->entry).translationCount == 0) {
+		remove(slot);
+	}
+	maintain();
+	return EDIT_DONE;
+}
+
+//delete a specific meaning of a word in a certain language; an emptied translation goes with it, and an emptied word too
+EditResult HashTable::delMeaning(const string& word, const string& meaning, const string& language) {
+	STAT_TIME(STAT_DELETE_NANOS);
+	STAT_ADD(STAT_DELETES, 1);
+	//check if any of the input fields are empty
+	if (word.empty() || language.empty() || meaning.empty()) {
+		return EDIT_MISSING_INPUT;
+	}
+
+	//probe through the table by the normalized key
+	materialize();
+	const string& key = foldKey(word);
+	Slot* slot = lookup(key, slotHash(key));
+	if (slot == nullptr) {
+		return EDIT_NO_WORD;
+	}
+
+	//find the translation in the given language
+	int languageId = store.findLanguage(language);
+	int j = languageId >= 0 ? store.findTranslation(slot->entry, languageId) : -1;
+	if (j < 0) {
+		return EDIT_NO_LANGUAGE;
+	}
+	//search for the specific meaning to delete
+	int m = store.findMeaning(slot->entry, j, meaning);
+	if (m < 0) {
+		return EDIT_NO_MEANING;
+	}
+	//remove the meaning, from the reverse index too
+	if (reverse != nullptr) {
+		StrRef ref = store.meaning(store.translation(store.entry(slot->entry), j), m);
+		reverse->remove(meaningKey(store.text(ref), ref.length, languageId), slot->entry);
+	}
+	store.eraseMeaning(slot->entry, j, m);
+
+	//if no meanings remain, remove the entire translation
+	const Entry& entry = store.entry(slot->entry);
+	if (store.translation(entry, j).meaningCount == 0) {
+		store.eraseTranslation(slot->entry, j);
+	}
+	//if no translations remain, mark the slot as deleted
+	if (entry.translationCount == 0) {
+		remove(slot);
+	}
+	maintain();
+	return EDIT_DONE;
+}
+
+//bytes an export gathers before handing them to its file in one write
+const size_t EXPORT_BUFFER = 1 << 20;
+
+//writes all of buffer to a file descriptor; false on an error
+static bool writeAll(int fd, const string& buffer) {
+	size_t done = 0;
+	while (done < buffer.size()) {
+		ssize_t written = ::write(fd, buffer.data() + done, buffer.size() - done);
+		if (written < 0 && errno == EINTR) {
+			continue;
+		}
+		if (written < 0) {
+			return false;
+		}
+		done += written;
+	}
+	return true;
+}
+
+//writes the words of one language with their meanings to a file and returns the records written,
+//or -1 if the file could not be written. Only the entries in the language's member list are
+//visited, and lines are gathered in a buffer so the file sees one write per EXPORT_BUFFER bytes.
+long HashTable::writeLanguage(const string& language, int languageId, const vector<unsigned long> *members, const string& filePath) const {
+	int fd = open(filePath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0) {
+		return -1;
+	}
+	string buffer;
+	buffer.reserve(EXPORT_BUFFER + 4096);
+	//the language as given goes on the first line
+	buffer.append(language).append(1, '\n');
+	long count = 0;
+	bool ok = true;
+	for (size_t w = 0; members != nullptr && w < members->size() && ok; w++) {
+		for (unsigned long bits = (*members)[w]; bits != 0; bits &= bits - 1) {
+			unsigned int i = w * 64 + __builtin_ctzl(bits);
+			const Entry& entry = store.entry(i);
+			const Translation& T = store.translation(entry, store.findTranslation(i, languageId));
+			//the word, a colon, then the meanings separated by semicolons
+			buffer.append(store.text(entry.word), entry.word.length).append(1, ':');
+			for (unsigned int j = 0; j < T.meaningCount; j++) {
+				StrRef meaning = store.meaning(T, j);
+				if (j > 0) {
+					buffer += ';';
+				}
+				buffer.append(store.text(meaning), meaning.length);
+			}
+			buffer += '\n';
+			count++;
+		}
+		if (buffer.size() >= EXPORT_BUFFER) {
+			ok = writeAll(fd, buffer);
+			buffer.clear();
+		}
+	}
+	ok = ok && writeAll(fd, buffer);
+	ok = close(fd) == 0 && ok;
+	return ok ? count : -1;
+}
+
+//exports every word that has a translation in a language, with its meanings, to a file;
+//returns the records written, or -1 if the file could not be written
+long HashTable::exportData(const string& language, const string& filePath) {
+	vector<ExportTarget> targets(1);
+	targets[0].language = language;
+	targets[0].path = filePath;
+	exportLanguages(targets, 1);
+	return targets[0].records;
+}
+
+//exports several languages at once, each to its own file, on up to threads threads
+void HashTable::exportLanguages(vector<ExportTarget>& targets, unsigned int threads) {
+	//member lists are fetched (and rebuilt after a snapshot load) before any worker starts;
+	//a language no entry uses exports just its name
+	vector<int> ids(targets.size());
+	vector<const vector<unsigned long>*> lists(targets.size(), nullptr);
+	for (size_t i = 0; i < targets.size(); i++) {
+		ids[i] = store.findLanguage(targets[i].language);
+		if (ids[i] >= 0) {
+			lists[i] = &store.languageMembers(ids[i]);
+		}
+	}
+	parallelFor(targets.size(), threads, [&](unsigned int i) {
+		targets[i].records = writeLanguage(targets[i].language, ids[i], lists[i], targets[i].path);
+	});
+}
+
+//first bytes of a snapshot file; every section starts at a multiple of 8 bytes and holds the
+//store's records exactly as they are laid out in memory, so a mapped file is used in place
+struct SnapshotHeader
+{
+	char magic[8];									// SNAPSHOT_MAGIC
+	unsigned int version;							// SNAPSHOT_VERSION
+	unsigned int headerSize;						// sizeof(SnapshotHeader) of the writer
+	unsigned long fileSize;							// the whole file, to catch truncation
+	unsigned int hashCheck;							// slotHash of a fixed word and the reduction ID, to catch other hash policies
+	unsigned int capacity;							// slots in the bucket layout
+	unsigned int size;								// entries, all of them live
+	unsigned int translationCount;
+	unsigned long meaningCount;
+	unsigned long poolSize;							// bytes of the string pool
+	unsigned int languageCount;
+	unsigned int collisions;						// probe statistics of the stored layout
+	unsigned long ctrlOffset;						// capacity + CTRL_MIRROR control bytes
+	unsigned long slotsOffset;						// capacity slots
+	unsigned long entriesOffset;					// size Entry records
+	unsigned long translationsOffset;				// translationCount Translation records
+	unsigned long meaningsOffset;					// meaningCount StrRef records
+	unsigned long languagesOffset;					// languageCount StrRef records, the names by id
+	unsigned long poolOffset;						// poolSize bytes of string data
+	unsigned int probeHistogram[PROBE_HISTOGRAM_SIZE];
+	unsigned long bodyChecksum;						// everything after the header
+	unsigned long headerChecksum;					// every header field above
+};
+
+const char SNAPSHOT_MAGIC[8] = "MLDSNAP";
+const unsigned int SNAPSHOT_VERSION = 2;
+
+//a snapshot file mapped read-only; the table's ctrl and slots and the store's arrays point into it
+struct Snapshot
+{
+	void *mapping;
+	size_t length;
+};
+
+//continues a 64-bit checksum over a buffer whose length is a multiple of 8; every step is
+//invertible, so changing, dropping or reordering any word changes the result
+static unsigned long checksum(const char *data, size_t length, unsigned long sum) {
+	for (size_t i = 0; i + 8 <= length; i += 8) {
+		unsigned long word;
+		memcpy(&word, data + i, 8);
+		sum = (sum ^ word) * 0x100000001b3UL;
+		sum ^= sum >> 29;
+	}
+	return sum;
+}
+
+//checksum of the header fields in front of the checksum itself
+static unsigned long headerChecksum(const SnapshotHeader &header) {
+	return checksum((const char*)&header, offsetof(SnapshotHeader, headerChecksum), 0xcbf29ce484222325UL);
+}
+
+//fsyncs the directory a path is in, so a rename into it survives a crash; false if it could not
+static bool syncDirectory(const string &path) {
+	size_t slash = path.rfind('/');
+	string directory = slash == string::npos ? "." : slash == 0 ? "/" : path.substr(0, slash);
+	int fd = open(directory.c_str(), O_RDONLY);
+	if (fd < 0) {
+		return false;
+	}
+	bool synced = fsync(fd) == 0;
+	close(fd);
+	return synced;
+}
+
+//writes the whole table to a binary snapshot: bucket layout, entry, translation and meaning
+//records, and the string pool they point into. importSnapshot maps it back without parsing.
+bool HashTable::exportSnapshot(string filePath) {
+	if (filePath.empty()) {
+		cout << "Please provide the file name you wish to save the snapshot to." << '\n';
+		return false;
+	}
+	materialize();
+	//the layout written is the new table's, so a pending rehash is completed first
+	finishRehash();
+
+	//live entries are copied densely into a fresh store, leaving tombstones and garbage behind
+	EntryStore compact;
+	vector<unsigned int> renumbered;
+	copyLive(compact, renumbered);
+	//language names go to the end of the pool
+	vector<StrRef> languageNames;
+	for (const string &language : compact.languages) {
+		languageNames.push_back(compact.addString(language.data(), language.size()));
+	}
+
+	//rebuild the bucket layout for the dense numbering, with no tombstones left on the probe paths
+	SnapshotHeader header;
+	memset(&header, 0, sizeof(header));
+	unsigned char *layoutCtrl = newCtrl(capacity);
+	vector<Slot> layoutSlots(capacity);
+	memset(&layoutSlots[0], 0, capacity * sizeof(Slot));
+	layOut(renumbered, layoutCtrl, layoutSlots.data(), header.collisions, header.probeHistogram);
+
+	//written next to the target and renamed over it, so a crash never leaves half a snapshot behind
+	string tmpPath = filePath + ".tmp";
+	ofstream out(tmpPath, ios::binary);
+	if (!out.is_open()) {
+		delete[] layoutCtrl;
+		cout << "Could not open the required file for writing." << '\n';
+		return false;
+	}
+	out.write((const char*)&header, sizeof(header));
+	unsigned long offset = sizeof(header);
+	unsigned long sum = 0xcbf29ce484222325UL;
+	//writes one section padded to 8 bytes and returns where it starts
+	auto section = [&](const void *data, size_t bytes) {
+		unsigned long start = offset;
+		out.write((const char*)data, bytes);
+		sum = checksum((const char*)data, bytes & ~(size_t)7, sum);
+		char tail[8] = { 0 };
+		if (bytes & 7) {
+			memcpy(tail, (const char*)data + (bytes & ~(size_t)7), bytes & 7);
+			out.write(tail + (bytes & 7), 8 - (bytes & 7));
+			sum = checksum(tail, 8, sum);
+		}
+		offset += (bytes + 7) & ~(size_t)7;
+		return start;
+	};
+	header.ctrlOffset = section(layoutCtrl, capacity + CTRL_MIRROR);
+	header.slotsOffset = section(layoutSlots.data(), capacity * sizeof(Slot));
+	header.entriesOffset = section(compact.entries.data(), compact.entries.size() * sizeof(Entry));
+	header.translationsOffset = section(compact.translations.data(), compact.translations.size() * sizeof(Translation));
+	header.meaningsOffset = section(compact.meanings.data(), compact.meanings.size() * sizeof(StrRef));
+	header.languagesOffset = section(languageNames.data(), languageNames.size() * sizeof(StrRef));
+	header.poolOffset = section(compact.pool.data(), compact.pool.size());
+	delete[] layoutCtrl;
+
+	memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+	header.version = SNAPSHOT_VERSION;
+	header.headerSize = sizeof(header);
+	header.fileSize = offset;
+	header.hashCheck = slotHash("snapshot") ^ SlotReduce::ID;
+	header.capacity = capacity;
+	header.size = compact.entries.size();
+	header.translationCount = compact.translations.size();
+	header.meaningCount = compact.meanings.size();
+	header.languageCount = languageNames.size();
+	header.poolSize = compact.pool.size();
+	header.bodyChecksum = sum;
+	header.headerChecksum = headerChecksum(header);
+	out.seekp(0);
+	out.write((const char*)&header, sizeof(header));
+	out.close();
+	//the bytes must be on disk before the rename makes them the snapshot; a mutation log
+	//may drop the changes it covers once it is in place
+	int fd = open(tmpPath.c_str(), O_RDONLY);
+	bool synced = fd >= 0 && fsync(fd) == 0;
+	if (fd >= 0) {
+		close(fd);
+	}
+	if (!out || !synced || rename(tmpPath.c_str(), filePath.c_str()) != 0) {
+		::remove(tmpPath.c_str());
+		cout << "Could not write the snapshot to " << filePath << '\n';
+		return false;
+	}
+	//and the rename itself, or a crash could still bring back the old snapshot after the log is gone
+	if (!syncDirectory(filePath)) {
+		cout << "Could not make the snapshot at " << filePath << " durable." << '\n';
+		return false;
+	}
+	//confirmation message
+	cout << header.size << " words have been saved to " << filePath << " (" << header.fileSize << " bytes)." << '\n';
+	return true;
+}
+
+//returns why a mapped file is not a usable snapshot, or nullptr if it is one
+static const char* checkSnapshot(const char *data, size_t length, unsigned int hashCheck) {
+	if (length < sizeof(SnapshotHeader)) return "too short for a header";
+	SnapshotHeader header;
+	memcpy(&header, data, sizeof(header));
+	if (memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) != 0) return "not a snapshot";
+	if (header.version != SNAPSHOT_VERSION || header.headerSize != sizeof(header)) return "unsupported version";
+	if (header.headerChecksum != headerChecksum(header)) return "header checksum mismatch";
+	if (header.fileSize != length) return "truncated or extended file";
+	if (header.hashCheck != hashCheck) return "written with a different hash function or slot reduction";
+	//every section must lie inside the file
+	unsigned long ends[] = {
+		header.ctrlOffset + header.capacity + CTRL_MIRROR,
+		header.slotsOffset + (unsigned long)header.capacity * sizeof(Slot),
+		header.entriesOffset + (unsigned long)header.size * sizeof(Entry),
+		header.translationsOffset + (unsigned long)header.translationCount * sizeof(Translation),
+		header.meaningsOffset + header.meaningCount * sizeof(StrRef),
+		header.languagesOffset + (unsigned long)header.languageCount * sizeof(StrRef),
+		header.poolOffset + header.poolSize
+	};
+	for (unsigned long end : ends) {
+		if (end > length) return "section out of range";
+	}
+	if (header.capacity <= CTRL_MIRROR || header.size > header.capacity) return "bad bucket layout";
+	//one pass over the body; cheap next to parsing, and it catches any damaged byte
+	if (checksum(data + sizeof(header), length - sizeof(header), 0xcbf29ce484222325UL) != header.bodyChecksum) return "checksum mismatch";
+	return nullptr;
+}
+
+//returns the header checksum of a snapshot file, which names its contents, or 0 if the file
+//has no valid snapshot header. Only the header is read; the body is checked when it is loaded.
+unsigned long HashTable::snapshotId(const string& path) {
+	SnapshotHeader header;
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0) {
+		return 0;
+	}
+	bool complete = read(fd, &header, sizeof(header)) == (ssize_t)sizeof(header);
+	close(fd);
+	if (!complete || memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) != 0 || header.version != SNAPSHOT_VERSION
+		|| header.headerChecksum != headerChecksum(header)) {
+		return 0;
+	}
+	return header.headerChecksum;
+}
+
+//replaces the table with a snapshot mapped from disk. Lookups read the mapping directly,
+//so the table is usable at once; the first change copies it into owned storage.
+bool HashTable::importSnapshot(string path) {
+	if (path.empty()) {
+		cout << "Please provide the snapshot file you wish to load." << '\n';
+		return false;
+	}
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0) {
+		cout << "Could not open the file." << '\n';
+		return false;
+	}
+	struct stat info;
+	size_t length = fstat(fd, &info) == 0 ? info.st_size : 0;
+	void *mapping = length > 0 ? mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+	close(fd);
+	if (mapping == MAP_FAILED) {
+		cout << path << " could not be mapped." << '\n';
+		return false;
+	}
+	const char *data = (const char*)mapping;
+	const char *problem = checkSnapshot(data, length, slotHash("snapshot") ^ SlotReduce::ID);
+	if (problem != nullptr) {
+		munmap(mapping, length);
+		cout << path << " is not a valid snapshot (" << problem << ")." << '\n';
+		return false;
+	}
+	SnapshotHeader header;
+	memcpy(&header, data, sizeof(header));
+
+	//drop whatever the table held before
+	store.clear();
+	if (snapshot != nullptr) {
+		releaseSnapshot();
+	}
+	else {
+		delete[] ctrl;
+		delete[] slots;
+	}
+	delete[] oldCtrl;
+	delete[] oldSlots;
+	oldCtrl = nullptr;
+	oldSlots = nullptr;
+	oldCapacity = 0;
+	rehashIndex = 0;
+
+	snapshot = new Snapshot;
+	snapshot->mapping = mapping;
+	snapshot->length = length;
+	//the arrays are used in place; nothing writes to them before materialize()
+	store.pool.borrow(data + header.poolOffset, header.poolSize);
+	store.entries.borrow((const Entry*)(data + header.entriesOffset), header.size);
+	store.translations.borrow((const Translation*)(data + header.translationsOffset), header.translationCount);
+	store.meanings.borrow((const StrRef*)(data + header.meaningsOffset), header.meaningCount);
+	//language member lists are not part of the file; they are built when first needed
+	store.forgetMembers();
+	const StrRef *languageNames = (const StrRef*)(data + header.languagesOffset);
+	for (unsigned int i = 0; i < header.languageCount; i++) {
+		store.internLanguage(store.str(languageNames[i]));
+	}
+	ctrl = (unsigned char*)(data + header.ctrlOffset);
+	slots = (Slot*)(data + header.slotsOffset);
+	capacity = header.capacity;
+	size = header.size;
+	used = header.size;
+	tombstones = 0;
+	collisions = header.collisions;
+	probeHistogram.assign(header.probeHistogram, header.probeHistogram + PROBE_HISTOGRAM_SIZE);
+	//the reverse index and the trie are not part of a snapshot, they are rebuilt from the loaded entries
+	if (reverse != nullptr) {
+		rebuildReverseIndex();
+	}
+	if (trie != nullptr) {
+		rebuildTrie();
+	}
+
+	double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	cout << size << " words have been loaded from " << path << " in " << fixed << setprecision(3) << seconds * 1000 << " ms." << '\n';
+	cout.unsetf(ios::floatfield);
+	cout << setprecision(6);
+	return true;
+}
+
+//copies every live entry, in order, into a fresh store and records the number each one gets
+void HashTable::copyLive(EntryStore& dense, vector<unsigned int>& renumbered) const {
+	dense.shareLanguages(store);
+	renumbered.assign(store.size(), 0);
+	for (unsigned int i = 0; i < store.size(); i++) {
+		if (!store.entry(i).deleted) {
+			renumbered[i] = dense.copyEntry(store, i);
+		}
+	}
+}
+
+//places the live slots of the current table, renumbered, into an empty table of the same
+//capacity, with no tombstones left on the probe paths, counting collisions as it goes
+void HashTable::layOut(const vector<unsigned int>& renumbered, unsigned char *layoutCtrl, Slot *layoutSlots, unsigned int &layoutCollisions, unsigned int *histogram) {
+	for (unsigned int i = 0; i < capacity; i++) {
+		if ((ctrl[i] & 0x80) == 0) {
+			unsigned int distance;
+			unsigned int index = freeSlot(layoutCtrl, capacity, slots[i].hash, distance);
+			layoutSlots[index].hash = slots[i].hash;
+			layoutSlots[index].entry = renumbered[slots[i].entry];
+			setCtrl(layoutCtrl, capacity, index, h2Of(slots[i].hash));
+			layoutCollisions += distance;
+			histogram[distance < PROBE_HISTOGRAM_SIZE ? distance : PROBE_HISTOGRAM_SIZE - 1]++;
+		}
+	}
+}
+
+//drops every tombstone and everything deleted entries and moved records still hold: the live
+//entries are copied densely into a fresh store and laid out again at the same capacity. Entry
+//numbers change, so the reverse index and the trie are rebuilt.
+void HashTable::compact() {
+	STAT_ADD(STAT_COMPACTIONS, 1);
+	materialize();
+	finishRehash();
+	EntryStore dense;
+	vector<unsigned int> renumbered;
+	copyLive(dense, renumbered);
+	unsigned char *layoutCtrl = newCtrl(capacity);
+	Slot *layoutSlots = new Slot[capacity];
+	collisions = 0;
+	probeHistogram.assign(PROBE_HISTOGRAM_SIZE, 0);
+	layOut(renumbered, layoutCtrl, layoutSlots, collisions, probeHistogram.data());
+	delete[] ctrl;
+	delete[] slots;
+	ctrl = layoutCtrl;
+	slots = layoutSlots;
+	used = size;
+	tombstones = 0;
+	store.swap(dense);
+	if (reverse != nullptr) {
+		rebuildReverseIndex();
+	}
+	if (trie != nullptr) {
+		rebuildTrie();
+	}
+}
+
+//runs after every change: a table whose tombstones pass their share of the slots is rehashed
+//at the same capacity (step by step in incremental mode), and a store whose garbage passes its
+//share of the bytes is compacted
+void HashTable::maintain() {
+	if (maxTombstoneRatio > 0 && oldSlots == nullptr && tombstones > maxTombstoneRatio * capacity) {
+		resize(capacity);
+	}
+	StoreStats stats = store.stats();
+	if (maxGarbageRatio > 0 && stats.garbageBytes >= COMPACT_MIN_GARBAGE && stats.garbageBytes > maxGarbageRatio * stats.writtenBytes) {
+		compact();
+	}
+}
+
+//returns true while lookups are served straight from a mapped snapshot
+bool HashTable::isSnapshotBacked() {
+	return snapshot != nullptr;
+}
+
+//copies a mapped snapshot into owned storage so the table can change
+void HashTable::materialize() {
+	if (snapshot == nullptr) {
+		return;
+	}
+	unsigned char *ownCtrl = new unsigned char[capacity + CTRL_MIRROR];
+	memcpy(ownCtrl, ctrl, capacity + CTRL_MIRROR);
+	Slot *ownSlots = new Slot[capacity];
+	memcpy(ownSlots, slots, capacity * sizeof(Slot));
+	//the records are already laid out the way the store keeps them
+	store.own();
+	releaseSnapshot();
+	ctrl = ownCtrl;
+	slots = ownSlots;
+}
+
+//unmaps the snapshot; the caller replaces ctrl and slots
+void HashTable::releaseSnapshot() {
+	munmap(snapshot->mapping, snapshot->length);
+	delete snapshot;
+	snapshot = nullptr;
+}
+
+//returns the memory the table holds; a snapshot-backed table counts only what it copied
+MemoryStats HashTable::getMemoryStats() {
+	MemoryStats stats;
+	StoreStats storeStats = store.stats();
+	stats.entries = size;
+	stats.tableBytes = snapshot != nullptr ? 0 : (unsigned long)capacity * (sizeof(Slot) + 1) + CTRL_MIRROR;
+	stats.tableBytes += (unsigned long)oldCapacity * (sizeof(Slot) + 1);
+	stats.poolBytes = storeStats.poolBytes;
+	stats.recordBytes = storeStats.recordBytes;
+	stats.garbageBytes = storeStats.garbageBytes;
+	stats.indexBytes = reverse != nullptr ? reverse->bytes() : 0;
+	stats.trieBytes = trie != nullptr ? trie->bytes() : 0;
+	return stats;
+}
+
+//counts the live entries with a translation in each language, in the order the languages were first seen
+void HashTable::getLanguageCounts(vector<pair<string, unsigned int> >& counts) {
+	counts.assign(store.languages.size(), make_pair(string(), 0u));
+	for (unsigned int i = 0; i < store.size(); i++) {
+		const Entry& entry = store.entry(i);
+		if (entry.deleted) {
+			continue;
+		}
+		for (unsigned int t = 0; t < entry.translationCount; t++) {
+			counts[store.translation(entry, t).language].second++;
+		}
+	}
+	for (unsigned int l = 0; l < counts.size(); l++) {
+		counts[l].first = store.languageName(l);
+	}
+}
+
+//hashes a meaning (compared caseless) together with its language for the reverse index
+unsigned long HashTable::meaningKey(const char *meaning, size_t length, unsigned short language) const {
+	static thread_local string folded;
+	foldCase(meaning, length, folded);
+	unsigned long hash = hashCode(folded) ^ (language + 1UL) * 0x9e3779b97f4a7c15UL;
+	//murmur3 finalizer, the index takes its bucket from the low bits
+	hash ^= hash >> 33;
+	hash *= 0xff51afd7ed558ccdUL;
+	hash ^= hash >> 33;
+	hash *= 0xc4ceb9fe1a85ec53UL;
+	hash ^= hash >> 33;
+	return hash;
+}
+
+//adds (or removes) the reverse index postings of the entry's t-th translation, from its meaning from on
+void HashTable::indexMeanings(unsigned int entry, unsigned int t, unsigned int from, bool add) {
+	const Translation& T = store.translation(store.entry(entry), t);
+	for (unsigned int m = from; m < T.meaningCount; m++) {
+		StrRef ref = store.meaning(T, m);
+		unsigned long key = meaningKey(store.text(ref), ref.length, T.language);
+		if (add) {
+			reverse->add(key, entry);
+		}
+		else {
+			reverse->remove(key, entry);
+		}
+	}
+}
+
+//indexes every meaning of every live entry from scratch
+void HashTable::rebuildReverseIndex() {
+	reverse->clear();
+	//size the index once instead of letting it double its way up
+	unsigned long postings = 0;
+	for (unsigned int i = 0; i < store.size(); i++) {
+		const Entry& entry = store.entry(i);
+		for (unsigned int t = 0; !entry.deleted && t < entry.translationCount; t++) {
+			postings += store.translation(entry, t).meaningCount;
+		}
+	}
+	reverse->reserve(postings);
+	for (unsigned int i = 0; i < store.size(); i++) {
+		const Entry& entry = store.entry(i);
+		for (unsigned int t = 0; !entry.deleted && t < entry.translationCount; t++) {
+			indexMeanings(i, t, 0, true);
+		}
+	}
+}
+
+//builds the reverse index, kept up to date by every change from then on, or drops it
+void HashTable::setReverseIndex(bool enabled) {
+	if (enabled && reverse == nullptr) {
+		reverse = new ReverseIndex();
+		rebuildReverseIndex();
+	}
+	else if (!enabled) {
+		delete reverse;
+		reverse = nullptr;
+	}
+}
+
+//returns true if reverse lookups are answered from the index
+bool HashTable::hasReverseIndex() {
+	return reverse != nullptr;
+}
+
+//collects the words that have a meaning (compared caseless) in a language, in the order they
+//were added. The index answers from its postings alone, taking two meanings with the same
+//64-bit key for the same meaning; without it every entry is checked.
+void HashTable::findReverse(const string& meaning, const string& language, vector<EntryView>& results) const {
+	results.clear();
+	int languageId = meaning.empty() ? -1 : store.findLanguage(language);
+	if (languageId < 0) {
+		return;
+	}
+	static thread_local vector<unsigned int> candidates;
+	candidates.clear();
+	if (reverse != nullptr) {
+		reverse->find(meaningKey(meaning.data(), meaning.size(), languageId), candidates);
+		//an entry with the meaning twice has two postings
+		sort(candidates.begin(), candidates.end());
+		candidates.erase(unique(candidates.begin(), candidates.end()), candidates.end());
+	}
+	for (unsigned int entry : candidates) {
+		results.push_back(EntryView(&store, entry));
+	}
+	for (unsigned int entry = 0; reverse == nullptr && entry < store.size(); entry++) {
+		int t = store.entry(entry).deleted ? -1 : store.findTranslation(entry, languageId);
+		if (t >= 0 && store.findMeaning(entry, t, meaning) >= 0) {
+			results.push_back(EntryView(&store, entry));
+		}
+	}
+}
+
+//puts the key of every live entry into the trie from scratch, then packs its nodes for walks
+void HashTable::rebuildTrie() {
+	trie->clear();
+	for (unsigned int i = 0; i < store.size(); i++) {
+		const Entry& entry = store.entry(i);
+		if (!entry.deleted) {
+			trie->insert(store.text(entry.key), entry.key.length, i);
+		}
+	}
+	trie->compact();
+}
+
+//builds the prefix trie, kept up to date by every change from then on, or drops it
+void HashTable::setPrefixIndex(bool enabled) {
+	if (enabled && trie == nullptr) {
+		trie = new Trie();
+		rebuildTrie();
+	}
+	else if (!enabled) {
+		delete trie;
+		trie = nullptr;
+	}
+}
+
+//returns true if completions are answered from the trie
+bool HashTable::hasPrefixIndex() const {
+	return trie != nullptr;
+}
+
+//collects up to k words whose normalized form starts with the normalized prefix, in byte
+//order of the normalized words. The trie walks straight to them; without it every entry is checked.
+void HashTable::complete(const string& prefix, unsigned int k, vector<EntryView>& results) const {
+	results.clear();
+	const string& key = foldKey(prefix);
+	static thread_local vector<unsigned int> entries;
+	if (trie != nullptr) {
+		trie->complete(key.data(), key.size(), k, entries);
+	}
+	else {
+		entries.clear();
+		for (unsigned int i = 0; i < store.size(); i++) {
+			StrRef stored = store.entry(i).key;
+			if (!store.entry(i).deleted && stored.length >= key.size() && memcmp(store.text(stored), key.data(), key.size()) == 0) {
+				entries.push_back(i);
+			}
+		}
+		//the k smallest keys, a key before its extensions
+		auto before = [&](unsigned int a, unsigned int b) {
+			StrRef x = store.entry(a).key;
+			StrRef y = store.entry(b).key;
+			int order = memcmp(store.text(x), store.text(y), min(x.length, y.length));
+			return order != 0 ? order < 0 : x.length < y.length;
+		};
+		unsigned int n = min((unsigned int)entries.size(), k);
+		partial_sort(entries.begin(), entries.begin() + n, entries.end(), before);
+		entries.resize(n);
+	}
+	for (unsigned int entry : entries) {
+		results.push_back(EntryView(&store, entry));
+	}
+}
+
+//collects up to count words whose normalized form is within maxDistance byte edits of the
+//normalized word, nearest first and in byte order of the normalized words among equals. The
+//trie is walked with a bit-parallel distance column and left where it cannot get close
+//enough; without it every entry is measured. Words longer than LEVENSHTEIN_MAX bytes get none.
+void HashTable::suggest(const string& word, unsigned int maxDistance, unsigned int count, vector<Suggestion>& suggestions) const {
+	suggestions.clear();
+	const string& key = foldKey(word);
+	if (key.empty() || key.size() > LEVENSHTEIN_MAX) {
+		return;
+	}
+	static thread_local vector<pair<unsigned int, unsigned int> > matches;
+	if (trie != nullptr) {
+		trie->fuzzy(key.data(), key.size(), maxDistance, matches);
+	}
+	else {
+		matches.clear();
+		LevenshteinPattern pattern(key.data(), key.size());
+		for (unsigned int i = 0; i < store.size(); i++) {
+			StrRef stored = store.entry(i).key;
+			//the length difference alone is that many edits
+			if (store.entry(i).deleted || stored.length > key.size() + maxDistance || stored.length + maxDistance < key.size()) {
+				continue;
+			}
+			unsigned int distance = pattern.distance(store.text(stored), stored.length);
+			if (distance <= maxDistance) {
+				matches.push_back(make_pair(i, distance));
+			}
+		}
+		//the same order the trie yields them in
+		sort(matches.begin(), matches.end(), [&](const pair<unsigned int, unsigned int>& a, const pair<unsigned int, unsigned int>& b) {
+			StrRef x = store.entry(a.first).key;
+			StrRef y = store.entry(b.first).key;
+			int order = memcmp(store.text(x), store.text(y), min(x.length, y.length));
+			return order != 0 ? order < 0 : x.length < y.length;
+		});
+	}
+	stable_sort(matches.begin(), matches.end(), [](const pair<unsigned int, unsigned int>& a, const pair<unsigned int, unsigned int>& b) {
+		return a.second < b.second;
+	});
+	for (unsigned int i = 0; i < matches.size() && i < count; i++) {
+		Suggestion suggestion;
+		suggestion.entry = EntryView(&store, matches[i].first);
+		suggestion.distance = matches[i].second;
+		suggestions.push_back(suggestion);
+	}
+}
+
+//searches for a word in the dictionary; the view is empty if the word is not there
+EntryView HashTable::find(const string& word) {
+	int comparisons;
+	return find(word, comparisons);
+}
+
+//searches for a word in the dictionary, counting the stored keys compared on the way
+EntryView HashTable::find(const string& word, int &comparisons) {
+	STAT_TIME(STAT_FIND_NANOS);
+	comparisons = 0;
+	//check if the input is empty
+	if (word.empty()) {
+		return EntryView();
+	}
+
+	//move a few slots along if a rehash is in progress
+	migrate(rehashStep);
+	//normalize and hash the query once
+	const string& key = foldKey(word);
+	unsigned int hash = slotHash(key);
+
+	//search the new table first, then the one being drained
+	int index = probe(ctrl, slots, capacity, key, hash, comparisons);
+	Slot* table = slots;
+	if (index < 0 && oldSlots != nullptr) {
+		index = probe(oldCtrl, oldSlots, oldCapacity, key, hash, comparisons);
+		table = oldSlots;
+	}
+	STAT_ADD(index >= 0 ? STAT_FIND_HITS : STAT_FIND_MISSES, 1);
+	STAT_ADD(STAT_PROBE_GROUPS, comparisons);
+	STAT_PROBE_LENGTH(comparisons);
+
+	//word was not found in the dictionary after full probing
+	if (index < 0) {
+		return EntryView();
+	}
+	return EntryView(&store, table[index].entry);
+}
+
+//searches for a word like find, counting the same group probes, but without advancing a
+//rehash or counting comparisons; any number of threads may run it while no one changes the table
+EntryView HashTable::findReadOnly(const string& word, int &comparisons) const {
+	STAT_TIME(STAT_FIND_NANOS);
+	comparisons = 0;
+	if (word.empty()) {
+		return EntryView();
+	}
+	const string& key = foldKey(word);
+	int entry = locate(key, slotHash(key), comparisons);
+	STAT_ADD(entry >= 0 ? STAT_FIND_HITS : STAT_FIND_MISSES, 1);
+	STAT_ADD(STAT_PROBE_GROUPS, comparisons);
+	STAT_PROBE_LENGTH(comparisons);
+	return entry >= 0 ? EntryView(&store, entry) : EntryView();
+}
+
+//looks up many words at once; results[i] is the view of words[i], empty if it is not there.
+//Lookups advance in lock step through a window of BATCH_WINDOW words: every stage prefetches
+//what the next one reads for the whole window, so the cache misses of one word overlap the
+//work on the others instead of each lookup stalling on its own.
+void HashTable::findBatch(const vector<string>& words, vector<EntryView>& results) {
+	STAT_TIME(STAT_FIND_NANOS);
+	results.assign(words.size(), EntryView());
+	//a batch advances a pending rehash as much as one lookup does
+	migrate(rehashStep);
+	static thread_local string keys[BATCH_WINDOW];
+	unsigned int hashes[BATCH_WINDOW];
+	int found[BATCH_WINDOW];
+
+	for (size_t first = 0; first < words.size(); first += BATCH_WINDOW) {
+		unsigned int count = words.size() - first < BATCH_WINDOW ? words.size() - first : BATCH_WINDOW;
+
+		//stage 1: normalize and hash every word, and fetch its home group of control bytes and slots
+		for (unsigned int i = 0; i < count; i++) {
+			foldCase(words[first + i], keys[i]);
+			hashes[i] = slotHash(keys[i]);
+			unsigned int home = SlotReduce::home(hashes[i], capacity);
+			__builtin_prefetch(ctrl + home);
+			__builtin_prefetch(slots + home);
+		}
+
+		//stage 2: find the first slot carrying the full hash, and fetch the entry it points to
+		for (unsigned int i = 0; i < count; i++) {
+			int probes = 0;
+			unsigned int hash = hashes[i];
+			auto sameHash = [&](unsigned int index) {
+				return slots[index].hash == hash;
+			};
+			found[i] = kernelProbe(kernel, ctrl, capacity, hash, sameHash, probes);
+			if (found[i] >= 0) {
+				found[i] = slots[found[i]].entry;
+				__builtin_prefetch(&store.entries[found[i]]);
+			}
+		}
+
+		//stage 3: fetch the stored keys
+		for (unsigned int i = 0; i < count; i++) {
+			if (found[i] >= 0) {
+				__builtin_prefetch(store.text(store.entries[found[i]].key));
+			}
+		}
+
+		//stage 4: compare the keys. A different key under the same 32-bit hash, or a word not
+		//found while older slots are still being drained, takes the full probe of a single lookup.
+		for (unsigned int i = 0; i < count; i++) {
+			const string& key = keys[i];
+			if (found[i] >= 0) {
+				keyComparisons++;
+				StrRef stored = store.entries[found[i]].key;
+				if (stored.length == key.size() && memcmp(store.text(stored), key.data(), key.size()) == 0) {
+					results[first + i] = EntryView(&store, found[i]);
+					continue;
+				}
+			}
+			else if (oldSlots == nullptr) {
+				continue;
+			}
+			int probes = 0;
+			int index = probe(ctrl, slots, capacity, key, hashes[i], probes);
+			if (index >= 0) {
+				results[first + i] = EntryView(&store, slots[index].entry);
+			}
+			else if (oldSlots != nullptr && (index = probe(oldCtrl, oldSlots, oldCapacity, key, hashes[i], probes)) >= 0) {
+				results[first + i] = EntryView(&store, oldSlots[index].entry);
+			}
+		}
+	}
+#if HT_STATS
+	//probe lengths are not followed through the stages, only the outcomes are counted
+	for (const EntryView& result : results) statAdd(result.found() ? STAT_FIND_HITS : STAT_FIND_MISSES, 1);
+#endif
+}
+
+//destructor for hashtable, frees the table arrays (entries are owned by the payload vector)
+HashTable::~HashTable() {
+	//a snapshot-backed table does not own its arrays, the mapping does
+	if (snapshot != nullptr) {
+		releaseSnapshot();
+		ctrl = nullptr;
+		slots = nullptr;
+	}
+	//delete the control bytes and the entire slot array
+	delete[] ctrl;
+	delete[] slots;
+	//and the ones an unfinished rehash was draining
+	delete[] oldCtrl;
+	delete[] oldSlots;
+	delete reverse;
+	delete trie;
+}
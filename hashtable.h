@@ -2,54 +2,224 @@
 #define _HASHTABLE
 #include <vector>
 #include <string>
+#include "store.h"
+#include "hashpolicy.h"
+#include "reverse.h"
+#include "trie.h"
 using namespace std;
 
 
-class Translation
+//control byte of an empty slot; a full slot stores the top 7 bits of its hash, so its top bit is clear
+const unsigned char CTRL_EMPTY = 0x80;
+//control byte of a tombstone
+const unsigned char CTRL_DELETED = 0xFE;
+//control bytes repeated past the end of the table so a group can be loaded starting at any slot
+const unsigned int CTRL_MIRROR = 31;
+
+//instructions used to compare a group of control bytes at once, from narrowest to widest
+enum ProbeKernel { KERNEL_SCALAR, KERNEL_SSE2, KERNEL_AVX2 };
+
+//one slot of the flat table; probes compare the stored hash before touching the entry
+struct Slot
 {
-	private:
-		string language;
-		vector<string> meanings;
-	public:
-		Translation(string meanings,string language);
-		void addMeaning(string newMeanings);
-		void display();
-		friend class Entry;
-		friend class HashTable;
+	unsigned int hash;		// hash of the case-folded word
+	unsigned int entry;		// index of the entry in the payload array
 };
 
-class Entry
+//words findBatch keeps in flight at once; enough to hide a cache miss behind the others
+const unsigned int BATCH_WINDOW = 16;
+
+//insertions probing this many times or more share the last histogram bucket
+const unsigned int PROBE_HISTOGRAM_SIZE = 32;
+
+//share of the slots tombstones may take before the table is rehashed at the same capacity
+const float MAX_TOMBSTONE_RATIO = 0.2f;
+//share of the store's written bytes garbage may take before the live entries are copied out of it
+const float MAX_GARBAGE_RATIO = 0.5f;
+//garbage below this many bytes is never worth a compaction
+const unsigned long COMPACT_MIN_GARBAGE = 1UL << 20;
+
+//shape of the probe chains of the current table
+struct ProbeHealth
 {
-	private:
-		string word;
-		vector<Translation> translations;
-		bool deleted;  // is the bucket is available to be reused after being deleted
-	public:
-		Entry(string word, string meanings,string language);
-		void addTranslation(string newMeanings, string language);
-		void print();
-		friend class HashTable;
+	unsigned int live;					// slots holding an entry
+	unsigned int tombstones;			// slots left behind by deletions
+	unsigned int empty;					// slots never used since the last rehash
+	double meanDisplacement;			// slots between a live entry and its home slot, on average
+	double meanMissRun;					// slots a lookup that misses passes before an empty one, on average over home slots
+	vector<unsigned int> displacement;	// live entries per displacement; the last bucket collects longer ones
+};
+
+//throughput of the most recent import
+struct ImportStats
+{
+	unsigned long lines;		// records inserted
+	unsigned long bytes;		// size of the file(s)
+	double seconds;				// wall-clock time from open to the last insert
+	unsigned int threads;		// worker threads that parsed and built it
+};
+
+//stages of a manifest import, each on a thread of its own and handing blocks of lines to the next
+enum ImportStage { STAGE_READ, STAGE_PARSE, STAGE_INSERT, STAGE_COUNT };
+
+//work and waiting of one stage of a manifest import
+struct StageStats
+{
+	unsigned long blocks;		// blocks the stage finished
+	unsigned long bytes;		// bytes of lines in them
+	double busySeconds;			// time spent working
+	double starvedSeconds;		// time waiting for the stage before it
+	double blockedSeconds;		// time waiting for room after it (backpressure)
+};
+
+//stages of the most recent manifest import
+struct PipelineStats
+{
+	StageStats stages[STAGE_COUNT];
+	unsigned int files;			// files imported
+	unsigned int blocks;		// blocks in circulation
+	unsigned long bufferBytes;	// memory the blocks ended up holding, which only grows, so the peak
 };
 
+//one language to export and the file it goes to
+struct ExportTarget
+{
+	string language;
+	string path;
+	long records;				// records written, or -1 if the file could not be written
+};
+
+//outcome of a change to the dictionary
+enum EditResult { EDIT_DONE, EDIT_MISSING_INPUT, EDIT_NO_WORD, EDIT_NO_LANGUAGE, EDIT_NO_MEANING };
+
+//memory held by a table, in bytes
+struct MemoryStats
+{
+	unsigned long entries;		// live entries
+	unsigned long tableBytes;	// control bytes and slots
+	unsigned long poolBytes;	// string pool
+	unsigned long recordBytes;	// entry, translation and meaning records, language member lists
+	unsigned long garbageBytes;	// pool and record bytes left behind by changes
+	unsigned long indexBytes;	// reverse index (0 without one)
+	unsigned long trieBytes;	// prefix trie (0 without one)
+};
+
+//a word close to one that was looked up
+struct Suggestion
+{
+	EntryView entry;
+	unsigned int distance;		// byte edits between the normalized words
+};
+
+//a binary snapshot mapped into memory (defined in hashtable.cpp)
+struct Snapshot;
+
 class HashTable
 {
 	private:
-		Entry **buckets;		        			// Array of Pointers to Entries for Linear and Quadratic Probing
+		unsigned char *ctrl;						// Control byte per slot, scanned a group at a time
+		Slot *slots;								// Flat array of slots for group probing
+		EntryStore store;							// Entry payloads referenced by the slots
 		unsigned int size;					   		//Current Size of HashTable
 		unsigned int capacity;				    	// Total Capacity of HashTable
 		unsigned int collisions; 					// Total Number of Collisions
+		unsigned long keyComparisons;				// Word comparisons made after a stored hash matched
+		vector<unsigned int> probeHistogram;		// Insertions per number of collisions
+		unsigned int used;							// Occupied slots (live entries and tombstones)
+		unsigned int tombstones;					// Tombstones among them, in the current table
+		float maxTombstoneRatio;					// Tombstone share of the slots that triggers a rehash (0 = never)
+		float maxGarbageRatio;						// Garbage share of the store that triggers a compaction (0 = never)
+		float maxLoadFactor;						// Load factor ceiling that triggers a resize
+		bool incremental;							// Move slots gradually instead of all at once
+		unsigned int rehashStep;					// Old slots migrated per operation in incremental mode
+		ProbeKernel kernel;							// Group comparison selected for this CPU
+		unsigned char *oldCtrl;						// Control bytes of the table being drained
+		Slot *oldSlots;								// Table being drained by an incremental rehash (nullptr if none)
+		unsigned int oldCapacity;					// Capacity of the table being drained
+		unsigned int rehashIndex;					// Next old slot to migrate
+		ImportStats importStats;					// Throughput of the last import
+		PipelineStats pipelineStats;				// Stages of the last manifest import
+		unsigned int importThreads;					// Worker threads used by import (1 = sequential)
+		Snapshot *snapshot;							// Mapped snapshot lookups read from until the first change (nullptr if none)
+		ReverseIndex *reverse;						// Meaning to entries index (nullptr if off)
+		Trie *trie;									// Prefix trie over the normalized words (nullptr if off)
+		unsigned int slotHash(const string& key) const;
+		int locate(const string& key, unsigned int hash, int &probes) const;
+		int locateWord(const string& word) const;
+		int probe(const unsigned char *ctrl, Slot *table, unsigned int cap, const string& key, unsigned int hash, int &probes);
+		unsigned int freeSlot(const unsigned char *ctrl, unsigned int cap, unsigned int hash, unsigned int &distance);
+		Slot* lookup(const string& key, unsigned int hash);
+		void remove(Slot *slot);
+		void insertRecord(const char *word, size_t wordLength, const char *meanings, size_t meaningsLength, unsigned short language);
+		void insertHashed(const string& key, unsigned int hash, const char *word, size_t wordLength, const char *meanings, size_t meaningsLength, unsigned short language);
+		void adopt(unsigned int entry, unsigned int hash);
+		void reserve(unsigned int count);
+		void resize(unsigned int newCapacity);
+		void grow();
+		void migrate(unsigned int count);
+		void finishRehash();
+		void copyLive(EntryStore& dense, vector<unsigned int>& renumbered) const;
+		void layOut(const vector<unsigned int>& renumbered, unsigned char *layoutCtrl, Slot *layoutSlots, unsigned int &layoutCollisions, unsigned int *histogram);
+		void maintain();
+		void materialize();
+		void releaseSnapshot();
+		unsigned long meaningKey(const char *meaning, size_t length, unsigned short language) const;
+		void indexMeanings(unsigned int entry, unsigned int t, unsigned int from, bool add);
+		void rebuildReverseIndex();
+		void rebuildTrie();
+		long writeLanguage(const string& language, int languageId, const vector<unsigned long> *members, const string& filePath) const;
+		friend class ConcurrentTable;
+		friend class FrozenTable;
 	public:
-		HashTable(int capacity);
-		unsigned long hashCode(string word);
+		HashTable(int capacity, float maxLoadFactor = 0.8);
+		unsigned long hashCode(const string& word) const;
 		unsigned int getSize();
 		unsigned int getCollisions();
-		void import(string path);
-		void insert(string word, string meanings,string language);
-		void delWord(string word);
-		void delTranslation(string word, string language);
-		void delMeaning(string word, string meaning, string language);
-		void exportData(string language, string filePath);
-		void find(string word);
+		const vector<unsigned int>& getProbeHistogram();
+		unsigned long getKeyComparisons();
+		unsigned int getCapacity();
+		float getLoadFactor();
+		bool isRehashing();
+		unsigned int getTombstones();
+		ProbeHealth getProbeHealth();
+		void setCompaction(float maxTombstoneRatio, float maxGarbageRatio);
+		void compact();
+		ProbeKernel getProbeKernel();
+		void setProbeKernel(ProbeKernel kernel);
+		bool contains(const string& word);
+		bool getMeanings(const string& word, const string& language, vector<string>& meanings) const;
+		void setMaxLoadFactor(float maxLoadFactor);
+		void setIncrementalRehash(bool enabled, unsigned int bucketsPerStep = 64);
+		bool import(string path);
+		bool importParallel(const vector<string>& paths);
+		bool importManifest(const string& manifestPath);
+		PipelineStats getPipelineStats();
+		void setImportThreads(unsigned int threads);
+		unsigned int getImportThreads();
+		ImportStats getImportStats();
+		MemoryStats getMemoryStats();
+		void getLanguageCounts(vector<pair<string, unsigned int> >& counts);
+		EditResult insert(const string& word, const string& meanings, const string& language);
+		EditResult delWord(const string& word);
+		EditResult delTranslation(const string& word, const string& language);
+		EditResult delMeaning(const string& word, const string& meaning, const string& language);
+		long exportData(const string& language, const string& filePath);
+		void exportLanguages(vector<ExportTarget>& targets, unsigned int threads);
+		bool exportSnapshot(string filePath);
+		bool importSnapshot(string path);
+		static unsigned long snapshotId(const string& path);
+		bool isSnapshotBacked();
+		EntryView find(const string& word);
+		EntryView find(const string& word, int &comparisons);
+		EntryView findReadOnly(const string& word, int &comparisons) const;
+		void findBatch(const vector<string>& words, vector<EntryView>& results);
+		void setReverseIndex(bool enabled);
+		bool hasReverseIndex();
+		void findReverse(const string& meaning, const string& language, vector<EntryView>& results) const;
+		void setPrefixIndex(bool enabled);
+		bool hasPrefixIndex() const;
+		void complete(const string& prefix, unsigned int k, vector<EntryView>& results) const;
+		void suggest(const string& word, unsigned int maxDistance, unsigned int count, vector<Suggestion>& suggestions) const;
 		~HashTable();
 };
 #endif
\ No newline at end of file
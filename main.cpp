@@ -13,82 +13,767 @@
 #include<math.h>
 #include<iomanip>
 #include<list>
+#include<thread>
+#include<chrono>
+#include<cctype>
+#include<sys/stat.h>
 #include "hashtable.h"
+#include "unicode.h"
+#include "stats.h"
+#include "wal.h"
+#include "frozen.h"
 using namespace std;
 //======================================================
 
-//function to convert a string to lowercase
-string toLowerStr(const string& str) {
-    string lowerStr = str;
-    for (char& c : lowerStr) {
-        c = tolower(c);
-    }
-    return lowerStr;
-}
-
-//converts a string to match the exact case of valid command keywords
-string normalizeCommand(const string& cmd) {
-    if (toLowerStr(cmd) == "find") return "find";
-    if (toLowerStr(cmd) == "import") return "import";
-    if (toLowerStr(cmd) == "add") return "add";
-    if (toLowerStr(cmd) == "delword") return "delWord";
-    if (toLowerStr(cmd) == "deltranslation") return "delTranslation";
-    if (toLowerStr(cmd) == "delmeaning") return "delMeaning";
-    if (toLowerStr(cmd) == "export") return "export";
-    if (toLowerStr(cmd) == "help") return "help";
-    if (toLowerStr(cmd) == "exit") return "exit";
-    return cmd; 
+//the text dictionary and the snapshot caching it, which is rebuilt whenever the text is newer
+const string DICTIONARY_PATH = "en-de.txt";
+const string CACHE_PATH = "en-de.snap";
+//changes made at the prompt: the log since the last checkpoint, and the checkpoint itself,
+//which holds the dictionary with every earlier change and is never rebuilt from the text
+const string LOG_PATH = "en-de.wal";
+const string CHECKPOINT_PATH = "en-de.ckpt";
+
+//converts a string to match the exact case of valid command keywords (in place, so replaying a log does not allocate per command)
+void normalizeCommand(string& cmd) {
+    static string lower;
+    foldCase(cmd, lower);
+    if (lower == "find") cmd = "find";
+    else if (lower == "import") cmd = "import";
+    else if (lower == "manifest") cmd = "manifest";
+    else if (lower == "add") cmd = "add";
+    else if (lower == "delword") cmd = "delWord";
+    else if (lower == "deltranslation") cmd = "delTranslation";
+    else if (lower == "delmeaning") cmd = "delMeaning";
+    else if (lower == "reverse") cmd = "reverse";
+    else if (lower == "complete") cmd = "complete";
+    else if (lower == "export") cmd = "export";
+    else if (lower == "save") cmd = "save";
+    else if (lower == "load") cmd = "load";
+    else if (lower == "stats") cmd = "stats";
+    else if (lower == "checkpoint") cmd = "checkpoint";
+    else if (lower == "help") cmd = "help";
+    else if (lower == "exit") cmd = "exit";
+}
+
+//a command line split into its keyword and up to three arguments
+struct Command
+{
+	string name;
+	string argument1;
+	string argument2;
+	string argument3;
+};
+
+//copies line[pos..] up to the delimiter (or the end) into field; returns where the next field starts
+size_t nextField(const string& line, size_t pos, char delimiter, string& field)
+{
+	if(pos >= line.size())
+	{
+		field.clear();
+		return line.size();
+	}
+	size_t stop = line.find(delimiter, pos);
+	if(stop == string::npos) stop = line.size();
+	field.assign(line, pos, stop - pos);
+	return stop < line.size() ? stop + 1 : stop;
+}
+
+//splits a line the way the prompt always has: the keyword up to the first space, then
+//arguments separated by ':', the last one taking the rest of the line. It reuses the
+//command's strings instead of going through a stringstream.
+void parseCommand(const string& line, Command& command)
+{
+	size_t pos = nextField(line, 0, ' ', command.name);
+	normalizeCommand(command.name); //normalize input to match the command list
+	pos = nextField(line, pos, ':', command.argument1);
+	pos = nextField(line, pos, ':', command.argument2);
+	nextField(line, pos, '\n', command.argument3);
+}
+
+//imports a comma-separated list of files; several files are imported together in parallel.
+//Returns false if none could be imported.
+bool importFiles(HashTable& table, const string& argument)
+{
+	vector<string> paths;
+	stringstream list(argument);
+	string path;
+	while(getline(list,path,',')) paths.push_back(path);
+	if(paths.size() > 1) return table.importParallel(paths);
+	return table.import(argument);
+}
+
+//prints the translations of an entry, one language per line
+void printTranslations(ostream& out, const EntryView& entry)
+{
+	for(unsigned int i = 0; i < entry.translationCount(); i++)
+	{
+		//language in a column of its own, then the meanings separated by semicolons
+		TranslationView translation = entry.translation(i);
+		out<<left<<setw(10)<<translation.language()<<": ";
+		for(unsigned int m = 0; m < translation.meaningCount(); m++)
+		{
+			TextView meaning = translation.meaning(m);
+			if(m > 0) out<<"; ";
+			out.write(meaning.data, meaning.length);
+		}
+		out<<'\n';
+	}
+}
+
+//suggestions offered for a word that is not in the dictionary, at most this many edits away
+const unsigned int SUGGEST_DISTANCE = 2;
+const unsigned int SUGGEST_COUNT = 5;
+
+//prints the answer to a find command: the word with its translations, one language per line,
+//or the closest words when it is missing. Those come from the prefix trie, which bounds the cost
+//of a miss however large the dictionary is; without it a miss suggests nothing.
+void printEntry(ostream& out, const HashTable& table, const string& word, const EntryView& entry, int comparisons)
+{
+	if(word.empty())
+	{
+		out<<"Please provide the word you wish to find."<<'\n';
+		return;
+	}
+	if(!entry.found())
+	{
+		out<<word<<" not found in the Dictionary."<<'\n';
+		static thread_local vector<Suggestion> suggestions;
+		suggestions.clear();
+		if(table.hasPrefixIndex()) table.suggest(word, SUGGEST_DISTANCE, SUGGEST_COUNT, suggestions);
+		for(unsigned int i = 0; i < suggestions.size(); i++)
+		{
+			TextView text = suggestions[i].entry.word();
+			out<<(i == 0 ? "Did you mean: " : ", ");
+			out.write(text.data, text.length);
+		}
+		if(!suggestions.empty()) out<<"?"<<'\n';
+		return;
+	}
+	out<<word<<" found in the Dictionary after "<<comparisons<<" comparisons."<<'\n';
+	printTranslations(out, entry);
+}
+
+//prints the words that have a meaning in a language, building the reverse index on first use
+void reverseFind(ostream& out, HashTable& table, const string& meaning, const string& language)
+{
+	if(meaning.empty() || language.empty())
+	{
+		out<<"Please provide the meaning and its language you wish to look up."<<'\n';
+		return;
+	}
+	if(!table.hasReverseIndex())
+	{
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		table.setReverseIndex(true);
+		double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+		MemoryStats memory = table.getMemoryStats();
+		out<<"Reverse index built in "<<fixed<<setprecision(3)<<seconds * 1000<<" ms: "<<memory.indexBytes<<" bytes, "
+			<<setprecision(1)<<(memory.entries ? double(memory.indexBytes) / memory.entries : 0)<<" bytes per entry."<<'\n';
+		out.unsetf(ios::floatfield);
+		out<<setprecision(6);
+	}
+	static vector<EntryView> words;
+	table.findReverse(meaning, language, words);
+	if(words.empty())
+	{
+		out<<meaning<<" not found in the Dictionary."<<'\n';
+		return;
+	}
+	out<<meaning<<" is a "<<language<<" meaning of "<<words.size()<<(words.size() == 1 ? " word:" : " words:")<<'\n';
+	for(const EntryView& word : words)
+	{
+		TextView text = word.word();
+		out.write(text.data, text.length);
+		out<<'\n';
+	}
+}
+
+//prints up to k words starting with a prefix, with their translations, building the prefix trie on first use
+void complete(ostream& out, HashTable& table, const string& prefix, const string& limit)
+{
+	if(prefix.empty())
+	{
+		out<<"Please provide the beginning of the word you wish to complete."<<'\n';
+		return;
+	}
+	if(!table.hasPrefixIndex())
+	{
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		table.setPrefixIndex(true);
+		double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+		MemoryStats memory = table.getMemoryStats();
+		out<<"Prefix trie built in "<<fixed<<setprecision(3)<<seconds * 1000<<" ms: "<<memory.trieBytes<<" bytes, "
+			<<setprecision(1)<<(memory.entries ? double(memory.trieBytes) / memory.entries : 0)<<" bytes per entry."<<'\n';
+		out.unsetf(ios::floatfield);
+		out<<setprecision(6);
+	}
+	int k = atoi(limit.c_str());
+	static vector<EntryView> words;
+	table.complete(prefix, k > 0 ? k : 10, words);
+	if(words.empty())
+	{
+		out<<"No word in the Dictionary starts with "<<prefix<<"."<<'\n';
+		return;
+	}
+	for(const EntryView& word : words)
+	{
+		TextView text = word.word();
+		out.write(text.data, text.length);
+		out<<'\n';
+		printTranslations(out, word);
+	}
+}
+
+//reports the outcome of the add command
+void reportAdd(ostream& out, EditResult result)
+{
+	if(result == EDIT_MISSING_INPUT) out<<"Error: Please provide a word, at least one meaning, and the language."<<'\n';
+}
+
+//reports the outcome of the delWord command
+void reportDelWord(ostream& out, EditResult result, const string& word)
+{
+	if(result == EDIT_MISSING_INPUT) out<<"Please provide the word you wish to delete."<<'\n';
+	else if(result == EDIT_NO_WORD) out<<word<<" not found in the Dictionary."<<'\n';
+	else out<<word<<" has been successfully deleted from the Dictionary."<<'\n';
+}
+
+//reports the outcome of the delTranslation command
+void reportDelTranslation(ostream& out, EditResult result, const string& word)
+{
+	if(result == EDIT_MISSING_INPUT) out<<"Please provide the word and the language of its translation you wish to delete."<<'\n';
+	else if(result == EDIT_NO_WORD) out<<word<<" not found in the Dictionary."<<'\n';
+	else if(result == EDIT_NO_LANGUAGE) out<<"Translation not found in the Dictionary."<<'\n';
+	else out<<"Translation has been successfully deleted from the Dictionary."<<'\n';
+}
+
+//reports the outcome of the delMeaning command
+void reportDelMeaning(ostream& out, EditResult result, const string& word)
+{
+	if(result == EDIT_MISSING_INPUT) out<<"Please provide the word, its meaning, and its language that you wish to delete."<<'\n';
+	else if(result == EDIT_NO_WORD) out<<word<<" not found in the Dictionary."<<'\n';
+	else if(result == EDIT_NO_LANGUAGE) out<<"Language not found in the Dictionary."<<'\n';
+	else if(result == EDIT_NO_MEANING) out<<"Meaning not found in the Dictionary."<<'\n';
+	else out<<"Meaning has been successfully deleted from the Translation."<<'\n';
+}
+
+//exports one or more languages, given as language:filename pairs separated by commas, and
+//reports how many records went to each file. Several languages are written in parallel.
+void exportLanguages(ostream& out, HashTable& table, const Command& command)
+{
+	//the parser split the list at its colons, so it is put back together first
+	string list = command.argument1 + ":" + command.argument2;
+	if(!command.argument3.empty()) list += ":" + command.argument3;
+	vector<ExportTarget> targets;
+	stringstream pairs(list);
+	string pair;
+	while(getline(pairs,pair,','))
+	{
+		size_t colon = pair.find(':');
+		ExportTarget target;
+		target.language = pair.substr(0, colon);
+		target.path = colon == string::npos ? "" : pair.substr(colon + 1);
+		targets.push_back(target);
+	}
+	table.exportLanguages(targets, thread::hardware_concurrency());
+	for(const ExportTarget& target : targets)
+	{
+		if(target.records < 0) out<<"Could not open the required file for writing."<<'\n';
+		else out<<target.records<<" records have been successfully exported to "<<target.path<<'\n';
+	}
+}
+
+//writes the counters, the table's state and the entries per language as one JSON object
+void writeStatsJson(ostream& out, HashTable& table, const unsigned long counters[], const unsigned long probeLengths[],
+	const vector<pair<string, unsigned int> >& languages)
+{
+	MemoryStats memory = table.getMemoryStats();
+	ImportStats import = table.getImportStats();
+	out<<"{\n  \"stats_compiled\": "<<(HT_STATS ? "true" : "false")<<",\n  \"counters\": {";
+	for(unsigned int i = 0; i < STAT_COUNT; i++) out<<(i ? ", " : "")<<"\""<<statName((StatCounter)i)<<"\": "<<counters[i];
+	out<<"},\n  \"probe_lengths\": [";
+	for(unsigned int i = 0; i < STAT_PROBE_BUCKETS; i++) out<<(i ? ", " : "")<<probeLengths[i];
+	out<<"],\n  \"table\": {\"size\": "<<table.getSize()<<", \"capacity\": "<<table.getCapacity()<<", \"tombstones\": "<<table.getTombstones()
+		<<", \"collisions\": "<<table.getCollisions()<<", \"key_comparisons\": "<<table.getKeyComparisons()<<"},\n";
+	out<<"  \"memory\": {\"table_bytes\": "<<memory.tableBytes<<", \"pool_bytes\": "<<memory.poolBytes<<", \"record_bytes\": "<<memory.recordBytes
+		<<", \"garbage_bytes\": "<<memory.garbageBytes<<", \"index_bytes\": "<<memory.indexBytes<<", \"trie_bytes\": "<<memory.trieBytes<<"},\n";
+	out<<"  \"last_import\": {\"lines\": "<<import.lines<<", \"bytes\": "<<import.bytes<<", \"seconds\": "<<import.seconds<<", \"threads\": "<<import.threads<<"},\n";
+	out<<"  \"languages\": {";
+	for(size_t l = 0; l < languages.size(); l++)
+	{
+		//language names are written as the files gave them; only quotes and backslashes need escaping
+		out<<(l ? ", " : "")<<"\"";
+		for(char c : languages[l].first) out<<(c == '"' || c == '\\' ? "\\" : "")<<c;
+		out<<"\": "<<languages[l].second;
+	}
+	out<<"}\n}\n";
+}
+
+//answers the stats command: with no argument it prints what the hot paths counted (builds with
+//make STATS=1) and what the table holds; "stats reset" zeroes the counters; "stats <path>"
+//writes the same numbers to a file as JSON
+void reportStats(ostream& out, HashTable& table, const string& argument)
+{
+	if(argument == "reset")
+	{
+		resetStats();
+		out<<"Counters have been reset."<<'\n';
+		return;
+	}
+	unsigned long counters[STAT_COUNT], probeLengths[STAT_PROBE_BUCKETS];
+	readStats(counters, probeLengths);
+	vector<pair<string, unsigned int> > languages;
+	table.getLanguageCounts(languages);
+	if(!argument.empty())
+	{
+		ofstream file(argument);
+		writeStatsJson(file, table, counters, probeLengths, languages);
+		if(file) out<<"Statistics have been written to "<<argument<<'\n';
+		else out<<"Could not open the required file for writing."<<'\n';
+		return;
+	}
+
+	MemoryStats memory = table.getMemoryStats();
+	ImportStats import = table.getImportStats();
+	unsigned long memoryBytes = memory.tableBytes + memory.poolBytes + memory.recordBytes + memory.indexBytes + memory.trieBytes;
+	out<<fixed<<setprecision(2);
+	out<<"Entries                          = "<<table.getSize()<<" in "<<table.getCapacity()<<" slots (load "<<table.getLoadFactor()
+		<<", "<<table.getTombstones()<<" tombstones)"<<'\n';
+	out<<"Memory                           = "<<memoryBytes<<" bytes, "<<(memory.entries ? double(memoryBytes) / memory.entries : 0)
+		<<" per entry ("<<memory.garbageBytes<<" garbage)"<<'\n';
+	if(import.lines > 0)
+	{
+		out<<"Last Import                      = "<<import.lines<<" lines in "<<import.seconds<<" s on "<<import.threads<<" thread(s)"<<'\n';
+	}
+	for(const pair<string, unsigned int>& language : languages)
+	{
+		out<<"Entries in "<<left<<setw(22)<<language.first<<right<<"= "<<language.second<<'\n';
+	}
+	if(!HT_STATS)
+	{
+		out<<"Counters are compiled out; build with make STATS=1 to collect them."<<'\n';
+	}
+	else
+	{
+		unsigned long finds = counters[STAT_FIND_HITS] + counters[STAT_FIND_MISSES];
+		for(unsigned int i = 0; i < STAT_COUNT; i++)
+		{
+			out<<left<<setw(33)<<statName((StatCounter)i)<<right<<"= "<<counters[i]<<'\n';
+		}
+		if(finds > 0)
+		{
+			out<<"Hit Rate                         = "<<100.0 * counters[STAT_FIND_HITS] / finds<<" %"<<'\n';
+			out<<"Groups per Lookup                = "<<double(counters[STAT_PROBE_GROUPS]) / finds<<'\n';
+			out<<"ns per Lookup                    = "<<double(counters[STAT_FIND_NANOS]) / finds<<'\n';
+		}
+		out<<"Lookups by Groups Scanned        =";
+		for(unsigned int i = 0; i < STAT_PROBE_BUCKETS; i++) out<<" "<<probeLengths[i];
+		out<<" (1 to "<<STAT_PROBE_BUCKETS<<"+)"<<'\n';
+	}
+	out.unsetf(ios::floatfield);
+	out<<setprecision(6);
+}
+
+//true if path exists and was modified after other (or other does not exist)
+bool isNewer(const string& path, const string& other)
+{
+	struct stat a, b;
+	if(stat(path.c_str(), &a) != 0) return false;
+	if(stat(other.c_str(), &b) != 0) return true;
+	return a.st_mtime >= b.st_mtime;
 }
 
 void help()
 {
-	cout<<"find <word>                         : Search a word and its meanings in the dictionary."<<endl;
-	cout<<"import <path>                       : Import a dictionary file."<<endl;
-	cout<<"add <word:meaning(s):language>      : Add a word and/or its meanings (separated by ;) to the dictionary."<<endl;
-	cout<<"delTranslation <word:language>      : Delete a specific translation of a word from the dictionary."<<endl;
-	cout<<"delMeaning <word:meaning:language>  : Delete only a specific meaning of a word from the dictionary."<<endl;
-	cout<<"delWord <word>                      : Delete a word and its all translations from the dictionary."<<endl;
-	cout<<"export <language:filename>          : Export a a given language dictionary to a file."<<endl;
-	cout<<"exit                                : Exit the program"<<endl;
+	cout<<"find <word>                         : Search a word and its meanings in the dictionary, or suggest close words"<<'\n';
+	cout<<"                                      from the prefix trie (none if started with --no-prefix-index)."<<'\n';
+	cout<<"import <path>[,<path>...]           : Import one or more dictionary files."<<'\n';
+	cout<<"manifest <path>                     : Import the files a manifest lists, one [language:]path per line, streaming"<<'\n';
+	cout<<"                                      each through overlapping read, parse and insert stages."<<'\n';
+	cout<<"add <word:meaning(s):language>      : Add a word and/or its meanings (separated by ;) to the dictionary."<<'\n';
+	cout<<"delTranslation <word:language>      : Delete a specific translation of a word from the dictionary."<<'\n';
+	cout<<"delMeaning <word:meaning:language>  : Delete only a specific meaning of a word from the dictionary."<<'\n';
+	cout<<"delWord <word>                      : Delete a word and its all translations from the dictionary."<<'\n';
+	cout<<"reverse <meaning:language>          : List the words that have a meaning in a language."<<'\n';
+	cout<<"complete <prefix>[:k]               : List up to k (10) words starting with a prefix, with their meanings (after"<<'\n';
+	cout<<"                                      --no-prefix-index, the first call builds the trie, which every change then updates)."<<'\n';
+	cout<<"export <language:filename>[,...]    : Export a a given language dictionary to a file; several languages in parallel."<<'\n';
+	cout<<"save <path>                         : Save the whole dictionary to a binary snapshot."<<'\n';
+	cout<<"load <path>                         : Replace the dictionary with a binary snapshot."<<'\n';
+	cout<<"stats [reset|<path>]                : Show counters and table statistics, zero the counters, or write them as JSON."<<'\n';
+	cout<<"checkpoint                          : Save the dictionary to "<<CHECKPOINT_PATH<<" in the background and empty the change log."<<'\n';
+	cout<<"exit                                : Exit the program"<<'\n';
+}
+//finds answered in parallel are gathered in runs of at most this many commands
+const size_t FIND_RUN = 4096;
+
+//answers a run of find commands on several threads, each taking a contiguous share, and
+//prints the answers in command order; answer(out, word) prints one. Finds change nothing,
+//so they may run side by side.
+template<class Answer>
+void findParallel(ostream& out, const vector<Command>& commands, size_t count, unsigned int threads, const Answer& answer)
+{
+	vector<ostringstream> outputs(threads);
+	vector<thread> workers;
+	size_t share = (count + threads - 1) / threads;
+	for(unsigned int t = 0; t < threads; t++)
+	{
+		workers.push_back(thread([&, t]() {
+			for(size_t i = t * share; i < count && i < (t + 1) * share; i++)
+			{
+				answer(outputs[t], commands[i].argument1);
+			}
+		}));
+	}
+	for(thread& worker : workers) worker.join();
+	for(ostringstream& output : outputs) out<<output.str();
+}
+
+//records a change that went through in the mutation log (if there is one) and returns its result
+EditResult logged(MutationLog *log, HashTable& table, EditResult result, LogOp op, const string& a, const string& b = "", const string& c = "")
+{
+	if(log && result == EDIT_DONE)
+	{
+		log->append(op, a, b, c);
+		log->afterChange(table);
+	}
+	return result;
+}
+
+//saves the table: to its own snapshot through a checkpoint of the log, which must then be emptied, or anywhere else directly
+void save(ostream& out, HashTable& table, MutationLog *log, const string& path)
+{
+	//the cache must only ever hold the text dictionary, or the log would be replayed onto its own changes
+	if(path == CACHE_PATH)
+	{
+		out<<CACHE_PATH<<" caches "<<DICTIONARY_PATH<<"; save the changes with checkpoint or to another file."<<'\n';
+		return;
+	}
+	if(!log || path != log->getSnapshotPath())
+	{
+		table.exportSnapshot(path);
+		return;
+	}
+	log->reap(true);
+	if(log->checkpoint(table) && log->reap(true)) out<<"Snapshot has been saved to "<<path<<'\n';
+}
+
+//bulk changes are not logged, as a record could only name the files, which may change or
+//vanish before it is replayed; a checkpoint saves the whole table instead
+void checkpointBulk(ostream& out, HashTable& table, MutationLog *log, bool changed)
+{
+	if(log && changed) save(out, table, log, log->getSnapshotPath());
+}
+
+//runs one command, recording the changes in log if given; returns false when it asks to exit
+bool runCommand(ostream& out, HashTable& table, const Command& command, MutationLog *log = nullptr)
+{
+	const string& name = command.name;
+	const string& argument1 = command.argument1;
+	const string& argument2 = command.argument2;
+	const string& argument3 = command.argument3;
+		if(name == "find")
+	{
+		int comparisons = 0;
+		EntryView entry = table.find(argument1, comparisons);
+		printEntry(out, table, argument1, entry, comparisons);
+	}
+	else if(name == "import")          checkpointBulk(out, table, log, importFiles(table, argument1));
+	else if(name == "manifest")        checkpointBulk(out, table, log, table.importManifest(argument1));
+	else if(name == "add")		       reportAdd(out, logged(log, table, table.insert(argument1,argument2,argument3), LOG_ADD, argument1, argument2, argument3)); //word,meaning,language
+	else if(name == "delWord")         reportDelWord(out, logged(log, table, table.delWord(argument1), LOG_DEL_WORD, argument1), argument1);
+	else if(name == "delTranslation")  reportDelTranslation(out, logged(log, table, table.delTranslation(argument1,argument2), LOG_DEL_TRANSLATION, argument1, argument2), argument1);
+	else if(name == "delMeaning")      reportDelMeaning(out, logged(log, table, table.delMeaning(argument1,argument2,argument3), LOG_DEL_MEANING, argument1, argument2, argument3), argument1);
+	else if(name == "reverse")         reverseFind(out, table, argument1, argument2);
+	else if(name == "complete")        complete(out, table, argument1, argument2);
+	else if(name == "export")          exportLanguages(out, table, command);
+	else if(name == "save")            save(out, table, log, argument1);
+	else if(name == "load")            checkpointBulk(out, table, log, table.importSnapshot(argument1));
+	else if(name == "stats")           reportStats(out, table, argument1);
+	else if(name == "checkpoint")
+	{
+		if(!log) out<<"Changes are not being logged."<<'\n';
+		else if(log->checkpoint(table)) out<<"Checkpoint started."<<'\n';
+		else out<<"A checkpoint is already running."<<'\n';
+	}
+	else if(name == "help")	  	       help();
+	else if(name == "exit")	  	       return false;
+	else out<<"Invalid command !!!"<<'\n';
+	return true;
+}
+
+//runs every command of a file (or stdin for "-") without prompts: run(command) runs one and
+//returns false when it asks to exit, findRun(finds, count) answers a run of finds. With more
+//than one thread, consecutive finds are gathered for findRun; any other command waits for them.
+template<class Run, class FindRun>
+void runBatch(const string& path, unsigned int threads, const Run& run, const FindRun& findRun)
+{
+	ifstream file;
+	if(path != "-")
+	{
+		file.open(path);
+		if(!file.is_open())
+		{
+			cout<<"Could not open the file."<<'\n';
+			return;
+		}
+	}
+	istream& in = path != "-" ? file : cin;
+	string line;
+	vector<Command> finds(threads > 1 ? FIND_RUN : 0);
+	size_t pending = 0;
+	Command command;
+	while(getline(in, line))
+	{
+		parseCommand(line, command);
+		if(threads > 1 && command.name == "find")
+		{
+			swap(finds[pending++], command);
+			if(pending < FIND_RUN) continue;
+		}
+		//answer the finds gathered so far before anything that may change the table
+		if(pending > 0)
+		{
+			findRun(finds, pending);
+			pending = 0;
+		}
+		if(command.name != "find" || threads <= 1)
+		{
+			if(!run(command)) return;
+		}
+	}
+	if(pending > 0) findRun(finds, pending);
 }
+
+//runs a batch against the table, answering runs of finds on several threads
+void runBatch(HashTable& table, const string& path, unsigned int threads)
+{
+	runBatch(path, threads, [&](const Command& command) {
+		return runCommand(cout, table, command);
+	}, [&](const vector<Command>& finds, size_t count) {
+		findParallel(cout, finds, count, threads, [&](ostream& out, const string& word) {
+			int comparisons = 0;
+			EntryView entry = table.findReadOnly(word, comparisons);
+			printEntry(out, table, word, entry, comparisons);
+		});
+	});
+}
+
+//prints the answer to a find command on a frozen dictionary; there is no trie to suggest words from
+void printFrozen(ostream& out, const FrozenTable& frozen, const string& word)
+{
+	static thread_local FrozenEntry entry;
+	if(word.empty())
+	{
+		out<<"Please provide the word you wish to find."<<'\n';
+		return;
+	}
+	if(!frozen.find(word, entry))
+	{
+		out<<word<<" not found in the Dictionary."<<'\n';
+		return;
+	}
+	out<<word<<" found in the Dictionary after 1 comparisons."<<'\n';
+	unsigned int m = 0;
+	for(unsigned int t = 0; t < entry.languages.size(); t++)
+	{
+		out<<left<<setw(10)<<frozen.languageName(entry.languages[t])<<": ";
+		for(unsigned int first = m; m < entry.meaningEnds[t]; m++)
+		{
+			if(m > first) out<<"; ";
+			out.write(entry.meanings[m].data, entry.meanings[m].length);
+		}
+		out<<'\n';
+	}
+}
+
+//prints the size of a frozen dictionary in bits per word, next to the table it was built from
+void reportFrozen(ostream& out, const FrozenTable& frozen, unsigned long mutableBytes)
+{
+	FrozenStats stats = frozen.getStats();
+	double keys = stats.keys ? stats.keys : 1;
+	out<<fixed<<setprecision(1);
+	out<<"Frozen "<<stats.keys<<" words in "<<stats.buildSeconds * 1000<<" ms: "
+		<<8.0 * (stats.hashBytes + stats.rankBytes + stats.blockBytes) / keys<<" bits per word ("
+		<<8.0 * stats.hashBytes / keys<<" perfect hash with "<<stats.pilotBits<<"-bit pilots, "
+		<<8.0 * stats.rankBytes / keys<<" ranks, "<<8.0 * stats.blockBytes / keys<<" blocks) against "
+		<<8.0 * mutableBytes / keys<<" in the mutable table."<<'\n';
+	out.unsetf(ios::floatfield);
+	out<<setprecision(6);
+}
+
+//runs one command on a frozen dictionary, which only answers finds; returns false when it asks to exit
+bool runFrozenCommand(ostream& out, const FrozenTable& frozen, const Command& command, unsigned long mutableBytes)
+{
+	const string& name = command.name;
+	if(name == "find")              printFrozen(out, frozen, command.argument1);
+	else if(name == "stats")        reportFrozen(out, frozen, mutableBytes);
+	else if(name == "help")         help();
+	else if(name == "exit")         return false;
+	else if(name == "import" || name == "manifest" || name == "add" || name == "delWord" || name == "delTranslation" || name == "delMeaning"
+		|| name == "load" || name == "checkpoint" || name == "reverse" || name == "complete" || name == "export" || name == "save")
+	{
+		out<<"The dictionary is frozen (--frozen): only find and stats are available."<<'\n';
+	}
+	else out<<"Invalid command !!!"<<'\n';
+	return true;
+}
+
+//loads the dictionary and returns the snapshot it came from ("" if it was read from the text).
+//With withChanges, the checkpoint is taken first: the changes it holds exist nowhere else.
+//Otherwise the cache is used while it is up to date, and rebuilt from the text when it is not.
+string loadDictionary(HashTable& table, bool withChanges)
+{
+	struct stat checkpoint;
+	if(withChanges && stat(CHECKPOINT_PATH.c_str(), &checkpoint) == 0)
+	{
+		if(table.importSnapshot(CHECKPOINT_PATH)) return CHECKPOINT_PATH;
+		cout<<"Could not load "<<CHECKPOINT_PATH<<"; starting from "<<DICTIONARY_PATH<<" without the changes it holds."<<'\n';
+	}
+	if(isNewer(CACHE_PATH, DICTIONARY_PATH) && table.importSnapshot(CACHE_PATH)) return CACHE_PATH;
+	table.import(DICTIONARY_PATH);
+	if(table.getSize() > 0) table.exportSnapshot(CACHE_PATH);
+	return "";
+}
+
+//serves the dictionary read-only from a frozen copy (--frozen); the mutable table it is built
+//from is freed before the first command
+int runFrozen(const string& batch, unsigned int threads, bool logging)
+{
+	FrozenTable frozen;
+	unsigned long mutableBytes;
+	{
+		HashTable table(1171891);
+		table.setImportThreads(thread::hardware_concurrency());
+		//changes interactive sessions made belong to the dictionary; batch runs leave them out,
+		//as they do on the mutable table
+		bool withChanges = logging && batch.empty();
+		unsigned long baseSnapshot = HashTable::snapshotId(CHECKPOINT_PATH);
+		string loaded = loadDictionary(table, withChanges);
+		if(withChanges)
+		{
+			MutationLog changeLog(LOG_PATH, CHECKPOINT_PATH, LogOptions());
+			changeLog.recover(table, baseSnapshot);
+		}
+		//a table still reading its snapshot takes the mapped file
+		struct stat snapshot;
+		MemoryStats memory = table.getMemoryStats();
+		mutableBytes = memory.tableBytes + memory.poolBytes + memory.recordBytes;
+		if(table.isSnapshotBacked() && stat(loaded.c_str(), &snapshot) == 0) mutableBytes = snapshot.st_size;
+		if(!frozen.build(table)) return 1;
+	}
+	reportFrozen(cout, frozen, mutableBytes);
+	if(!batch.empty())
+	{
+		runBatch(batch, threads, [&](const Command& command) {
+			return runFrozenCommand(cout, frozen, command, mutableBytes);
+		}, [&](const vector<Command>& finds, size_t count) {
+			findParallel(cout, finds, count, threads, [&](ostream& out, const string& word) {
+				printFrozen(out, frozen, word);
+			});
+		});
+		return 0;
+	}
+	help();
+	string user_input;
+	Command command;
+	while(true)
+	{
+		user_input.clear();
+		cout<<">";
+		getline(cin,user_input);
+		parseCommand(user_input, command);
+		if(!runFrozenCommand(cout, frozen, command, mutableBytes)) break;
+	}
+	return 0;
+}
+
 //======================================================
 int main(int argc, char** args)
 {
+	//cout is flushed when input is read (cin is tied to it), not after every line
+	ios_base::sync_with_stdio(false);
+	//translator --batch <file|-> [threads] replays commands without prompts; interactive changes
+	//are logged, synced as --sync always|batch|off says (batch by default), unless --no-log
+	string batch;
+	unsigned int batchThreads = 1;
+	LogOptions logOptions;
+	bool logging = true;
+	//--frozen answers finds from a read-only, compact copy of the dictionary
+	bool frozen = false;
+	//the prefix trie is built at startup, after the log is replayed, for suggestions and completion;
+	//--no-prefix-index saves the build and its upkeep on every change, and misses suggest nothing
+	bool prefixIndex = true;
+	for(int i = 1; i < argc; i++)
+	{
+		string flag = args[i];
+		if(flag == "--batch" && i + 1 < argc)
+		{
+			batch = args[++i];
+			if(i + 1 < argc && isdigit((unsigned char)args[i + 1][0])) batchThreads = max(atoi(args[++i]), 1);
+		}
+		else if(flag == "--sync" && i + 1 < argc)
+		{
+			string mode = args[++i];
+			logOptions.sync = mode == "always" ? SYNC_ALWAYS : mode == "off" ? SYNC_OFF : SYNC_BATCH;
+		}
+		else if(flag == "--no-log") logging = false;
+		else if(flag == "--frozen") frozen = true;
+		else if(flag == "--no-prefix-index") prefixIndex = false;
+	}
+	if(frozen) return runFrozen(batch, batchThreads, logging);
 	HashTable myHashTable(1171891);//(2124867);
-	myHashTable.import("en-de.txt");
-
-
+	//grow in small steps so interactive commands never wait for a full rehash; parallel finds
+	//need every rehash finished at once, since they must not move slots themselves
+	myHashTable.setIncrementalRehash(batchThreads <= 1);
+	//parse and build imports on every core
+	myHashTable.setImportThreads(thread::hardware_concurrency());
+	//batch runs start from the base dictionary, without the checkpoint, and leave the log
+	//alone, so they can be repeated
+	if(!batch.empty())
+	{
+		loadDictionary(myHashTable, false);
+		if(prefixIndex) myHashTable.setPrefixIndex(true);
+		runBatch(myHashTable, batch, batchThreads);
+		return 0;
+	}
+	//the checkpoint the change log was written against
+	unsigned long baseSnapshot = HashTable::snapshotId(CHECKPOINT_PATH);
+	loadDictionary(myHashTable, logging);
+	//changes made in earlier sessions since the last checkpoint
+	MutationLog changeLog(LOG_PATH, CHECKPOINT_PATH, logOptions);
+	MutationLog *log = logging ? &changeLog : nullptr;
+	unsigned long replayed = log ? log->recover(myHashTable, baseSnapshot) : 0;
+	if(prefixIndex) myHashTable.setPrefixIndex(true);
 
-	cout<<"==================================================="<<endl;
-	cout<<"Size of HashTable                = "<<myHashTable.getSize()<<endl;
-	cout<<"Total Number of Collisions       = "<<myHashTable.getCollisions()<<endl;
-	cout<<"Avg. Number of Collisions/Entry  = "<<setprecision(2)<<float(myHashTable.getCollisions())/myHashTable.getSize()<<endl;	
-	cout<<"==================================================="<<endl;
+	cout<<"==================================================="<<'\n';
+	cout<<"Size of HashTable                = "<<myHashTable.getSize()<<'\n';
+	cout<<"Total Number of Collisions       = "<<myHashTable.getCollisions()<<'\n';
+	cout<<"Avg. Number of Collisions/Entry  = "<<setprecision(2)<<float(myHashTable.getCollisions())/myHashTable.getSize()<<'\n';	
+	//the last histogram bucket with any insertions bounds the probe length
+	const vector<unsigned int>& histogram = myHashTable.getProbeHistogram();
+	unsigned int longestProbe = histogram.size();
+	while(longestProbe > 0 && histogram[longestProbe-1] == 0) longestProbe--;
+	cout<<"Longest Probe Sequence           = "<<longestProbe<<(longestProbe == histogram.size() ? "+" : "")<<'\n';
+	cout<<"Capacity of HashTable            = "<<myHashTable.getCapacity()<<'\n';
+	cout<<"Load Factor                      = "<<setprecision(2)<<myHashTable.getLoadFactor()<<'\n';
+	//everything the table holds (slots, string pool, records) spread over its live entries
+	MemoryStats memory = myHashTable.getMemoryStats();
+	unsigned long memoryBytes = memory.tableBytes + memory.poolBytes + memory.recordBytes;
+	cout<<"Bytes per Entry                  = "<<(memory.entries ? memoryBytes / memory.entries : 0)<<'\n';
+	if(log) cout<<"Changes Replayed from the Log    = "<<replayed<<'\n';
+	cout<<"==================================================="<<'\n';
 	help();
-	string user_input, command, argument1, argument2, argument3;
+	string user_input;
+	Command command;
 
 	while(true)
 	{
-		user_input=command=argument1=argument2=argument3=""; //clear all old values
+		user_input.clear(); //clear the old line, getline leaves it alone at the end of input
 		cout<<">";
 		getline(cin,user_input);
-
-		stringstream sstr(user_input);
-		getline(sstr,command,' ');
-		command = normalizeCommand(command); //normalize input to match the command list
-		getline(sstr,argument1,':');
-		getline(sstr,argument2,':');
-		getline(sstr,argument3);
-			if(command == "find")   		  myHashTable.find(argument1);
-		else if(command == "import")		  myHashTable.import(argument1);
-		else if(command == "add")		      myHashTable.insert(argument1,argument2,argument3); //word,meaning,language
-		else if(command == "delWord")         myHashTable.delWord(argument1);
-		else if(command == "delTranslation")  myHashTable.delTranslation(argument1,argument2);
-		else if(command == "delMeaning")      myHashTable.delMeaning(argument1,argument2,argument3);
-		else if(command == "export")          myHashTable.exportData(argument1,argument2);
-		else if(command == "help")	  	      help();
-		else if(command == "exit")	  	      break;
-		else cout<<"Invalid command !!!"<<endl;
+		parseCommand(user_input, command);
+		if(!runCommand(cout, myHashTable, command, log)) break;
 	}
 	return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,108 @@
+#include "reverse.h"
+using namespace std;
+
+//constructor, the index starts out empty with a handful of buckets
+ReverseIndex::ReverseIndex() {
+	this->freeList = POSTING_END;
+	this->count = 0;
+	rehash(16);
+}
+
+//spreads the postings over a new bucket array
+void ReverseIndex::rehash(size_t bucketCount) {
+	buckets.resize(bucketCount);
+	for (size_t b = 0; b < bucketCount; b++) {
+		buckets[b] = POSTING_END;
+	}
+	//unused postings are not on any chain, and their keys are never looked at
+	vector<bool> unused(postings.size(), false);
+	for (unsigned int p = freeList; p != POSTING_END; p = postings[p].next) {
+		unused[p] = true;
+	}
+	for (size_t p = 0; p < postings.size(); p++) {
+		if (!unused[p]) {
+			unsigned int &head = buckets[postings[p].key & (bucketCount - 1)];
+			postings[p].next = head;
+			head = p;
+		}
+	}
+}
+
+//makes room for count postings without another allocation or rehash
+void ReverseIndex::reserve(size_t count) {
+	postings.reserve(count);
+	size_t bucketCount = buckets.size();
+	while (bucketCount < count) {
+		bucketCount *= 2;
+	}
+	if (bucketCount > buckets.size()) {
+		rehash(bucketCount);
+	}
+}
+
+//records that an entry has the meaning behind a key; a meaning the entry has twice is recorded twice
+void ReverseIndex::add(unsigned long key, unsigned int entry) {
+	//keep chains about one posting long
+	if (count + 1 > buckets.size()) {
+		rehash(buckets.size() * 2);
+	}
+	unsigned int p = freeList;
+	if (p != POSTING_END) {
+		freeList = postings[p].next;
+	}
+	else {
+		p = postings.size();
+		postings.resize(p + 1);
+	}
+	unsigned int &head = buckets[key & (buckets.size() - 1)];
+	postings[p].key = key;
+	postings[p].entry = entry;
+	postings[p].next = head;
+	head = p;
+	count++;
+}
+
+//forgets one record of an entry having the meaning behind a key
+void ReverseIndex::remove(unsigned long key, unsigned int entry) {
+	unsigned int *link = &buckets[key & (buckets.size() - 1)];
+	while (*link != POSTING_END) {
+		Posting &posting = postings[*link];
+		if (posting.key == key && posting.entry == entry) {
+			//unlink the posting and hand it to the free list
+			unsigned int p = *link;
+			*link = posting.next;
+			posting.next = freeList;
+			freeList = p;
+			count--;
+			return;
+		}
+		link = &posting.next;
+	}
+}
+
+//appends the entries recorded under a key, possibly with repeats and in no particular order
+void ReverseIndex::find(unsigned long key, vector<unsigned int>& entries) const {
+	for (unsigned int p = buckets[key & (buckets.size() - 1)]; p != POSTING_END; p = postings[p].next) {
+		if (postings[p].key == key) {
+			entries.push_back(postings[p].entry);
+		}
+	}
+}
+
+//returns the number of postings in use
+unsigned int ReverseIndex::size() const {
+	return count;
+}
+
+//returns the memory the index holds
+unsigned long ReverseIndex::bytes() const {
+	return buckets.bytes() + postings.bytes();
+}
+
+//drops every posting
+void ReverseIndex::clear() {
+	postings.clear();
+	freeList = POSTING_END;
+	count = 0;
+	rehash(16);
+}
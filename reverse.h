@@ -0,0 +1,42 @@
+#ifndef _REVERSE
+#define _REVERSE
+#include <vector>
+#include "store.h"
+using namespace std;
+
+//marks the end of a posting chain
+const unsigned int POSTING_END = 0xFFFFFFFF;
+
+//one (meaning, entry) pair of the reverse index, chained with the other postings of its bucket
+struct Posting
+{
+	unsigned long key;		// hash of the language and the case-folded meaning
+	unsigned int entry;		// entry that has the meaning
+	unsigned int next;		// next posting of the bucket (or of the free list)
+};
+
+//secondary index from a meaning in a language to the entries that have it. It is a chained
+//multimap in two flat arrays: a bucket array of chain heads and a posting array whose
+//unused records form a free list. Meanings are known only by their 64-bit key.
+class ReverseIndex
+{
+	private:
+		PodArray<unsigned int> buckets;		// first posting of each bucket, a power of two of them
+		PodArray<Posting> postings;
+		unsigned int freeList;				// first unused posting
+		unsigned int count;					// postings in use
+		void rehash(size_t bucketCount);
+		ReverseIndex(const ReverseIndex&);
+		ReverseIndex& operator=(const ReverseIndex&);
+	public:
+		ReverseIndex();
+		void reserve(size_t count);
+		void add(unsigned long key, unsigned int entry);
+		void remove(unsigned long key, unsigned int entry);
+		void find(unsigned long key, vector<unsigned int>& entries) const;
+		unsigned int size() const;
+		unsigned long bytes() const;
+		void clear();
+};
+
+#endif
@@ -0,0 +1,61 @@
+#include "stats.h"
+#include <mutex>
+#include <vector>
+#include <algorithm>
+using namespace std;
+
+//blocks of the running threads, and what the finished ones counted
+static mutex statsLock;
+static vector<StatBlock*> liveBlocks;
+static unsigned long retired[STAT_COUNT];
+static unsigned long retiredProbeLengths[STAT_PROBE_BUCKETS];
+
+thread_local StatBlock localStats;
+
+//constructor, registers the thread's zeroed block
+StatBlock::StatBlock() {
+	for (unsigned int i = 0; i < STAT_COUNT; i++) counters[i].store(0, memory_order_relaxed);
+	for (unsigned int i = 0; i < STAT_PROBE_BUCKETS; i++) probeLengths[i].store(0, memory_order_relaxed);
+	lock_guard<mutex> guard(statsLock);
+	liveBlocks.push_back(this);
+}
+
+//destructor, keeps what the thread counted after it is gone
+StatBlock::~StatBlock() {
+	lock_guard<mutex> guard(statsLock);
+	for (unsigned int i = 0; i < STAT_COUNT; i++) retired[i] += counters[i].load(memory_order_relaxed);
+	for (unsigned int i = 0; i < STAT_PROBE_BUCKETS; i++) retiredProbeLengths[i] += probeLengths[i].load(memory_order_relaxed);
+	liveBlocks.erase(find(liveBlocks.begin(), liveBlocks.end(), this));
+}
+
+//sums the counters of every thread, running or finished, since the last reset
+void readStats(unsigned long counters[STAT_COUNT], unsigned long probeLengths[STAT_PROBE_BUCKETS]) {
+	lock_guard<mutex> guard(statsLock);
+	for (unsigned int i = 0; i < STAT_COUNT; i++) counters[i] = retired[i];
+	for (unsigned int i = 0; i < STAT_PROBE_BUCKETS; i++) probeLengths[i] = retiredProbeLengths[i];
+	for (StatBlock *block : liveBlocks) {
+		for (unsigned int i = 0; i < STAT_COUNT; i++) counters[i] += block->counters[i].load(memory_order_relaxed);
+		for (unsigned int i = 0; i < STAT_PROBE_BUCKETS; i++) probeLengths[i] += block->probeLengths[i].load(memory_order_relaxed);
+	}
+}
+
+//zeroes every thread's counters; a thread counting at the same moment may keep one update
+void resetStats() {
+	lock_guard<mutex> guard(statsLock);
+	for (unsigned int i = 0; i < STAT_COUNT; i++) retired[i] = 0;
+	for (unsigned int i = 0; i < STAT_PROBE_BUCKETS; i++) retiredProbeLengths[i] = 0;
+	for (StatBlock *block : liveBlocks) {
+		for (unsigned int i = 0; i < STAT_COUNT; i++) block->counters[i].store(0, memory_order_relaxed);
+		for (unsigned int i = 0; i < STAT_PROBE_BUCKETS; i++) block->probeLengths[i].store(0, memory_order_relaxed);
+	}
+}
+
+//name of a counter in reports and dumps
+const char* statName(StatCounter counter) {
+	static const char* names[STAT_COUNT] = {
+		"find_hits", "find_misses", "find_nanos", "probe_groups", "probe_tombstones",
+		"inserts", "insert_nanos", "deletes", "delete_nanos", "rehashes", "compactions",
+		"import_lines", "import_bytes", "import_nanos"
+	};
+	return names[counter];
+}
@@ -0,0 +1,93 @@
+#ifndef _STATS
+#define _STATS
+#include <atomic>
+#include <chrono>
+using namespace std;
+
+//HT_STATS=1 compiles counters and timers into the hot paths of the table (make STATS=1).
+//At 0, the default, every STAT_ macro expands to nothing: the arguments are not even
+//evaluated, so production builds pay nothing for them.
+#ifndef HT_STATS
+#define HT_STATS 0
+#endif
+
+//what the hot paths count; the _NANOS ones add up wall-clock time. Counts cover every table
+//of the process, so a ConcurrentTable counts each change once per copy.
+enum StatCounter {
+	STAT_FIND_HITS,
+	STAT_FIND_MISSES,
+	STAT_FIND_NANOS,
+	STAT_PROBE_GROUPS,			// groups of control bytes scanned by lookups
+	STAT_PROBE_TOMBSTONES,		// tombstones among the control bytes scanned by any probe
+	STAT_INSERTS,
+	STAT_INSERT_NANOS,
+	STAT_DELETES,				// delWord, delTranslation and delMeaning calls
+	STAT_DELETE_NANOS,
+	STAT_REHASHES,				// tables allocated to grow or to drop tombstones
+	STAT_COMPACTIONS,			// store compactions
+	STAT_IMPORT_LINES,
+	STAT_IMPORT_BYTES,
+	STAT_IMPORT_NANOS,
+	STAT_COUNT
+};
+
+//buckets of the probe length histogram: lookups scanning 1, 2, ... groups, the last one collecting longer scans
+const unsigned int STAT_PROBE_BUCKETS = 16;
+
+//one thread's counters. Only the owning thread writes them, with plain relaxed loads and
+//stores (no locked instructions); readers sum every thread's block.
+struct StatBlock
+{
+	atomic<unsigned long> counters[STAT_COUNT];
+	atomic<unsigned long> probeLengths[STAT_PROBE_BUCKETS];
+	StatBlock();
+	~StatBlock();
+};
+
+//counters of the calling thread, registered on first use and folded into the totals when the thread ends
+extern thread_local StatBlock localStats;
+
+inline void statBump(atomic<unsigned long>& counter, unsigned long n) {
+	counter.store(counter.load(memory_order_relaxed) + n, memory_order_relaxed);
+}
+
+inline void statAdd(StatCounter counter, unsigned long n) {
+	statBump(localStats.counters[counter], n);
+}
+
+inline void statProbeLength(unsigned int groups) {
+	statBump(localStats.probeLengths[groups == 0 ? 0 : groups <= STAT_PROBE_BUCKETS ? groups - 1 : STAT_PROBE_BUCKETS - 1], 1);
+}
+
+//adds the time from its construction to its destruction to a _NANOS counter
+class StatTimer
+{
+	private:
+		StatCounter counter;
+		chrono::steady_clock::time_point start;
+	public:
+		StatTimer(StatCounter counter) : counter(counter), start(chrono::steady_clock::now()) {}
+		~StatTimer() {
+			statAdd(counter, chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count());
+		}
+};
+
+//sums the counters of every thread, running or finished, since the last reset
+void readStats(unsigned long counters[STAT_COUNT], unsigned long probeLengths[STAT_PROBE_BUCKETS]);
+
+//zeroes every thread's counters
+void resetStats();
+
+//name of a counter in reports and dumps
+const char* statName(StatCounter counter);
+
+#if HT_STATS
+#define STAT_ADD(counter, n) statAdd(counter, n)
+#define STAT_PROBE_LENGTH(groups) statProbeLength(groups)
+#define STAT_TIME(counter) StatTimer statTimer(counter)
+#else
+#define STAT_ADD(counter, n) ((void)0)
+#define STAT_PROBE_LENGTH(groups) ((void)0)
+#define STAT_TIME(counter) ((void)0)
+#endif
+#endif
@@ -0,0 +1,584 @@
+#include "store.h"
+#include "unicode.h"
+#include "hashpolicy.h"
+using namespace std;
+
+//constructor for the store, starts out empty
+EntryStore::EntryStore() {
+	//nothing has been left behind yet
+	this->garbage = 0;
+	//an empty store has empty member lists
+	this->listed = true;
+}
+
+//makes room for one more record at the end of a range of array; a full range is
+//extended in place when it is the last one, and otherwise moved to the end with twice the room
+template<class T, class Count>
+static void makeRoom(PodArray<T>& array, unsigned int& first, Count count, Count& capacity, Count limit, unsigned long& garbage) {
+	if (count < capacity) {
+		return;
+	}
+	Count grown = capacity == 0 ? 1 : (capacity > limit / 2 ? limit : capacity * 2);
+	if (first + capacity == array.size()) {
+		array.resize(first + grown);
+	}
+	else {
+		unsigned int moved = array.size();
+		array.resize(moved + grown);
+		for (Count i = 0; i < count; i++) {
+			array[moved + i] = array[first + i];
+		}
+		garbage += capacity * sizeof(T);
+		first = moved;
+	}
+	capacity = grown;
+}
+
+//hash of the caseless key of a meaning; never 0, which marks a hash not computed yet
+static unsigned int foldedHash(const char *meaning, size_t length) {
+	static thread_local string key;
+	foldCase(meaning, length, key);
+	unsigned int hash = slotHashOf<KeyHash>(key.data(), key.size());
+	return hash != 0 ? hash : 1;
+}
+
+//open-addressing set of meaning hashes and the positions of their meanings in a translation.
+//It is filled for one batch of meanings at a time; its arrays are kept for the next batch.
+class MeaningSet
+{
+	private:
+		vector<unsigned int> hashes;		// 0 marks an empty slot
+		vector<unsigned int> positions;
+		unsigned int mask;
+	public:
+		//empties the set and makes room for count meanings at half load
+		void reset(size_t count) {
+			size_t size = 16;
+			while (size < 2 * count) size <<= 1;
+			hashes.assign(size, 0);
+			positions.resize(size);
+			mask = size - 1;
+		}
+		void add(unsigned int hash, unsigned int position) {
+			unsigned int i = hash & mask;
+			while (hashes[i] != 0) i = (i + 1) & mask;
+			hashes[i] = hash;
+			positions[i] = position;
+		}
+		//true if same(position) holds for a position stored under the hash
+		template<class Same>
+		bool contains(unsigned int hash, const Same& same) const {
+			for (unsigned int i = hash & mask; hashes[i] != 0; i = (i + 1) & mask) {
+				if (hashes[i] == hash && same(positions[i])) {
+					return true;
+				}
+			}
+			return false;
+		}
+};
+
+//copies a string into the pool
+StrRef EntryStore::addString(const char *str, size_t length) {
+	StrRef ref;
+	ref.offset = pool.size();
+	ref.length = length;
+	pool.append(str, length);
+	return ref;
+}
+
+//returns the number of entries, tombstoned ones included
+unsigned int EntryStore::size() const {
+	return entries.size();
+}
+
+//returns the record of an entry
+Entry& EntryStore::entry(unsigned int index) {
+	return entries[index];
+}
+
+const Entry& EntryStore::entry(unsigned int index) const {
+	return entries[index];
+}
+
+//returns the i-th translation of an entry
+const Translation& EntryStore::translation(const Entry& entry, unsigned int i) const {
+	return translations[entry.firstTranslation + i];
+}
+
+//returns the i-th meaning of a translation
+StrRef EntryStore::meaning(const Translation& translation, unsigned int i) const {
+	return meanings[translation.firstMeaning + i];
+}
+
+//returns the characters of a pooled string (not NUL-terminated)
+const char* EntryStore::text(StrRef ref) const {
+	return pool.data() + ref.offset;
+}
+
+//returns a pooled string as a new string
+string EntryStore::str(StrRef ref) const {
+	return string(text(ref), ref.length);
+}
+
+//returns the id of a language, interning it if it is new; spellings that fold alike share an id
+unsigned short EntryStore::internLanguage(const string& language) {
+	int id = findLanguage(language);
+	if (id >= 0) {
+		return id;
+	}
+	languages.push_back(language);
+	languageKeys.push_back(foldCase(language));
+	return languages.size() - 1;
+}
+
+//returns the id of a language, or -1 if no entry has ever used it
+int EntryStore::findLanguage(const string& language) const {
+	static thread_local string key;
+	foldCase(language, key);
+	//a dictionary holds a handful of languages, a scan beats any index
+	for (unsigned int i = 0; i < languageKeys.size(); i++) {
+		if (languageKeys[i] == key) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+//returns the name a language id was first interned with
+const string& EntryStore::languageName(unsigned short language) const {
+	return languages[language];
+}
+
+//returns the number of interned languages
+unsigned int EntryStore::languageCount() const {
+	return languages.size();
+}
+
+//takes over another store's language ids, so records can move between the two unchanged
+void EntryStore::shareLanguages(const EntryStore& other) {
+	languages = other.languages;
+	languageKeys = other.languageKeys;
+}
+
+//appends an empty translation in a language to an entry and returns its index in the translation array
+unsigned int EntryStore::newTranslation(unsigned int entry, unsigned short language) {
+	Entry &e = entries[entry];
+	makeRoom(translations, e.firstTranslation, e.translationCount, e.translationCapacity, (unsigned short)0xFFFF, garbage);
+	unsigned int index = e.firstTranslation + e.translationCount++;
+	Translation &T = translations[index];
+	//padding is zeroed too, so snapshots of equal tables are equal byte for byte
+	memset(&T, 0, sizeof(T));
+	T.firstMeaning = meanings.size();
+	T.meaningCount = 0;
+	T.meaningCapacity = 0;
+	T.language = language;
+	list(entry, language, true);
+	return index;
+}
+
+//returns the stored hash of the meaning record at index, or 0 if it was never computed
+unsigned int EntryStore::meaningHash(unsigned int index) const {
+	return index < meaningHashes.size() ? meaningHashes[index] : 0;
+}
+
+//makes the hash array as long as the meaning array, the new hashes unknown
+static void syncHashes(PodArray<unsigned int>& hashes, size_t count) {
+	size_t known = hashes.size();
+	if (known < count) {
+		hashes.resize(count);
+		memset(&hashes[known], 0, (count - known) * sizeof(unsigned int));
+	}
+}
+
+//computes the hashes of a translation's meanings that are not known yet
+void EntryStore::hashMeanings(const Translation& translation) {
+	syncHashes(meaningHashes, meanings.size());
+	for (unsigned int m = 0; m < translation.meaningCount; m++) {
+		unsigned int &hash = meaningHashes[translation.firstMeaning + m];
+		if (hash == 0) {
+			StrRef ref = meanings[translation.firstMeaning + m];
+			hash = foldedHash(text(ref), ref.length);
+		}
+	}
+}
+
+//appends a meaning to a translation with the hash of its caseless key (0 if not known). Once
+//any hash is known, the hash array grows with the meaning array and hashes move with their range.
+void EntryStore::appendMeaning(unsigned int translation, StrRef meaning, unsigned int hash) {
+	Translation &T = translations[translation];
+	unsigned int first = T.firstMeaning;
+	makeRoom(meanings, T.firstMeaning, T.meaningCount, T.meaningCapacity, 0xFFFFFFFFu, garbage);
+	unsigned int index = T.firstMeaning + T.meaningCount++;
+	meanings[index] = meaning;
+	if (meaningHashes.size() == 0 && hash == 0) {
+		return;
+	}
+	syncHashes(meaningHashes, meanings.size());
+	for (unsigned int m = 0; T.firstMeaning != first && m + 1 < T.meaningCount; m++) {
+		meaningHashes[T.firstMeaning + m] = meaningHashes[first + m];
+	}
+	meaningHashes[index] = hash;
+}
+
+//adds the ';'-separated meanings to a translation, skipping empty ones; with unique set, also
+//skipping ones the translation already has (case-insensitive). Returns how many were added.
+unsigned int EntryStore::addMeanings(unsigned int translation, const char *newMeanings, size_t length, bool unique) {
+	static thread_local vector<TextView> runs;
+	runs.clear();
+	const char *end = newMeanings + length;
+	for (const char *p = newMeanings; p <= end; p++) {
+		//each meaning runs up to the next ';'
+		const char *semicolon = (const char*)memchr(p, ';', end - p);
+		const char *stop = semicolon != nullptr ? semicolon : end;
+		TextView run = { p, (unsigned int)(stop - p) };
+		runs.push_back(run);
+		p = stop;
+	}
+	return addMeaningRuns(translation, runs.data(), runs.size(), unique);
+}
+
+//adds count meanings to a translation, skipping empty ones and, with unique set, ones it already
+//has. Below MEANING_HASH_MIN pairs a new one is compared with each in place; above, it is
+//folded once and its hash compared with the stored hashes, only a match as text. A batch
+//added to a large translation goes through a hash set instead of a scan per meaning, so
+//merging grows linearly with the meanings.
+unsigned int EntryStore::addMeaningRuns(unsigned int translation, const TextView *runs, size_t count, bool unique) {
+	static thread_local MeaningSet set;
+	unsigned int added = 0;
+	bool hashed = unique && translations[translation].meaningCount * count >= MEANING_HASH_MIN;
+	bool useSet = false;
+	if (hashed) {
+		const Translation &T = translations[translation];
+		hashMeanings(T);
+		useSet = count > 1 && T.meaningCount + count > MEANING_SET_MIN;
+		if (useSet) {
+			set.reset(T.meaningCount + count);
+			for (unsigned int m = 0; m < T.meaningCount; m++) {
+				set.add(meaningHashes[T.firstMeaning + m], m);
+			}
+		}
+	}
+	for (size_t i = 0; i < count; i++) {
+		const char *p = runs[i].data;
+		unsigned int length = runs[i].length;
+		if (length == 0) {
+			continue;
+		}
+		unsigned int hash = 0;
+		if (unique) {
+			hash = hashed ? foldedHash(p, length) : 0;
+			const Translation &T = translations[translation];
+			auto same = [&](unsigned int m) {
+				StrRef ref = meanings[T.firstMeaning + m];
+				return equalsFolded(text(ref), ref.length, p, length);
+			};
+			bool exists = false;
+			if (useSet) {
+				exists = set.contains(hash, same);
+			}
+			for (unsigned int m = 0; !useSet && m < T.meaningCount && !exists; m++) {
+				exists = (!hashed || meaningHashes[T.firstMeaning + m] == hash) && same(m);
+			}
+			if (exists) {
+				continue;
+			}
+		}
+		appendMeaning(translation, addString(p, length), hash);
+		if (useSet) {
+			set.add(hash, translations[translation].meaningCount - 1);
+		}
+		added++;
+	}
+	return added;
+}
+
+//stores a new entry with one translation and returns its index
+unsigned int EntryStore::addEntry(const char *word, size_t wordLength, const string& key, const char *newMeanings, size_t length, unsigned short language) {
+	Entry e;
+	memset(&e, 0, sizeof(e));
+	e.word = addString(word, wordLength);
+	//most words are their own key, those share the bytes
+	if (key.size() == wordLength && memcmp(key.data(), word, wordLength) == 0) {
+		e.key = e.word;
+	}
+	else {
+		e.key = addString(key.data(), key.size());
+	}
+	e.firstTranslation = translations.size();
+	e.translationCount = 0;
+	e.translationCapacity = 0;
+	e.deleted = false;
+	entries.push_back(e);
+	unsigned int index = entries.size() - 1;
+	//a new translation keeps every non-empty meaning it is given, duplicates included
+	addMeanings(newTranslation(index, language), newMeanings, length, false);
+	return index;
+}
+
+//adds meanings to the entry's translation in a language, creating the translation if needed
+void EntryStore::addTranslation(unsigned int entry, const char *newMeanings, size_t length, unsigned short language) {
+	int t = findTranslation(entry, language);
+	if (t >= 0) {
+		addMeanings(entries[entry].firstTranslation + t, newMeanings, length, true);
+		return;
+	}
+	addMeanings(newTranslation(entry, language), newMeanings, length, false);
+}
+
+//merges another store's entry for the same word into an entry, as if its records had been added here one by one
+void EntryStore::mergeTranslations(unsigned int entry, const EntryStore& other, unsigned int otherEntry) {
+	const Entry &source = other.entries[otherEntry];
+	for (unsigned int i = 0; i < source.translationCount; i++) {
+		const Translation &T = other.translations[source.firstTranslation + i];
+		int t = findTranslation(entry, T.language);
+		unsigned int target = t >= 0 ? entries[entry].firstTranslation + t : newTranslation(entry, T.language);
+		static thread_local vector<TextView> runs;
+		runs.clear();
+		for (unsigned int m = 0; m < T.meaningCount; m++) {
+			StrRef ref = other.meanings[T.firstMeaning + m];
+			TextView run = { other.text(ref), ref.length };
+			runs.push_back(run);
+		}
+		//a new language is taken over as it was built, an existing one checks each meaning like addMeanings
+		addMeaningRuns(target, runs.data(), runs.size(), t >= 0);
+	}
+}
+
+//copies another store's entry into this one, with exactly sized ranges, and returns its index
+unsigned int EntryStore::copyEntry(const EntryStore& other, unsigned int otherEntry) {
+	const Entry &source = other.entries[otherEntry];
+	Entry e;
+	memset(&e, 0, sizeof(e));
+	e.word = addString(other.text(source.word), source.word.length);
+	e.key = source.key.offset == source.word.offset ? e.word : addString(other.text(source.key), source.key.length);
+	e.firstTranslation = translations.size();
+	e.translationCount = source.translationCount;
+	e.translationCapacity = source.translationCount;
+	e.deleted = false;
+	translations.resize(translations.size() + source.translationCount);
+	for (unsigned int i = 0; i < source.translationCount; i++) {
+		const Translation &from = other.translations[source.firstTranslation + i];
+		Translation &to = translations[e.firstTranslation + i];
+		memset(&to, 0, sizeof(to));
+		to.language = from.language;
+		to.firstMeaning = meanings.size();
+		to.meaningCount = from.meaningCount;
+		to.meaningCapacity = from.meaningCount;
+		list(entries.size(), from.language, true);
+		for (unsigned int m = 0; m < from.meaningCount; m++) {
+			StrRef ref = other.meanings[from.firstMeaning + m];
+			meanings.push_back(addString(other.text(ref), ref.length));
+			//known hashes come along
+			unsigned int hash = other.meaningHash(from.firstMeaning + m);
+			if (hash != 0 || meaningHashes.size() > 0) {
+				syncHashes(meaningHashes, meanings.size());
+				meaningHashes[meanings.size() - 1] = hash;
+			}
+		}
+	}
+	entries.push_back(e);
+	return entries.size() - 1;
+}
+
+//returns the position of the entry's translation in a language, or -1
+int EntryStore::findTranslation(unsigned int entry, unsigned short language) const {
+	const Entry &e = entries[entry];
+	for (unsigned int i = 0; i < e.translationCount; i++) {
+		if (translations[e.firstTranslation + i].language == language) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+//returns the position of a meaning (case-insensitive) in the entry's t-th translation, or -1
+int EntryStore::findMeaning(unsigned int entry, unsigned int t, const string& meaning) const {
+	const Translation &T = translations[entries[entry].firstTranslation + t];
+	unsigned int hash = 0;
+	for (unsigned int m = 0; m < T.meaningCount; m++) {
+		//a known hash rules most meanings out without comparing them
+		unsigned int known = meaningHash(T.firstMeaning + m);
+		if (known != 0 && hash == 0) {
+			hash = foldedHash(meaning.data(), meaning.size());
+		}
+		StrRef ref = meanings[T.firstMeaning + m];
+		if ((known == 0 || known == hash) && equalsFolded(text(ref), ref.length, meaning.data(), meaning.size())) {
+			return m;
+		}
+	}
+	return -1;
+}
+
+//removes the entry's t-th translation, keeping the order of the others
+void EntryStore::eraseTranslation(unsigned int entry, unsigned int t) {
+	Entry &e = entries[entry];
+	const Translation &T = translations[e.firstTranslation + t];
+	for (unsigned int m = 0; m < T.meaningCount; m++) {
+		garbage += meanings[T.firstMeaning + m].length;
+	}
+	garbage += T.meaningCapacity * sizeof(StrRef);
+	list(entry, T.language, false);
+	for (unsigned int i = e.firstTranslation + t; i + 1 < e.firstTranslation + e.translationCount; i++) {
+		translations[i] = translations[i + 1];
+	}
+	e.translationCount--;
+}
+
+//removes the m-th meaning of the entry's t-th translation, keeping the order of the others
+void EntryStore::eraseMeaning(unsigned int entry, unsigned int t, unsigned int m) {
+	Translation &T = translations[entries[entry].firstTranslation + t];
+	garbage += meanings[T.firstMeaning + m].length;
+	for (unsigned int i = T.firstMeaning + m; i + 1 < T.firstMeaning + T.meaningCount; i++) {
+		meanings[i] = meanings[i + 1];
+		if (i + 1 < meaningHashes.size()) {
+			meaningHashes[i] = meaningHashes[i + 1];
+		}
+	}
+	T.meaningCount--;
+}
+
+//gives up what a tombstoned entry still refers to; its record stays so indices do not shift
+void EntryStore::release(unsigned int entry) {
+	Entry &e = entries[entry];
+	garbage += e.word.length + (e.key.offset != e.word.offset ? e.key.length : 0);
+	while (e.translationCount > 0) {
+		eraseTranslation(entry, e.translationCount - 1);
+	}
+	garbage += e.translationCapacity * sizeof(Translation) + sizeof(Entry);
+	e.translationCapacity = 0;
+}
+
+//sets or clears an entry's bit in the member list of a language
+void EntryStore::list(unsigned int entry, unsigned short language, bool member) {
+	if (!listed) {
+		return;
+	}
+	if (language >= members.size()) {
+		members.resize(language + 1);
+	}
+	vector<unsigned long> &bits = members[language];
+	if (entry / 64 >= bits.size()) {
+		if (!member) {
+			return;
+		}
+		bits.resize(entry / 64 + 1, 0);
+	}
+	if (member) bits[entry / 64] |= 1UL << (entry % 64);
+	else bits[entry / 64] &= ~(1UL << (entry % 64));
+}
+
+//takes a deleted entry out of the member lists of all its languages
+void EntryStore::unlist(unsigned int entry) {
+	const Entry &e = entries[entry];
+	for (unsigned int t = 0; t < e.translationCount; t++) {
+		list(entry, translations[e.firstTranslation + t].language, false);
+	}
+}
+
+//drops the member lists; the next call to languageMembers rebuilds them from the entries
+void EntryStore::forgetMembers() {
+	members.clear();
+	listed = false;
+}
+
+//returns the bit set of the live entries with a translation in a language, rebuilding every
+//list first if they were forgotten. Not safe to call from several threads while that happens.
+const vector<unsigned long>& EntryStore::languageMembers(unsigned short language) {
+	if (!listed) {
+		listed = true;
+		for (unsigned int i = 0; i < entries.size(); i++) {
+			if (!entries[i].deleted) {
+				for (unsigned int t = 0; t < entries[i].translationCount; t++) {
+					list(i, translations[entries[i].firstTranslation + t].language, true);
+				}
+			}
+		}
+	}
+	//every interned language gets its list now, so no later call moves the one returned
+	if (members.size() < languages.size()) {
+		members.resize(languages.size());
+	}
+	return members[language];
+}
+
+//returns the memory the store holds
+StoreStats EntryStore::stats() const {
+	StoreStats stats;
+	stats.poolBytes = pool.bytes();
+	stats.recordBytes = entries.bytes() + translations.bytes() + meanings.bytes() + meaningHashes.bytes();
+	for (const vector<unsigned long> &bits : members) {
+		stats.recordBytes += bits.capacity() * sizeof(unsigned long);
+	}
+	stats.garbageBytes = garbage;
+	stats.writtenBytes = pool.size() + entries.size() * sizeof(Entry) + translations.size() * sizeof(Translation) + meanings.size() * sizeof(StrRef);
+	return stats;
+}
+
+//copies records borrowed from a snapshot into memory of the store's own
+void EntryStore::own() {
+	pool.own();
+	entries.own();
+	translations.own();
+	meanings.own();
+}
+
+//drops every entry and language
+void EntryStore::clear() {
+	pool.clear();
+	entries.clear();
+	translations.clear();
+	meanings.clear();
+	meaningHashes.clear();
+	languages.clear();
+	languageKeys.clear();
+	members.clear();
+	listed = true;
+	garbage = 0;
+}
+
+//trades contents with another store
+void EntryStore::swap(EntryStore& other) {
+	pool.swap(other.pool);
+	entries.swap(other.entries);
+	translations.swap(other.translations);
+	meanings.swap(other.meanings);
+	meaningHashes.swap(other.meaningHashes);
+	languages.swap(other.languages);
+	languageKeys.swap(other.languageKeys);
+	members.swap(other.members);
+	std::swap(listed, other.listed);
+	std::swap(garbage, other.garbage);
+}
+
+//returns the name of the translation's language
+const string& TranslationView::language() const {
+	return store->languageName(record->language);
+}
+
+//returns the number of meanings of the translation
+unsigned int TranslationView::meaningCount() const {
+	return record->meaningCount;
+}
+
+//returns the i-th meaning of the translation
+TextView TranslationView::meaning(unsigned int i) const {
+	StrRef ref = store->meaning(*record, i);
+	TextView view = { store->text(ref), ref.length };
+	return view;
+}
+
+//returns the word as it was first inserted
+TextView EntryView::word() const {
+	TextView view = { store->text(record->word), record->word.length };
+	return view;
+}
+
+//returns the number of translations of the word
+unsigned int EntryView::translationCount() const {
+	return record->translationCount;
+}
+
+//returns the i-th translation of the word
+TranslationView EntryView::translation(unsigned int i) const {
+	return TranslationView(store, &store->translation(*record, i));
+}
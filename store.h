@@ -0,0 +1,263 @@
+#ifndef _STORE
+#define _STORE
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+using namespace std;
+
+//a string in the pool: where it starts and how many bytes it has
+struct StrRef
+{
+	unsigned int offset;
+	unsigned int length;
+};
+
+//one language of a word: a range of the meaning array
+struct Translation
+{
+	unsigned int firstMeaning;		// first meaning of the range
+	unsigned int meaningCount;		// meanings in use
+	unsigned int meaningCapacity;	// meanings the range holds before it has to move
+	unsigned short language;		// interned language id
+};
+
+//one word: its strings in the pool and a range of the translation array
+struct Entry
+{
+	StrRef word;
+	StrRef key;						// case-folded, NFC-normalized word, compared on every probe
+	unsigned int firstTranslation;	// first translation of the range
+	unsigned short translationCount;
+	unsigned short translationCapacity;
+	bool deleted;					// the slot pointing here is a tombstone
+};
+
+//growable array of plain records. It can also borrow memory it does not own (a mapped
+//snapshot); the first change, or own(), copies the records into memory of its own.
+template<class T>
+class PodArray
+{
+	private:
+		T *items;
+		size_t count;
+		size_t capacity;
+		bool borrowed;
+		PodArray(const PodArray&);
+		PodArray& operator=(const PodArray&);
+	public:
+		PodArray() : items(nullptr), count(0), capacity(0), borrowed(false) {}
+		~PodArray() {
+			clear();
+		}
+		T& operator[](size_t i) {
+			return items[i];
+		}
+		const T& operator[](size_t i) const {
+			return items[i];
+		}
+		size_t size() const {
+			return count;
+		}
+		const T* data() const {
+			return items;
+		}
+		//heap bytes held; borrowed records cost nothing
+		size_t bytes() const {
+			return borrowed ? 0 : capacity * sizeof(T);
+		}
+		//makes sure n records fit without another allocation, doubling to keep appends amortized
+		void reserve(size_t n) {
+			if (n <= capacity && !borrowed) {
+				return;
+			}
+			size_t grown = capacity * 2 > n ? capacity * 2 : n;
+			if (grown < 16) grown = 16;
+			T *fresh = (T*)malloc(grown * sizeof(T));
+			if (count > 0) {
+				memcpy(fresh, items, count * sizeof(T));
+			}
+			if (!borrowed) {
+				free(items);
+			}
+			items = fresh;
+			capacity = grown;
+			borrowed = false;
+		}
+		void resize(size_t n) {
+			reserve(n);
+			count = n;
+		}
+		void push_back(const T& item) {
+			//item may live in this array, so it is copied before the array can move
+			T copy = item;
+			reserve(count + 1);
+			items[count++] = copy;
+		}
+		//appends n records from memory outside this array
+		void append(const T *source, size_t n) {
+			if (n == 0) {
+				return;
+			}
+			reserve(count + n);
+			memcpy(items + count, source, n * sizeof(T));
+			count += n;
+		}
+		//views n records owned by someone else
+		void borrow(const T *source, size_t n) {
+			clear();
+			items = (T*)source;
+			count = n;
+			capacity = n;
+			borrowed = true;
+		}
+		//trades contents with another array
+		void swap(PodArray& other) {
+			std::swap(items, other.items);
+			std::swap(count, other.count);
+			std::swap(capacity, other.capacity);
+			std::swap(borrowed, other.borrowed);
+		}
+		//gives back the room past the last record
+		void shrink() {
+			if (borrowed || count == capacity) {
+				return;
+			}
+			T *fresh = (T*)malloc((count > 0 ? count : 1) * sizeof(T));
+			if (count > 0) {
+				memcpy(fresh, items, count * sizeof(T));
+			}
+			free(items);
+			items = fresh;
+			capacity = count;
+		}
+		//copies borrowed records into memory of its own
+		void own() {
+			if (borrowed) {
+				reserve(count);
+			}
+		}
+		void clear() {
+			if (!borrowed) {
+				free(items);
+			}
+			items = nullptr;
+			count = 0;
+			capacity = 0;
+			borrowed = false;
+		}
+};
+
+//a string of the pool seen in place; valid until the table next changes
+struct TextView
+{
+	const char *data;
+	unsigned int length;
+};
+
+//below this many pairs of stored and new meanings, new ones are compared with each stored one
+//in place, which costs less than folding and hashing them all
+const unsigned int MEANING_HASH_MIN = 32;
+//translations with more meanings than this check a batch of new ones against a hash set
+//built for the batch instead of against each meaning in turn
+const unsigned int MEANING_SET_MIN = 16;
+
+//memory held by a store, in bytes
+struct StoreStats
+{
+	unsigned long poolBytes;		// string pool reserved
+	unsigned long recordBytes;		// entry, translation and meaning records and language member lists reserved
+	unsigned long garbageBytes;		// strings and records nothing refers to any more
+	unsigned long writtenBytes;		// pool and record bytes filled so far, live or garbage
+};
+
+//storage engine for entries: every string lives in one bump-allocated pool, languages are
+//interned as small ids, and translations and meanings are ranges of flat record arrays.
+//A range that outgrows its capacity moves to the end of its array with twice the room.
+class EntryStore
+{
+	private:
+		PodArray<char> pool;				// words, keys, meanings and language names, back to back
+		PodArray<Entry> entries;
+		PodArray<Translation> translations;
+		PodArray<StrRef> meanings;
+		PodArray<unsigned int> meaningHashes;	// hash of each meaning's caseless key, 0 until needed; may be shorter than meanings
+		vector<string> languages;			// display name per language id, as first seen
+		vector<string> languageKeys;		// caseless key per language id
+		vector<vector<unsigned long> > members;	// per language id, one bit per entry: live with a translation in it
+		bool listed;						// members is up to date (not yet rebuilt after borrowing a snapshot)
+		unsigned long garbage;				// bytes of strings and records left behind
+		StrRef addString(const char *str, size_t length);
+		unsigned int addMeanings(unsigned int translation, const char *meanings, size_t length, bool unique);
+		unsigned int addMeaningRuns(unsigned int translation, const TextView *runs, size_t count, bool unique);
+		unsigned int newTranslation(unsigned int entry, unsigned short language);
+		void appendMeaning(unsigned int translation, StrRef meaning, unsigned int hash);
+		unsigned int meaningHash(unsigned int index) const;
+		void hashMeanings(const Translation& translation);
+		void list(unsigned int entry, unsigned short language, bool member);
+	public:
+		EntryStore();
+		unsigned int size() const;
+		Entry& entry(unsigned int index);
+		const Entry& entry(unsigned int index) const;
+		const Translation& translation(const Entry& entry, unsigned int i) const;
+		StrRef meaning(const Translation& translation, unsigned int i) const;
+		const char* text(StrRef ref) const;
+		string str(StrRef ref) const;
+		unsigned short internLanguage(const string& language);
+		int findLanguage(const string& language) const;
+		const string& languageName(unsigned short language) const;
+		unsigned int languageCount() const;
+		void shareLanguages(const EntryStore& other);
+		unsigned int addEntry(const char *word, size_t wordLength, const string& key, const char *meanings, size_t length, unsigned short language);
+		void addTranslation(unsigned int entry, const char *meanings, size_t length, unsigned short language);
+		void mergeTranslations(unsigned int entry, const EntryStore& other, unsigned int otherEntry);
+		unsigned int copyEntry(const EntryStore& other, unsigned int otherEntry);
+		int findTranslation(unsigned int entry, unsigned short language) const;
+		int findMeaning(unsigned int entry, unsigned int translation, const string& meaning) const;
+		void eraseTranslation(unsigned int entry, unsigned int translation);
+		void eraseMeaning(unsigned int entry, unsigned int translation, unsigned int meaning);
+		void release(unsigned int entry);
+		void unlist(unsigned int entry);
+		void forgetMembers();
+		const vector<unsigned long>& languageMembers(unsigned short language);
+		StoreStats stats() const;
+		void own();
+		void clear();
+		void swap(EntryStore& other);
+		friend class HashTable;
+};
+
+//one translation of a word seen in place; valid until the table next changes
+class TranslationView
+{
+	private:
+		const EntryStore *store;
+		const Translation *record;
+	public:
+		TranslationView(const EntryStore *store, const Translation *record) : store(store), record(record) {}
+		const string& language() const;
+		unsigned int meaningCount() const;
+		TextView meaning(unsigned int i) const;
+};
+
+//a word with its translations and meanings seen in place, without copying anything;
+//valid until the table next changes. A default-constructed view stands for no word.
+class EntryView
+{
+	private:
+		const EntryStore *store;
+		const Entry *record;
+	public:
+		EntryView() : store(nullptr), record(nullptr) {}
+		EntryView(const EntryStore *store, unsigned int entry) : store(store), record(&store->entry(entry)) {}
+		bool found() const {
+			return record != nullptr;
+		}
+		TextView word() const;
+		unsigned int translationCount() const;
+		TranslationView translation(unsigned int i) const;
+};
+
+#endif
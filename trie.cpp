@@ -0,0 +1,393 @@
+#include "trie.h"
+#include <string>
+using namespace std;
+
+//constructor, the trie starts out with just its root
+Trie::Trie() {
+	this->freeNodes = TRIE_NONE;
+	this->count = 0;
+	newNode(0, 0, -1);
+}
+
+//returns a node with the given label and no children, reusing a freed one if there is any
+unsigned int Trie::newNode(unsigned int label, unsigned int labelLength, int entry) {
+	unsigned int node = freeNodes;
+	if (node != TRIE_NONE) {
+		freeNodes = nodes[node].nextSibling;
+	}
+	else {
+		node = nodes.size();
+		nodes.resize(node + 1);
+	}
+	nodes[node].label = label;
+	nodes[node].labelLength = labelLength;
+	nodes[node].firstChild = TRIE_NONE;
+	nodes[node].nextSibling = TRIE_NONE;
+	nodes[node].entry = entry;
+	return node;
+}
+
+//hands a node no one links to any more to the free list
+void Trie::freeNode(unsigned int node) {
+	nodes[node].firstChild = TRIE_NONE;
+	nodes[node].entry = -1;
+	nodes[node].nextSibling = freeNodes;
+	freeNodes = node;
+}
+
+//returns the child whose edge starts with a byte, or TRIE_NONE
+unsigned int Trie::findChild(unsigned int node, char first) const {
+	for (unsigned int child = nodes[node].firstChild; child != TRIE_NONE; child = nodes[child].nextSibling) {
+		unsigned char byte = labels[nodes[child].label];
+		if (byte == (unsigned char)first) {
+			return child;
+		}
+		//children are ordered, so the byte cannot come later
+		if (byte > (unsigned char)first) {
+			break;
+		}
+	}
+	return TRIE_NONE;
+}
+
+//links a new child in among its siblings, keeping them ordered by first byte
+void Trie::addChild(unsigned int parent, unsigned int child) {
+	unsigned char first = labels[nodes[child].label];
+	unsigned int previous = TRIE_NONE;
+	unsigned int next = nodes[parent].firstChild;
+	while (next != TRIE_NONE && (unsigned char)labels[nodes[next].label] < first) {
+		previous = next;
+		next = nodes[next].nextSibling;
+	}
+	nodes[child].nextSibling = next;
+	if (previous == TRIE_NONE) {
+		nodes[parent].firstChild = child;
+	}
+	else {
+		nodes[previous].nextSibling = child;
+	}
+}
+
+//puts replacement where child was among its siblings, or just unlinks child if replacement is TRIE_NONE
+void Trie::replaceChild(unsigned int parent, unsigned int child, unsigned int replacement) {
+	unsigned int next = nodes[child].nextSibling;
+	if (replacement != TRIE_NONE) {
+		nodes[replacement].nextSibling = next;
+		next = replacement;
+	}
+	if (nodes[parent].firstChild == child) {
+		nodes[parent].firstChild = next;
+		return;
+	}
+	unsigned int previous = nodes[parent].firstChild;
+	while (nodes[previous].nextSibling != child) {
+		previous = nodes[previous].nextSibling;
+	}
+	nodes[previous].nextSibling = next;
+}
+
+//folds a node's only child into it, so the edge into the node carries both labels
+void Trie::mergeWithChild(unsigned int node) {
+	unsigned int child = nodes[node].firstChild;
+	TrieNode &n = nodes[node];
+	const TrieNode &c = nodes[child];
+	//labels split from one another are still adjacent in the pool, otherwise both are copied
+	if (n.label + n.labelLength != c.label) {
+		string joined(labels.data() + n.label, n.labelLength);
+		joined.append(labels.data() + c.label, c.labelLength);
+		n.label = labels.size();
+		labels.append(joined.data(), joined.size());
+	}
+	n.labelLength += c.labelLength;
+	n.firstChild = c.firstChild;
+	n.entry = c.entry;
+	freeNode(child);
+}
+
+//maps a key to an entry, replacing the entry it mapped to before
+void Trie::insert(const char *key, unsigned int length, unsigned int entry) {
+	unsigned int node = 0;
+	unsigned int pos = 0;
+	while (pos < length) {
+		unsigned int child = findChild(node, key[pos]);
+		if (child == TRIE_NONE) {
+			//the rest of the key becomes the label of a new leaf
+			unsigned int label = labels.size();
+			labels.append(key + pos, length - pos);
+			addChild(node, newNode(label, length - pos, entry));
+			count++;
+			return;
+		}
+		//how far the edge and the rest of the key agree
+		unsigned int common = 0;
+		while (common < nodes[child].labelLength && pos + common < length && labels[nodes[child].label + common] == key[pos + common]) {
+			common++;
+		}
+		if (common < nodes[child].labelLength) {
+			//split the edge: a new node takes the common run, the old one keeps the rest
+			unsigned int middle = newNode(nodes[child].label, common, -1);
+			replaceChild(node, child, middle);
+			nodes[child].label += common;
+			nodes[child].labelLength -= common;
+			nodes[child].nextSibling = TRIE_NONE;
+			nodes[middle].firstChild = child;
+			child = middle;
+		}
+		node = child;
+		pos += common;
+	}
+	if (nodes[node].entry < 0) {
+		count++;
+	}
+	nodes[node].entry = entry;
+}
+
+//unmaps a key; nodes it leaves without a purpose are freed or merged
+void Trie::remove(const char *key, unsigned int length) {
+	unsigned int parent = TRIE_NONE;
+	unsigned int node = 0;
+	unsigned int pos = 0;
+	while (pos < length) {
+		unsigned int child = findChild(node, key[pos]);
+		if (child == TRIE_NONE) {
+			return;
+		}
+		const TrieNode &c = nodes[child];
+		if (c.labelLength > length - pos || memcmp(labels.data() + c.label, key + pos, c.labelLength) != 0) {
+			return;
+		}
+		parent = node;
+		node = child;
+		pos += c.labelLength;
+	}
+	if (nodes[node].entry < 0) {
+		return;
+	}
+	nodes[node].entry = -1;
+	count--;
+	if (node == 0) {
+		return;
+	}
+	if (nodes[node].firstChild == TRIE_NONE) {
+		//a leaf goes, which may leave its parent passing through to a single child
+		replaceChild(parent, node, TRIE_NONE);
+		freeNode(node);
+		unsigned int only = nodes[parent].firstChild;
+		if (parent != 0 && nodes[parent].entry < 0 && only != TRIE_NONE && nodes[only].nextSibling == TRIE_NONE) {
+			mergeWithChild(parent);
+		}
+	}
+	else if (nodes[nodes[node].firstChild].nextSibling == TRIE_NONE) {
+		mergeWithChild(node);
+	}
+}
+
+//collects the entries of up to k keys starting with a prefix, in byte order of the keys
+void Trie::complete(const char *prefix, unsigned int length, unsigned int k, vector<unsigned int>& entries) const {
+	entries.clear();
+	unsigned int node = 0;
+	unsigned int pos = 0;
+	while (pos < length) {
+		unsigned int child = findChild(node, prefix[pos]);
+		if (child == TRIE_NONE) {
+			return;
+		}
+		//the prefix may end halfway along an edge
+		const TrieNode &c = nodes[child];
+		unsigned int compared = c.labelLength < length - pos ? c.labelLength : length - pos;
+		if (memcmp(labels.data() + c.label, prefix + pos, compared) != 0) {
+			return;
+		}
+		node = child;
+		pos += compared;
+	}
+	//walk the subtree in preorder, a key before its extensions and children in byte order;
+	//a node's siblings are visited after its subtree, except for the subtree root's own
+	static thread_local vector<unsigned int> stack;
+	stack.assign(1, node);
+	while (!stack.empty() && entries.size() < k) {
+		unsigned int n = stack.back();
+		stack.pop_back();
+		if (nodes[n].entry >= 0) {
+			entries.push_back(nodes[n].entry);
+		}
+		if (n != node && nodes[n].nextSibling != TRIE_NONE) {
+			stack.push_back(nodes[n].nextSibling);
+		}
+		if (nodes[n].firstChild != TRIE_NONE) {
+			stack.push_back(nodes[n].firstChild);
+		}
+	}
+}
+
+//collects every key within maxDistance edits (bytes inserted, deleted or replaced) of a key
+//of at most LEVENSHTEIN_MAX bytes, as (entry, distance) pairs in byte order of the keys
+void Trie::fuzzy(const char *key, unsigned int length, unsigned int maxDistance, vector<pair<unsigned int, unsigned int> >& matches) const {
+	matches.clear();
+	if (length > LEVENSHTEIN_MAX) {
+		return;
+	}
+	LevenshteinPattern pattern(key, length);
+	fuzzyWalk(pattern, 0, pattern.start(), maxDistance, matches);
+}
+
+//walks the subtree of a node with the distance column of the path to it, leaving every
+//edge as soon as no cell of the column is within reach any more
+void Trie::fuzzyWalk(const LevenshteinPattern& pattern, unsigned int node, LevenshteinColumn column, unsigned int maxDistance, vector<pair<unsigned int, unsigned int> >& matches) const {
+	if (nodes[node].entry >= 0 && column.score <= maxDistance) {
+		matches.push_back(make_pair((unsigned int)nodes[node].entry, column.score));
+	}
+	for (unsigned int child = nodes[node].firstChild; child != TRIE_NONE; child = nodes[child].nextSibling) {
+		const TrieNode &c = nodes[child];
+		LevenshteinColumn next = column;
+		bool reachable = true;
+		for (unsigned int i = 0; i < c.labelLength && reachable; i++) {
+			pattern.step(next, labels[c.label + i]);
+			reachable = pattern.within(next, maxDistance);
+		}
+		if (reachable) {
+			fuzzyWalk(pattern, child, next, maxDistance, matches);
+		}
+	}
+}
+
+//lays the nodes out again breadth first, so the children of a node sit next to each other
+//and a walk along them reads consecutive memory, and copies their labels in the same order.
+//Drops freed nodes and labels no node uses any more.
+void Trie::compact() {
+	vector<unsigned int> order(1, 0);
+	vector<unsigned int> renumbered(nodes.size(), TRIE_NONE);
+	renumbered[0] = 0;
+	for (size_t i = 0; i < order.size(); i++) {
+		for (unsigned int child = nodes[order[i]].firstChild; child != TRIE_NONE; child = nodes[child].nextSibling) {
+			renumbered[child] = order.size();
+			order.push_back(child);
+		}
+	}
+	vector<TrieNode> packed(order.size());
+	string packedLabels;
+	for (size_t i = 0; i < order.size(); i++) {
+		const TrieNode &old = nodes[order[i]];
+		packed[i] = old;
+		packed[i].label = packedLabels.size();
+		packedLabels.append(labels.data() + old.label, old.labelLength);
+		packed[i].firstChild = old.firstChild == TRIE_NONE ? TRIE_NONE : renumbered[old.firstChild];
+		packed[i].nextSibling = old.nextSibling == TRIE_NONE ? TRIE_NONE : renumbered[old.nextSibling];
+	}
+	nodes.clear();
+	nodes.append(packed.data(), packed.size());
+	labels.clear();
+	labels.append(packedLabels.data(), packedLabels.size());
+	freeNodes = TRIE_NONE;
+}
+
+//returns the number of keys stored
+unsigned int Trie::size() const {
+	return count;
+}
+
+//returns the memory the trie holds
+unsigned long Trie::bytes() const {
+	return nodes.bytes() + labels.bytes();
+}
+
+//drops every key
+void Trie::clear() {
+	nodes.clear();
+	labels.clear();
+	freeNodes = TRIE_NONE;
+	count = 0;
+	newNode(0, 0, -1);
+}
+
+//prepares the match masks of a pattern of at most LEVENSHTEIN_MAX bytes
+LevenshteinPattern::LevenshteinPattern(const char *pattern, unsigned int length) {
+	this->length = length;
+	this->mask = length >= 64 ? ~0UL : (1UL << length) - 1;
+	memset(peq, 0, sizeof(peq));
+	for (unsigned int i = 0; i < length; i++) {
+		peq[(unsigned char)pattern[i]] |= 1UL << i;
+	}
+}
+
+//returns the column before any text is read: row i is i edits away (deleting i pattern bytes)
+LevenshteinColumn LevenshteinPattern::start() const {
+	LevenshteinColumn column;
+	column.vp = mask;
+	column.vn = 0;
+	column.depth = 0;
+	column.score = length;
+	column.diagonal = 0;
+	return column;
+}
+
+//advances a column by one text byte
+void LevenshteinPattern::step(LevenshteinColumn& column, unsigned char byte) const {
+	unsigned long eq = peq[byte];
+	unsigned long xv = eq | column.vn;
+	unsigned long xh = (((eq & column.vp) + column.vp) ^ column.vp) | eq;
+	unsigned long ph = column.vn | ~(xh | column.vp);
+	unsigned long mh = column.vp & xh;
+	//the bottom row is the distance to the whole pattern (the top row for an empty one)
+	if (length == 0 || (ph >> (length - 1) & 1)) {
+		column.score++;
+	}
+	else if (mh >> (length - 1) & 1) {
+		column.score--;
+	}
+	//the top row grows by one per text byte, every one of them inserted
+	ph = (ph << 1) | 1;
+	mh <<= 1;
+	column.vp = (mh | ~(xv | ph)) & mask;
+	column.vn = ph & xv & mask;
+	//the diagonal cell moves one step right along its row, then one row down
+	unsigned int row = column.depth;
+	if (row < length) {
+		column.diagonal += (int)(ph >> row & 1) - (int)(mh >> row & 1);
+		column.diagonal += (int)(column.vp >> row & 1) - (int)(column.vn >> row & 1);
+	}
+	else {
+		column.diagonal = column.score;
+	}
+	column.depth++;
+}
+
+//true if some cell of the column is within maxDistance, so reading more text may still end
+//within it. Only the diagonal band can be: row i is at least |i - depth| edits away. The
+//cells are followed up and down from the diagonal one step at a time.
+bool LevenshteinPattern::within(const LevenshteinColumn& column, unsigned int maxDistance) const {
+	unsigned int first = column.depth > maxDistance ? column.depth - maxDistance : 0;
+	unsigned int last = column.depth + maxDistance < length ? column.depth + maxDistance : length;
+	if (first > last) {
+		return false;
+	}
+	unsigned int diagonalRow = column.depth < length ? column.depth : length;
+	int limit = maxDistance;
+	if (column.diagonal <= limit) {
+		return true;
+	}
+	int cell = column.diagonal;
+	for (unsigned int row = diagonalRow; row > first; row--) {
+		cell -= (int)(column.vp >> (row - 1) & 1) - (int)(column.vn >> (row - 1) & 1);
+		if (cell <= limit) {
+			return true;
+		}
+	}
+	cell = column.diagonal;
+	for (unsigned int row = diagonalRow; row < last; row++) {
+		cell += (int)(column.vp >> row & 1) - (int)(column.vn >> row & 1);
+		if (cell <= limit) {
+			return true;
+		}
+	}
+	return false;
+}
+
+//returns the edit distance between the pattern and a text
+unsigned int LevenshteinPattern::distance(const char *text, unsigned int length) const {
+	LevenshteinColumn column = start();
+	for (unsigned int i = 0; i < length; i++) {
+		step(column, text[i]);
+	}
+	return column.score;
+}
@@ -0,0 +1,82 @@
+#ifndef _TRIE
+#define _TRIE
+#include <vector>
+#include "store.h"
+using namespace std;
+
+//marks a missing child or sibling
+const unsigned int TRIE_NONE = 0xFFFFFFFF;
+
+//one node of the trie; the edge into it carries a whole run of bytes
+struct TrieNode
+{
+	unsigned int label;			// offset of the edge label in the label pool
+	unsigned int labelLength;	// bytes on the edge into this node
+	unsigned int firstChild;	// children are chained through nextSibling, ordered by their first byte
+	unsigned int nextSibling;	// next child of the same parent (or next free node)
+	int entry;					// entry whose key ends here, or -1
+};
+
+//longest pattern the bit-parallel edit distance handles, one bit per byte
+const unsigned int LEVENSHTEIN_MAX = 64;
+
+//one column of the edit distance matrix between a pattern and a text read so far, kept as
+//bit vectors of the +1 and -1 steps down the column
+struct LevenshteinColumn
+{
+	unsigned long vp;		// rows where the distance grows by one from the row above
+	unsigned long vn;		// rows where it shrinks by one
+	unsigned int depth;		// text bytes read
+	unsigned int score;		// distance between the whole pattern and the text read
+	int diagonal;			// distance at row depth (the last row once past the pattern)
+};
+
+//bit-parallel Levenshtein distance to one pattern (Myers' algorithm as adapted by Hyyrö):
+//reading a text byte updates a whole column in a handful of word operations
+class LevenshteinPattern
+{
+	private:
+		unsigned long peq[256];		// rows whose pattern byte equals each byte value
+		unsigned int length;
+		unsigned long mask;			// one bit per pattern byte
+	public:
+		LevenshteinPattern(const char *pattern, unsigned int length);
+		LevenshteinColumn start() const;
+		void step(LevenshteinColumn& column, unsigned char byte) const;
+		bool within(const LevenshteinColumn& column, unsigned int maxDistance) const;
+		unsigned int distance(const char *text, unsigned int length) const;
+};
+
+//compressed (radix) trie over the normalized keys, mapping each to its entry. Nodes and
+//edge labels live in flat arrays; splitting an edge only narrows labels, so it copies no
+//bytes, and a node left with a single child is merged back into it on removal. Labels a
+//merge has to copy leave their old bytes behind until the trie is rebuilt.
+class Trie
+{
+	private:
+		PodArray<TrieNode> nodes;			// node 0 is the root and has an empty label
+		PodArray<char> labels;				// edge labels, back to back
+		unsigned int freeNodes;				// first unused node
+		unsigned int count;					// keys stored
+		unsigned int newNode(unsigned int label, unsigned int labelLength, int entry);
+		void freeNode(unsigned int node);
+		unsigned int findChild(unsigned int node, char first) const;
+		void addChild(unsigned int parent, unsigned int child);
+		void replaceChild(unsigned int parent, unsigned int child, unsigned int replacement);
+		void mergeWithChild(unsigned int node);
+		void fuzzyWalk(const LevenshteinPattern& pattern, unsigned int node, LevenshteinColumn column, unsigned int maxDistance, vector<pair<unsigned int, unsigned int> >& matches) const;
+		Trie(const Trie&);
+		Trie& operator=(const Trie&);
+	public:
+		Trie();
+		void insert(const char *key, unsigned int length, unsigned int entry);
+		void remove(const char *key, unsigned int length);
+		void complete(const char *prefix, unsigned int length, unsigned int k, vector<unsigned int>& entries) const;
+		void fuzzy(const char *key, unsigned int length, unsigned int maxDistance, vector<pair<unsigned int, unsigned int> >& matches) const;
+		void compact();
+		unsigned int size() const;
+		unsigned long bytes() const;
+		void clear();
+};
+
+#endif
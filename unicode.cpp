@@ -0,0 +1,270 @@
+#include "unicode.h"
+#include "unicode_tables.h"
+#include <string>
+#include <vector>
+using namespace std;
+
+//Hangul syllables are composed and decomposed arithmetically
+const unsigned int S_BASE = 0xAC00, L_BASE = 0x1100, V_BASE = 0x1161, T_BASE = 0x11A7;
+const unsigned int L_COUNT = 19, V_COUNT = 21, T_COUNT = 28;
+const unsigned int N_COUNT = V_COUNT * T_COUNT, S_COUNT = L_COUNT * N_COUNT;
+
+//binary search over the first column of a generated table; returns the row or -1
+template<unsigned int WIDTH>
+static int findRow(const unsigned int (*table)[WIDTH], int rows, unsigned int cp) {
+	int lo = 0, hi = rows - 1;
+	while (lo <= hi) {
+		int mid = (lo + hi) / 2;
+		if (table[mid][0] == cp) return mid;
+		if (table[mid][0] < cp) lo = mid + 1;
+		else hi = mid - 1;
+	}
+	return -1;
+}
+
+//number of rows of a generated table
+#define ROWS(table) ((int)(sizeof(table) / sizeof(table[0])))
+
+//canonical combining class of a code point
+static unsigned int combiningClass(unsigned int cp) {
+	//nothing below the combining diacritical marks block has a class
+	if (cp < 0x300) return 0;
+	int lo = 0, hi = ROWS(CCC_RANGES) - 1;
+	while (lo <= hi) {
+		int mid = (lo + hi) / 2;
+		if (cp < CCC_RANGES[mid][0]) hi = mid - 1;
+		else if (cp > CCC_RANGES[mid][1]) lo = mid + 1;
+		else return CCC_RANGES[mid][2];
+	}
+	return 0;
+}
+
+//appends the full canonical decomposition of cp
+static void decompose(unsigned int cp, vector<unsigned int>& out) {
+	//Latin-1 letters start at U+00C0, nothing below decomposes
+	if (cp < 0xC0) {
+		out.push_back(cp);
+		return;
+	}
+	if (cp >= S_BASE && cp < S_BASE + S_COUNT) {
+		unsigned int s = cp - S_BASE;
+		out.push_back(L_BASE + s / N_COUNT);
+		out.push_back(V_BASE + (s % N_COUNT) / T_COUNT);
+		if (s % T_COUNT != 0) out.push_back(T_BASE + s % T_COUNT);
+		return;
+	}
+	int row = findRow(DECOMP_INDEX, ROWS(DECOMP_INDEX), cp);
+	if (row < 0) {
+		out.push_back(cp);
+		return;
+	}
+	for (unsigned int i = 0; i < DECOMP_INDEX[row][2]; i++) {
+		out.push_back(DECOMP_DATA[DECOMP_INDEX[row][1] + i]);
+	}
+}
+
+//appends the full case folding of cp, decomposed again since a folding may be precomposed
+static void fold(unsigned int cp, vector<unsigned int>& out) {
+	int row = findRow(FOLD_SINGLE, ROWS(FOLD_SINGLE), cp);
+	if (row >= 0) {
+		decompose(FOLD_SINGLE[row][1], out);
+		return;
+	}
+	row = findRow(FOLD_MULTI, ROWS(FOLD_MULTI), cp);
+	if (row >= 0) {
+		for (int i = 1; i < 4 && FOLD_MULTI[row][i] != 0; i++) {
+			decompose(FOLD_MULTI[row][i], out);
+		}
+		return;
+	}
+	out.push_back(cp);
+}
+
+//primary composite of two code points, or 0 if they do not compose
+static unsigned int compose(unsigned int first, unsigned int second) {
+	//leading and vowel jamo make an LV syllable
+	if (first >= L_BASE && first < L_BASE + L_COUNT && second >= V_BASE && second < V_BASE + V_COUNT) {
+		return S_BASE + ((first - L_BASE) * V_COUNT + (second - V_BASE)) * T_COUNT;
+	}
+	//an LV syllable and a trailing jamo make an LVT syllable
+	if (first >= S_BASE && first < S_BASE + S_COUNT && (first - S_BASE) % T_COUNT == 0 &&
+		second > T_BASE && second < T_BASE + T_COUNT) {
+		return first + (second - T_BASE);
+	}
+	int lo = 0, hi = ROWS(COMPOSE_PAIRS) - 1;
+	while (lo <= hi) {
+		int mid = (lo + hi) / 2;
+		const unsigned int* row = COMPOSE_PAIRS[mid];
+		if (row[0] == first && row[1] == second) return row[2];
+		if (row[0] < first || (row[0] == first && row[1] < second)) lo = mid + 1;
+		else hi = mid - 1;
+	}
+	return 0;
+}
+
+//canonical ordering: stable sort of each run of combining marks by class
+static void canonicalOrder(vector<unsigned int>& cps) {
+	for (size_t j = 1; j < cps.size(); j++) {
+		unsigned int ccc = combiningClass(cps[j]);
+		if (ccc == 0) continue;
+		for (size_t k = j; k > 0; k--) {
+			unsigned int before = combiningClass(cps[k - 1]);
+			if (before == 0 || before <= ccc) break;
+			swap(cps[k - 1], cps[k]);
+		}
+	}
+}
+
+//decodes one UTF-8 sequence at str[i] and advances i; invalid bytes are taken as Latin-1
+static unsigned int decodeUtf8(const char *str, size_t size, size_t& i) {
+	unsigned char c = str[i];
+	unsigned int length = c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : c >= 0xC2 ? 2 : 0;
+	if (length == 0 || i + length > size) {
+		i++;
+		return c;
+	}
+	unsigned int cp = c & (0x7F >> length);
+	for (unsigned int k = 1; k < length; k++) {
+		unsigned char next = str[i + k];
+		if ((next & 0xC0) != 0x80) {
+			i++;
+			return c;
+		}
+		cp = (cp << 6) | (next & 0x3F);
+	}
+	//reject overlong forms, surrogates and values past U+10FFFF
+	if ((length == 3 && cp < 0x800) || (length == 4 && (cp < 0x10000 || cp > 0x10FFFF)) || (cp >= 0xD800 && cp <= 0xDFFF)) {
+		i++;
+		return c;
+	}
+	i += length;
+	return cp;
+}
+
+//appends cp encoded as UTF-8
+static void encodeUtf8(unsigned int cp, string& out) {
+	if (cp < 0x80) {
+		out += (char)cp;
+	}
+	else if (cp < 0x800) {
+		out += (char)(0xC0 | (cp >> 6));
+		out += (char)(0x80 | (cp & 0x3F));
+	}
+	else if (cp < 0x10000) {
+		out += (char)(0xE0 | (cp >> 12));
+		out += (char)(0x80 | ((cp >> 6) & 0x3F));
+		out += (char)(0x80 | (cp & 0x3F));
+	}
+	else {
+		out += (char)(0xF0 | (cp >> 18));
+		out += (char)(0x80 | ((cp >> 12) & 0x3F));
+		out += (char)(0x80 | ((cp >> 6) & 0x3F));
+		out += (char)(0x80 | (cp & 0x3F));
+	}
+}
+
+//caseless key of a UTF-8 string
+void foldCase(const string& str, string& out) {
+	foldCase(str.data(), str.size(), out);
+}
+
+//caseless key of UTF-8 text given as characters and a length
+void foldCase(const char *str, size_t size, string& out) {
+	out.clear();
+	//ASCII fast path: lowercasing is the whole folding and the text is already NFC
+	size_t i = 0;
+	while (i < size && (unsigned char)str[i] < 0x80) {
+		char c = str[i++];
+		out += (c >= 'A' && c <= 'Z') ? (char)(c + ('a' - 'A')) : c;
+	}
+	if (i == size) {
+		return;
+	}
+
+	//the ASCII prefix is final except for its last character, which may compose with what follows
+	size_t prefix = out.size();
+	if (prefix > 0) {
+		prefix--;
+		i--;
+	}
+	out.resize(prefix);
+
+	//buffers reused across calls so steady-state folding does not allocate
+	static thread_local vector<unsigned int> decomposed, folded;
+	decomposed.clear();
+	folded.clear();
+
+	//NFD, fold, then NFD again since folding can turn a mark into a starter or yield precomposed text
+	while (i < size) {
+		decompose(decodeUtf8(str, size, i), decomposed);
+	}
+	canonicalOrder(decomposed);
+	for (unsigned int cp : decomposed) {
+		fold(cp, folded);
+	}
+	canonicalOrder(folded);
+
+	//canonical composition, done in place over the folded sequence
+	size_t length = 0;
+	int starter = -1;
+	int lastClass = -1;
+	for (size_t j = 0; j < folded.size(); j++) {
+		unsigned int cp = folded[j];
+		int ccc = combiningClass(cp);
+		//a mark composes with the last starter unless something in between blocks it
+		bool blocked = lastClass != -1 && lastClass >= ccc;
+		if (starter >= 0 && !blocked) {
+			unsigned int composite = compose(folded[starter], cp);
+			if (composite != 0) {
+				folded[starter] = composite;
+				continue;
+			}
+		}
+		if (ccc == 0) {
+			starter = length;
+			lastClass = -1;
+		}
+		else {
+			lastClass = ccc;
+		}
+		folded[length++] = cp;
+	}
+
+	for (size_t j = 0; j < length; j++) {
+		encodeUtf8(folded[j], out);
+	}
+}
+
+//caseless key of a UTF-8 string as a new string
+string foldCase(const string& str) {
+	string out;
+	foldCase(str, out);
+	return out;
+}
+
+//compares two strings by their caseless keys
+bool equalsFolded(const string& a, const string& b) {
+	return equalsFolded(a.data(), a.size(), b.data(), b.size());
+}
+
+//compares two runs of characters by their caseless keys
+bool equalsFolded(const char *a, size_t aSize, const char *b, size_t bSize) {
+	//both ASCII: compare byte by byte without building keys
+	bool ascii = true;
+	for (size_t i = 0; i < aSize && ascii; i++) ascii = (unsigned char)a[i] < 0x80;
+	for (size_t i = 0; i < bSize && ascii; i++) ascii = (unsigned char)b[i] < 0x80;
+	if (ascii) {
+		if (aSize != bSize) return false;
+		for (size_t i = 0; i < aSize; i++) {
+			char x = a[i], y = b[i];
+			if (x >= 'A' && x <= 'Z') x += 'a' - 'A';
+			if (y >= 'A' && y <= 'Z') y += 'a' - 'A';
+			if (x != y) return false;
+		}
+		return true;
+	}
+	static thread_local string foldedA, foldedB;
+	foldCase(a, aSize, foldedA);
+	foldCase(b, bSize, foldedB);
+	return foldedA == foldedB;
+}
@@ -0,0 +1,24 @@
+#ifndef _UNICODE
+#define _UNICODE
+#include <string>
+using namespace std;
+
+//writes the caseless key of a UTF-8 string into out: canonical decomposition,
+//full case folding, then NFC composition, so "Straße", "STRASSE" and a decomposed
+//"strasse" all give the same bytes. Pure ASCII input takes a lowercase-only fast path.
+//Bytes that are not valid UTF-8 are read as Latin-1.
+void foldCase(const string& str, string& out);
+
+//same as above, for size characters at str
+void foldCase(const char *str, size_t size, string& out);
+
+//same as above, returning a new string
+string foldCase(const string& str);
+
+//true if both strings have the same caseless key; allocation-free once warmed up
+bool equalsFolded(const string& a, const string& b);
+
+//same as above, for runs of characters that need not be strings (e.g. in a string pool)
+bool equalsFolded(const char *a, size_t aSize, const char *b, size_t bSize);
+
+#endif
@@ -0,0 +1,1109 @@
+// Generated by gen_unicode_tables.py from Unicode 14.0.0 -- do not edit.
+// Every table is sorted by its first column for binary search.
+#ifndef _UNICODE_TABLES
+#define _UNICODE_TABLES
+
+// code point, offset into DECOMP_DATA, length of its full canonical decomposition
+static const unsigned int DECOMP_INDEX[][3] = {
+	{0xC0,0x0,0x2}, {0xC1,0x2,0x2}, {0xC2,0x4,0x2}, {0xC3,0x6,0x2}, {0xC4,0x8,0x2}, {0xC5,0xA,0x2},
+	{0xC7,0xC,0x2}, {0xC8,0xE,0x2}, {0xC9,0x10,0x2}, {0xCA,0x12,0x2}, {0xCB,0x14,0x2}, {0xCC,0x16,0x2},
+	{0xCD,0x18,0x2}, {0xCE,0x1A,0x2}, {0xCF,0x1C,0x2}, {0xD1,0x1E,0x2}, {0xD2,0x20,0x2}, {0xD3,0x22,0x2},
+	{0xD4,0x24,0x2}, {0xD5,0x26,0x2}, {0xD6,0x28,0x2}, {0xD9,0x2A,0x2}, {0xDA,0x2C,0x2}, {0xDB,0x2E,0x2},
+	{0xDC,0x30,0x2}, {0xDD,0x32,0x2}, {0xE0,0x34,0x2}, {0xE1,0x36,0x2}, {0xE2,0x38,0x2}, {0xE3,0x3A,0x2},
+	{0xE4,0x3C,0x2}, {0xE5,0x3E,0x2}, {0xE7,0x40,0x2}, {0xE8,0x42,0x2}, {0xE9,0x44,0x2}, {0xEA,0x46,0x2},
+	{0xEB,0x48,0x2}, {0xEC,0x4A,0x2}, {0xED,0x4C,0x2}, {0xEE,0x4E,0x2}, {0xEF,0x50,0x2}, {0xF1,0x52,0x2},
+	{0xF2,0x54,0x2}, {0xF3,0x56,0x2}, {0xF4,0x58,0x2}, {0xF5,0x5A,0x2}, {0xF6,0x5C,0x2}, {0xF9,0x5E,0x2},
+	{0xFA,0x60,0x2}, {0xFB,0x62,0x2}, {0xFC,0x64,0x2}, {0xFD,0x66,0x2}, {0xFF,0x68,0x2}, {0x100,0x6A,0x2},
+	{0x101,0x6C,0x2}, {0x102,0x6E,0x2}, {0x103,0x70,0x2}, {0x104,0x72,0x2}, {0x105,0x74,0x2}, {0x106,0x76,0x2},
+	{0x107,0x78,0x2}, {0x108,0x7A,0x2}, {0x109,0x7C,0x2}, {0x10A,0x7E,0x2}, {0x10B,0x80,0x2}, {0x10C,0x82,0x2},
+	{0x10D,0x84,0x2}, {0x10E,0x86,0x2}, {0x10F,0x88,0x2}, {0x112,0x8A,0x2}, {0x113,0x8C,0x2}, {0x114,0x8E,0x2},
+	{0x115,0x90,0x2}, {0x116,0x92,0x2}, {0x117,0x94,0x2}, {0x118,0x96,0x2}, {0x119,0x98,0x2}, {0x11A,0x9A,0x2},
+	{0x11B,0x9C,0x2}, {0x11C,0x9E,0x2}, {0x11D,0xA0,0x2}, {0x11E,0xA2,0x2}, {0x11F,0xA4,0x2}, {0x120,0xA6,0x2},
+	{0x121,0xA8,0x2}, {0x122,0xAA,0x2}, {0x123,0xAC,0x2}, {0x124,0xAE,0x2}, {0x125,0xB0,0x2}, {0x128,0xB2,0x2},
+	{0x129,0xB4,0x2}, {0x12A,0xB6,0x2}, {0x12B,0xB8,0x2}, {0x12C,0xBA,0x2}, {0x12D,0xBC,0x2}, {0x12E,0xBE,0x2},
+	{0x12F,0xC0,0x2}, {0x130,0xC2,0x2}, {0x134,0xC4,0x2}, {0x135,0xC6,0x2}, {0x136,0xC8,0x2}, {0x137,0xCA,0x2},
+	{0x139,0xCC,0x2}, {0x13A,0xCE,0x2}, {0x13B,0xD0,0x2}, {0x13C,0xD2,0x2}, {0x13D,0xD4,0x2}, {0x13E,0xD6,0x2},
+	{0x143,0xD8,0x2}, {0x144,0xDA,0x2}, {0x145,0xDC,0x2}, {0x146,0xDE,0x2}, {0x147,0xE0,0x2}, {0x148,0xE2,0x2},
+	{0x14C,0xE4,0x2}, {0x14D,0xE6,0x2}, {0x14E,0xE8,0x2}, {0x14F,0xEA,0x2}, {0x150,0xEC,0x2}, {0x151,0xEE,0x2},
+	{0x154,0xF0,0x2}, {0x155,0xF2,0x2}, {0x156,0xF4,0x2}, {0x157,0xF6,0x2}, {0x158,0xF8,0x2}, {0x159,0xFA,0x2},
+	{0x15A,0xFC,0x2}, {0x15B,0xFE,0x2}, {0x15C,0x100,0x2}, {0x15D,0x102,0x2}, {0x15E,0x104,0x2}, {0x15F,0x106,0x2},
+	{0x160,0x108,0x2}, {0x161,0x10A,0x2}, {0x162,0x10C,0x2}, {0x163,0x10E,0x2}, {0x164,0x110,0x2}, {0x165,0x112,0x2},
+	{0x168,0x114,0x2}, {0x169,0x116,0x2}, {0x16A,0x118,0x2}, {0x16B,0x11A,0x2}, {0x16C,0x11C,0x2}, {0x16D,0x11E,0x2},
+	{0x16E,0x120,0x2}, {0x16F,0x122,0x2}, {0x170,0x124,0x2}, {0x171,0x126,0x2}, {0x172,0x128,0x2}, {0x173,0x12A,0x2},
+	{0x174,0x12C,0x2}, {0x175,0x12E,0x2}, {0x176,0x130,0x2}, {0x177,0x132,0x2}, {0x178,0x134,0x2}, {0x179,0x136,0x2},
+	{0x17A,0x138,0x2}, {0x17B,0x13A,0x2}, {0x17C,0x13C,0x2}, {0x17D,0x13E,0x2}, {0x17E,0x140,0x2}, {0x1A0,0x142,0x2},
+	{0x1A1,0x144,0x2}, {0x1AF,0x146,0x2}, {0x1B0,0x148,0x2}, {0x1CD,0x14A,0x2}, {0x1CE,0x14C,0x2}, {0x1CF,0x14E,0x2},
+	{0x1D0,0x150,0x2}, {0x1D1,0x152,0x2}, {0x1D2,0x154,0x2}, {0x1D3,0x156,0x2}, {0x1D4,0x158,0x2}, {0x1D5,0x15A,0x3},
+	{0x1D6,0x15D,0x3}, {0x1D7,0x160,0x3}, {0x1D8,0x163,0x3}, {0x1D9,0x166,0x3}, {0x1DA,0x169,0x3}, {0x1DB,0x16C,0x3},
+	{0x1DC,0x16F,0x3}, {0x1DE,0x172,0x3}, {0x1DF,0x175,0x3}, {0x1E0,0x178,0x3}, {0x1E1,0x17B,0x3}, {0x1E2,0x17E,0x2},
+	{0x1E3,0x180,0x2}, {0x1E6,0x182,0x2}, {0x1E7,0x184,0x2}, {0x1E8,0x186,0x2}, {0x1E9,0x188,0x2}, {0x1EA,0x18A,0x2},
+	{0x1EB,0x18C,0x2}, {0x1EC,0x18E,0x3}, {0x1ED,0x191,0x3}, {0x1EE,0x194,0x2}, {0x1EF,0x196,0x2}, {0x1F0,0x198,0x2},
+	{0x1F4,0x19A,0x2}, {0x1F5,0x19C,0x2}, {0x1F8,0x19E,0x2}, {0x1F9,0x1A0,0x2}, {0x1FA,0x1A2,0x3}, {0x1FB,0x1A5,0x3},
+	{0x1FC,0x1A8,0x2}, {0x1FD,0x1AA,0x2}, {0x1FE,0x1AC,0x2}, {0x1FF,0x1AE,0x2}, {0x200,0x1B0,0x2}, {0x201,0x1B2,0x2},
+	{0x202,0x1B4,0x2}, {0x203,0x1B6,0x2}, {0x204,0x1B8,0x2}, {0x205,0x1BA,0x2}, {0x206,0x1BC,0x2}, {0x207,0x1BE,0x2},
+	{0x208,0x1C0,0x2}, {0x209,0x1C2,0x2}, {0x20A,0x1C4,0x2}, {0x20B,0x1C6,0x2}, {0x20C,0x1C8,0x2}, {0x20D,0x1CA,0x2},
+	{0x20E,0x1CC,0x2}, {0x20F,0x1CE,0x2}, {0x210,0x1D0,0x2}, {0x211,0x1D2,0x2}, {0x212,0x1D4,0x2}, {0x213,0x1D6,0x2},
+	{0x214,0x1D8,0x2}, {0x215,0x1DA,0x2}, {0x216,0x1DC,0x2}, {0x217,0x1DE,0x2}, {0x218,0x1E0,0x2}, {0x219,0x1E2,0x2},
+	{0x21A,0x1E4,0x2}, {0x21B,0x1E6,0x2}, {0x21E,0x1E8,0x2}, {0x21F,0x1EA,0x2}, {0x226,0x1EC,0x2}, {0x227,0x1EE,0x2},
+	{0x228,0x1F0,0x2}, {0x229,0x1F2,0x2}, {0x22A,0x1F4,0x3}, {0x22B,0x1F7,0x3}, {0x22C,0x1FA,0x3}, {0x22D,0x1FD,0x3},
+	{0x22E,0x200,0x2}, {0x22F,0x202,0x2}, {0x230,0x204,0x3}, {0x231,0x207,0x3}, {0x232,0x20A,0x2}, {0x233,0x20C,0x2},
+	{0x340,0x20E,0x1}, {0x341,0x20F,0x1}, {0x343,0x210,0x1}, {0x344,0x211,0x2}, {0x374,0x213,0x1}, {0x37E,0x214,0x1},
+	{0x385,0x215,0x2}, {0x386,0x217,0x2}, {0x387,0x219,0x1}, {0x388,0x21A,0x2}, {0x389,0x21C,0x2}, {0x38A,0x21E,0x2},
+	{0x38C,0x220,0x2}, {0x38E,0x222,0x2}, {0x38F,0x224,0x2}, {0x390,0x226,0x3}, {0x3AA,0x229,0x2}, {0x3AB,0x22B,0x2},
+	{0x3AC,0x22D,0x2}, {0x3AD,0x22F,0x2}, {0x3AE,0x231,0x2}, {0x3AF,0x233,0x2}, {0x3B0,0x235,0x3}, {0x3CA,0x238,0x2},
+	{0x3CB,0x23A,0x2}, {0x3CC,0x23C,0x2}, {0x3CD,0x23E,0x2}, {0x3CE,0x240,0x2}, {0x3D3,0x242,0x2}, {0x3D4,0x244,0x2},
+	{0x400,0x246,0x2}, {0x401,0x248,0x2}, {0x403,0x24A,0x2}, {0x407,0x24C,0x2}, {0x40C,0x24E,0x2}, {0x40D,0x250,0x2},
+	{0x40E,0x252,0x2}, {0x419,0x254,0x2}, {0x439,0x256,0x2}, {0x450,0x258,0x2}, {0x451,0x25A,0x2}, {0x453,0x25C,0x2},
+	{0x457,0x25E,0x2}, {0x45C,0x260,0x2}, {0x45D,0x262,0x2}, {0x45E,0x264,0x2}, {0x476,0x266,0x2}, {0x477,0x268,0x2},
+	{0x4C1,0x26A,0x2}, {0x4C2,0x26C,0x2}, {0x4D0,0x26E,0x2}, {0x4D1,0x270,0x2}, {0x4D2,0x272,0x2}, {0x4D3,0x274,0x2},
+	{0x4D6,0x276,0x2}, {0x4D7,0x278,0x2}, {0x4DA,0x27A,0x2}, {0x4DB,0x27C,0x2}, {0x4DC,0x27E,0x2}, {0x4DD,0x280,0x2},
+	{0x4DE,0x282,0x2}, {0x4DF,0x284,0x2}, {0x4E2,0x286,0x2}, {0x4E3,0x288,0x2}, {0x4E4,0x28A,0x2}, {0x4E5,0x28C,0x2},
+	{0x4E6,0x28E,0x2}, {0x4E7,0x290,0x2}, {0x4EA,0x292,0x2}, {0x4EB,0x294,0x2}, {0x4EC,0x296,0x2}, {0x4ED,0x298,0x2},
+	{0x4EE,0x29A,0x2}, {0x4EF,0x29C,0x2}, {0x4F0,0x29E,0x2}, {0x4F1,0x2A0,0x2}, {0x4F2,0x2A2,0x2}, {0x4F3,0x2A4,0x2},
+	{0x4F4,0x2A6,0x2}, {0x4F5,0x2A8,0x2}, {0x4F8,0x2AA,0x2}, {0x4F9,0x2AC,0x2}, {0x622,0x2AE,0x2}, {0x623,0x2B0,0x2},
+	{0x624,0x2B2,0x2}, {0x625,0x2B4,0x2}, {0x626,0x2B6,0x2}, {0x6C0,0x2B8,0x2}, {0x6C2,0x2BA,0x2}, {0x6D3,0x2BC,0x2},
+	{0x929,0x2BE,0x2}, {0x931,0x2C0,0x2}, {0x934,0x2C2,0x2}, {0x958,0x2C4,0x2}, {0x959,0x2C6,0x2}, {0x95A,0x2C8,0x2},
+	{0x95B,0x2CA,0x2}, {0x95C,0x2CC,0x2}, {0x95D,0x2CE,0x2}, {0x95E,0x2D0,0x2}, {0x95F,0x2D2,0x2}, {0x9CB,0x2D4,0x2},
+	{0x9CC,0x2D6,0x2}, {0x9DC,0x2D8,0x2}, {0x9DD,0x2DA,0x2}, {0x9DF,0x2DC,0x2}, {0xA33,0x2DE,0x2}, {0xA36,0x2E0,0x2},
+	{0xA59,0x2E2,0x2}, {0xA5A,0x2E4,0x2}, {0xA5B,0x2E6,0x2}, {0xA5E,0x2E8,0x2}, {0xB48,0x2EA,0x2}, {0xB4B,0x2EC,0x2},
+	{0xB4C,0x2EE,0x2}, {0xB5C,0x2F0,0x2}, {0xB5D,0x2F2,0x2}, {0xB94,0x2F4,0x2}, {0xBCA,0x2F6,0x2}, {0xBCB,0x2F8,0x2},
+	{0xBCC,0x2FA,0x2}, {0xC48,0x2FC,0x2}, {0xCC0,0x2FE,0x2}, {0xCC7,0x300,0x2}, {0xCC8,0x302,0x2}, {0xCCA,0x304,0x2},
+	{0xCCB,0x306,0x3}, {0xD4A,0x309,0x2}, {0xD4B,0x30B,0x2}, {0xD4C,0x30D,0x2}, {0xDDA,0x30F,0x2}, {0xDDC,0x311,0x2},
+	{0xDDD,0x313,0x3}, {0xDDE,0x316,0x2}, {0xF43,0x318,0x2}, {0xF4D,0x31A,0x2}, {0xF52,0x31C,0x2}, {0xF57,0x31E,0x2},
+	{0xF5C,0x320,0x2}, {0xF69,0x322,0x2}, {0xF73,0x324,0x2}, {0xF75,0x326,0x2}, {0xF76,0x328,0x2}, {0xF78,0x32A,0x2},
+	{0xF81,0x32C,0x2}, {0xF93,0x32E,0x2}, {0xF9D,0x330,0x2}, {0xFA2,0x332,0x2}, {0xFA7,0x334,0x2}, {0xFAC,0x336,0x2},
+	{0xFB9,0x338,0x2}, {0x1026,0x33A,0x2}, {0x1B06,0x33C,0x2}, {0x1B08,0x33E,0x2}, {0x1B0A,0x340,0x2}, {0x1B0C,0x342,0x2},
+	{0x1B0E,0x344,0x2}, {0x1B12,0x346,0x2}, {0x1B3B,0x348,0x2}, {0x1B3D,0x34A,0x2}, {0x1B40,0x34C,0x2}, {0x1B41,0x34E,0x2},
+	{0x1B43,0x350,0x2}, {0x1E00,0x352,0x2}, {0x1E01,0x354,0x2}, {0x1E02,0x356,0x2}, {0x1E03,0x358,0x2}, {0x1E04,0x35A,0x2},
+	{0x1E05,0x35C,0x2}, {0x1E06,0x35E,0x2}, {0x1E07,0x360,0x2}, {0x1E08,0x362,0x3}, {0x1E09,0x365,0x3}, {0x1E0A,0x368,0x2},
+	{0x1E0B,0x36A,0x2}, {0x1E0C,0x36C,0x2}, {0x1E0D,0x36E,0x2}, {0x1E0E,0x370,0x2}, {0x1E0F,0x372,0x2}, {0x1E10,0x374,0x2},
+	{0x1E11,0x376,0x2}, {0x1E12,0x378,0x2}, {0x1E13,0x37A,0x2}, {0x1E14,0x37C,0x3}, {0x1E15,0x37F,0x3}, {0x1E16,0x382,0x3},
+	{0x1E17,0x385,0x3}, {0x1E18,0x388,0x2}, {0x1E19,0x38A,0x2}, {0x1E1A,0x38C,0x2}, {0x1E1B,0x38E,0x2}, {0x1E1C,0x390,0x3},
+	{0x1E1D,0x393,0x3}, {0x1E1E,0x396,0x2}, {0x1E1F,0x398,0x2}, {0x1E20,0x39A,0x2}, {0x1E21,0x39C,0x2}, {0x1E22,0x39E,0x2},
+	{0x1E23,0x3A0,0x2}, {0x1E24,0x3A2,0x2}, {0x1E25,0x3A4,0x2}, {0x1E26,0x3A6,0x2}, {0x1E27,0x3A8,0x2}, {0x1E28,0x3AA,0x2},
+	{0x1E29,0x3AC,0x2}, {0x1E2A,0x3AE,0x2}, {0x1E2B,0x3B0,0x2}, {0x1E2C,0x3B2,0x2}, {0x1E2D,0x3B4,0x2}, {0x1E2E,0x3B6,0x3},
+	{0x1E2F,0x3B9,0x3}, {0x1E30,0x3BC,0x2}, {0x1E31,0x3BE,0x2}, {0x1E32,0x3C0,0x2}, {0x1E33,0x3C2,0x2}, {0x1E34,0x3C4,0x2},
+	{0x1E35,0x3C6,0x2}, {0x1E36,0x3C8,0x2}, {0x1E37,0x3CA,0x2}, {0x1E38,0x3CC,0x3}, {0x1E39,0x3CF,0x3}, {0x1E3A,0x3D2,0x2},
+	{0x1E3B,0x3D4,0x2}, {0x1E3C,0x3D6,0x2}, {0x1E3D,0x3D8,0x2}, {0x1E3E,0x3DA,0x2}, {0x1E3F,0x3DC,0x2}, {0x1E40,0x3DE,0x2},
+	{0x1E41,0x3E0,0x2}, {0x1E42,0x3E2,0x2}, {0x1E43,0x3E4,0x2}, {0x1E44,0x3E6,0x2}, {0x1E45,0x3E8,0x2}, {0x1E46,0x3EA,0x2},
+	{0x1E47,0x3EC,0x2}, {0x1E48,0x3EE,0x2}, {0x1E49,0x3F0,0x2}, {0x1E4A,0x3F2,0x2}, {0x1E4B,0x3F4,0x2}, {0x1E4C,0x3F6,0x3},
+	{0x1E4D,0x3F9,0x3}, {0x1E4E,0x3FC,0x3}, {0x1E4F,0x3FF,0x3}, {0x1E50,0x402,0x3}, {0x1E51,0x405,0x3}, {0x1E52,0x408,0x3},
+	{0x1E53,0x40B,0x3}, {0x1E54,0x40E,0x2}, {0x1E55,0x410,0x2}, {0x1E56,0x412,0x2}, {0x1E57,0x414,0x2}, {0x1E58,0x416,0x2},
+	{0x1E59,0x418,0x2}, {0x1E5A,0x41A,0x2}, {0x1E5B,0x41C,0x2}, {0x1E5C,0x41E,0x3}, {0x1E5D,0x421,0x3}, {0x1E5E,0x424,0x2},
+	{0x1E5F,0x426,0x2}, {0x1E60,0x428,0x2}, {0x1E61,0x42A,0x2}, {0x1E62,0x42C,0x2}, {0x1E63,0x42E,0x2}, {0x1E64,0x430,0x3},
+	{0x1E65,0x433,0x3}, {0x1E66,0x436,0x3}, {0x1E67,0x439,0x3}, {0x1E68,0x43C,0x3}, {0x1E69,0x43F,0x3}, {0x1E6A,0x442,0x2},
+	{0x1E6B,0x444,0x2}, {0x1E6C,0x446,0x2}, {0x1E6D,0x448,0x2}, {0x1E6E,0x44A,0x2}, {0x1E6F,0x44C,0x2}, {0x1E70,0x44E,0x2},
+	{0x1E71,0x450,0x2}, {0x1E72,0x452,0x2}, {0x1E73,0x454,0x2}, {0x1E74,0x456,0x2}, {0x1E75,0x458,0x2}, {0x1E76,0x45A,0x2},
+	{0x1E77,0x45C,0x2}, {0x1E78,0x45E,0x3}, {0x1E79,0x461,0x3}, {0x1E7A,0x464,0x3}, {0x1E7B,0x467,0x3}, {0x1E7C,0x46A,0x2},
+	{0x1E7D,0x46C,0x2}, {0x1E7E,0x46E,0x2}, {0x1E7F,0x470,0x2}, {0x1E80,0x472,0x2}, {0x1E81,0x474,0x2}, {0x1E82,0x476,0x2},
+	{0x1E83,0x478,0x2}, {0x1E84,0x47A,0x2}, {0x1E85,0x47C,0x2}, {0x1E86,0x47E,0x2}, {0x1E87,0x480,0x2}, {0x1E88,0x482,0x2},
+	{0x1E89,0x484,0x2}, {0x1E8A,0x486,0x2}, {0x1E8B,0x488,0x2}, {0x1E8C,0x48A,0x2}, {0x1E8D,0x48C,0x2}, {0x1E8E,0x48E,0x2},
+	{0x1E8F,0x490,0x2}, {0x1E90,0x492,0x2}, {0x1E91,0x494,0x2}, {0x1E92,0x496,0x2}, {0x1E93,0x498,0x2}, {0x1E94,0x49A,0x2},
+	{0x1E95,0x49C,0x2}, {0x1E96,0x49E,0x2}, {0x1E97,0x4A0,0x2}, {0x1E98,0x4A2,0x2}, {0x1E99,0x4A4,0x2}, {0x1E9B,0x4A6,0x2},
+	{0x1EA0,0x4A8,0x2}, {0x1EA1,0x4AA,0x2}, {0x1EA2,0x4AC,0x2}, {0x1EA3,0x4AE,0x2}, {0x1EA4,0x4B0,0x3}, {0x1EA5,0x4B3,0x3},
+	{0x1EA6,0x4B6,0x3}, {0x1EA7,0x4B9,0x3}, {0x1EA8,0x4BC,0x3}, {0x1EA9,0x4BF,0x3}, {0x1EAA,0x4C2,0x3}, {0x1EAB,0x4C5,0x3},
+	{0x1EAC,0x4C8,0x3}, {0x1EAD,0x4CB,0x3}, {0x1EAE,0x4CE,0x3}, {0x1EAF,0x4D1,0x3}, {0x1EB0,0x4D4,0x3}, {0x1EB1,0x4D7,0x3},
+	{0x1EB2,0x4DA,0x3}, {0x1EB3,0x4DD,0x3}, {0x1EB4,0x4E0,0x3}, {0x1EB5,0x4E3,0x3}, {0x1EB6,0x4E6,0x3}, {0x1EB7,0x4E9,0x3},
+	{0x1EB8,0x4EC,0x2}, {0x1EB9,0x4EE,0x2}, {0x1EBA,0x4F0,0x2}, {0x1EBB,0x4F2,0x2}, {0x1EBC,0x4F4,0x2}, {0x1EBD,0x4F6,0x2},
+	{0x1EBE,0x4F8,0x3}, {0x1EBF,0x4FB,0x3}, {0x1EC0,0x4FE,0x3}, {0x1EC1,0x501,0x3}, {0x1EC2,0x504,0x3}, {0x1EC3,0x507,0x3},
+	{0x1EC4,0x50A,0x3}, {0x1EC5,0x50D,0x3}, {0x1EC6,0x510,0x3}, {0x1EC7,0x513,0x3}, {0x1EC8,0x516,0x2}, {0x1EC9,0x518,0x2},
+	{0x1ECA,0x51A,0x2}, {0x1ECB,0x51C,0x2}, {0x1ECC,0x51E,0x2}, {0x1ECD,0x520,0x2}, {0x1ECE,0x522,0x2}, {0x1ECF,0x524,0x2},
+	{0x1ED0,0x526,0x3}, {0x1ED1,0x529,0x3}, {0x1ED2,0x52C,0x3}, {0x1ED3,0x52F,0x3}, {0x1ED4,0x532,0x3}, {0x1ED5,0x535,0x3},
+	{0x1ED6,0x538,0x3}, {0x1ED7,0x53B,0x3}, {0x1ED8,0x53E,0x3}, {0x1ED9,0x541,0x3}, {0x1EDA,0x544,0x3}, {0x1EDB,0x547,0x3},
+	{0x1EDC,0x54A,0x3}, {0x1EDD,0x54D,0x3}, {0x1EDE,0x550,0x3}, {0x1EDF,0x553,0x3}, {0x1EE0,0x556,0x3}, {0x1EE1,0x559,0x3},
+	{0x1EE2,0x55C,0x3}, {0x1EE3,0x55F,0x3}, {0x1EE4,0x562,0x2}, {0x1EE5,0x564,0x2}, {0x1EE6,0x566,0x2}, {0x1EE7,0x568,0x2},
+	{0x1EE8,0x56A,0x3}, {0x1EE9,0x56D,0x3}, {0x1EEA,0x570,0x3}, {0x1EEB,0x573,0x3}, {0x1EEC,0x576,0x3}, {0x1EED,0x579,0x3},
+	{0x1EEE,0x57C,0x3}, {0x1EEF,0x57F,0x3}, {0x1EF0,0x582,0x3}, {0x1EF1,0x585,0x3}, {0x1EF2,0x588,0x2}, {0x1EF3,0x58A,0x2},
+	{0x1EF4,0x58C,0x2}, {0x1EF5,0x58E,0x2}, {0x1EF6,0x590,0x2}, {0x1EF7,0x592,0x2}, {0x1EF8,0x594,0x2}, {0x1EF9,0x596,0x2},
+	{0x1F00,0x598,0x2}, {0x1F01,0x59A,0x2}, {0x1F02,0x59C,0x3}, {0x1F03,0x59F,0x3}, {0x1F04,0x5A2,0x3}, {0x1F05,0x5A5,0x3},
+	{0x1F06,0x5A8,0x3}, {0x1F07,0x5AB,0x3}, {0x1F08,0x5AE,0x2}, {0x1F09,0x5B0,0x2}, {0x1F0A,0x5B2,0x3}, {0x1F0B,0x5B5,0x3},
+	{0x1F0C,0x5B8,0x3}, {0x1F0D,0x5BB,0x3}, {0x1F0E,0x5BE,0x3}, {0x1F0F,0x5C1,0x3}, {0x1F10,0x5C4,0x2}, {0x1F11,0x5C6,0x2},
+	{0x1F12,0x5C8,0x3}, {0x1F13,0x5CB,0x3}, {0x1F14,0x5CE,0x3}, {0x1F15,0x5D1,0x3}, {0x1F18,0x5D4,0x2}, {0x1F19,0x5D6,0x2},
+	{0x1F1A,0x5D8,0x3}, {0x1F1B,0x5DB,0x3}, {0x1F1C,0x5DE,0x3}, {0x1F1D,0x5E1,0x3}, {0x1F20,0x5E4,0x2}, {0x1F21,0x5E6,0x2},
+	{0x1F22,0x5E8,0x3}, {0x1F23,0x5EB,0x3}, {0x1F24,0x5EE,0x3}, {0x1F25,0x5F1,0x3}, {0x1F26,0x5F4,0x3}, {0x1F27,0x5F7,0x3},
+	{0x1F28,0x5FA,0x2}, {0x1F29,0x5FC,0x2}, {0x1F2A,0x5FE,0x3}, {0x1F2B,0x601,0x3}, {0x1F2C,0x604,0x3}, {0x1F2D,0x607,0x3},
+	{0x1F2E,0x60A,0x3}, {0x1F2F,0x60D,0x3}, {0x1F30,0x610,0x2}, {0x1F31,0x612,0x2}, {0x1F32,0x614,0x3}, {0x1F33,0x617,0x3},
+	{0x1F34,0x61A,0x3}, {0x1F35,0x61D,0x3}, {0x1F36,0x620,0x3}, {0x1F37,0x623,0x3}, {0x1F38,0x626,0x2}, {0x1F39,0x628,0x2},
+	{0x1F3A,0x62A,0x3}, {0x1F3B,0x62D,0x3}, {0x1F3C,0x630,0x3}, {0x1F3D,0x633,0x3}, {0x1F3E,0x636,0x3}, {0x1F3F,0x639,0x3},
+	{0x1F40,0x63C,0x2}, {0x1F41,0x63E,0x2}, {0x1F42,0x640,0x3}, {0x1F43,0x643,0x3}, {0x1F44,0x646,0x3}, {0x1F45,0x649,0x3},
+	{0x1F48,0x64C,0x2}, {0x1F49,0x64E,0x2}, {0x1F4A,0x650,0x3}, {0x1F4B,0x653,0x3}, {0x1F4C,0x656,0x3}, {0x1F4D,0x659,0x3},
+	{0x1F50,0x65C,0x2}, {0x1F51,0x65E,0x2}, {0x1F52,0x660,0x3}, {0x1F53,0x663,0x3}, {0x1F54,0x666,0x3}, {0x1F55,0x669,0x3},
+	{0x1F56,0x66C,0x3}, {0x1F57,0x66F,0x3}, {0x1F59,0x672,0x2}, {0x1F5B,0x674,0x3}, {0x1F5D,0x677,0x3}, {0x1F5F,0x67A,0x3},
+	{0x1F60,0x67D,0x2}, {0x1F61,0x67F,0x2}, {0x1F62,0x681,0x3}, {0x1F63,0x684,0x3}, {0x1F64,0x687,0x3}, {0x1F65,0x68A,0x3},
+	{0x1F66,0x68D,0x3}, {0x1F67,0x690,0x3}, {0x1F68,0x693,0x2}, {0x1F69,0x695,0x2}, {0x1F6A,0x697,0x3}, {0x1F6B,0x69A,0x3},
+	{0x1F6C,0x69D,0x3}, {0x1F6D,0x6A0,0x3}, {0x1F6E,0x6A3,0x3}, {0x1F6F,0x6A6,0x3}, {0x1F70,0x6A9,0x2}, {0x1F71,0x6AB,0x2},
+	{0x1F72,0x6AD,0x2}, {0x1F73,0x6AF,0x2}, {0x1F74,0x6B1,0x2}, {0x1F75,0x6B3,0x2}, {0x1F76,0x6B5,0x2}, {0x1F77,0x6B7,0x2},
+	{0x1F78,0x6B9,0x2}, {0x1F79,0x6BB,0x2}, {0x1F7A,0x6BD,0x2}, {0x1F7B,0x6BF,0x2}, {0x1F7C,0x6C1,0x2}, {0x1F7D,0x6C3,0x2},
+	{0x1F80,0x6C5,0x3}, {0x1F81,0x6C8,0x3}, {0x1F82,0x6CB,0x4}, {0x1F83,0x6CF,0x4}, {0x1F84,0x6D3,0x4}, {0x1F85,0x6D7,0x4},
+	{0x1F86,0x6DB,0x4}, {0x1F87,0x6DF,0x4}, {0x1F88,0x6E3,0x3}, {0x1F89,0x6E6,0x3}, {0x1F8A,0x6E9,0x4}, {0x1F8B,0x6ED,0x4},
+	{0x1F8C,0x6F1,0x4}, {0x1F8D,0x6F5,0x4}, {0x1F8E,0x6F9,0x4}, {0x1F8F,0x6FD,0x4}, {0x1F90,0x701,0x3}, {0x1F91,0x704,0x3},
+	{0x1F92,0x707,0x4}, {0x1F93,0x70B,0x4}, {0x1F94,0x70F,0x4}, {0x1F95,0x713,0x4}, {0x1F96,0x717,0x4}, {0x1F97,0x71B,0x4},
+	{0x1F98,0x71F,0x3}, {0x1F99,0x722,0x3}, {0x1F9A,0x725,0x4}, {0x1F9B,0x729,0x4}, {0x1F9C,0x72D,0x4}, {0x1F9D,0x731,0x4},
+	{0x1F9E,0x735,0x4}, {0x1F9F,0x739,0x4}, {0x1FA0,0x73D,0x3}, {0x1FA1,0x740,0x3}, {0x1FA2,0x743,0x4}, {0x1FA3,0x747,0x4},
+	{0x1FA4,0x74B,0x4}, {0x1FA5,0x74F,0x4}, {0x1FA6,0x753,0x4}, {0x1FA7,0x757,0x4}, {0x1FA8,0x75B,0x3}, {0x1FA9,0x75E,0x3},
+	{0x1FAA,0x761,0x4}, {0x1FAB,0x765,0x4}, {0x1FAC,0x769,0x4}, {0x1FAD,0x76D,0x4}, {0x1FAE,0x771,0x4}, {0x1FAF,0x775,0x4},
+	{0x1FB0,0x779,0x2}, {0x1FB1,0x77B,0x2}, {0x1FB2,0x77D,0x3}, {0x1FB3,0x780,0x2}, {0x1FB4,0x782,0x3}, {0x1FB6,0x785,0x2},
+	{0x1FB7,0x787,0x3}, {0x1FB8,0x78A,0x2}, {0x1FB9,0x78C,0x2}, {0x1FBA,0x78E,0x2}, {0x1FBB,0x790,0x2}, {0x1FBC,0x792,0x2},
+	{0x1FBE,0x794,0x1}, {0x1FC1,0x795,0x2}, {0x1FC2,0x797,0x3}, {0x1FC3,0x79A,0x2}, {0x1FC4,0x79C,0x3}, {0x1FC6,0x79F,0x2},
+	{0x1FC7,0x7A1,0x3}, {0x1FC8,0x7A4,0x2}, {0x1FC9,0x7A6,0x2}, {0x1FCA,0x7A8,0x2}, {0x1FCB,0x7AA,0x2}, {0x1FCC,0x7AC,0x2},
+	{0x1FCD,0x7AE,0x2}, {0x1FCE,0x7B0,0x2}, {0x1FCF,0x7B2,0x2}, {0x1FD0,0x7B4,0x2}, {0x1FD1,0x7B6,0x2}, {0x1FD2,0x7B8,0x3},
+	{0x1FD3,0x7BB,0x3}, {0x1FD6,0x7BE,0x2}, {0x1FD7,0x7C0,0x3}, {0x1FD8,0x7C3,0x2}, {0x1FD9,0x7C5,0x2}, {0x1FDA,0x7C7,0x2},
+	{0x1FDB,0x7C9,0x2}, {0x1FDD,0x7CB,0x2}, {0x1FDE,0x7CD,0x2}, {0x1FDF,0x7CF,0x2}, {0x1FE0,0x7D1,0x2}, {0x1FE1,0x7D3,0x2},
+	{0x1FE2,0x7D5,0x3}, {0x1FE3,0x7D8,0x3}, {0x1FE4,0x7DB,0x2}, {0x1FE5,0x7DD,0x2}, {0x1FE6,0x7DF,0x2}, {0x1FE7,0x7E1,0x3},
+	{0x1FE8,0x7E4,0x2}, {0x1FE9,0x7E6,0x2}, {0x1FEA,0x7E8,0x2}, {0x1FEB,0x7EA,0x2}, {0x1FEC,0x7EC,0x2}, {0x1FED,0x7EE,0x2},
+	{0x1FEE,0x7F0,0x2}, {0x1FEF,0x7F2,0x1}, {0x1FF2,0x7F3,0x3}, {0x1FF3,0x7F6,0x2}, {0x1FF4,0x7F8,0x3}, {0x1FF6,0x7FB,0x2},
+	{0x1FF7,0x7FD,0x3}, {0x1FF8,0x800,0x2}, {0x1FF9,0x802,0x2}, {0x1FFA,0x804,0x2}, {0x1FFB,0x806,0x2}, {0x1FFC,0x808,0x2},
+	{0x1FFD,0x80A,0x1}, {0x2000,0x80B,0x1}, {0x2001,0x80C,0x1}, {0x2126,0x80D,0x1}, {0x212A,0x80E,0x1}, {0x212B,0x80F,0x2},
+	{0x219A,0x811,0x2}, {0x219B,0x813,0x2}, {0x21AE,0x815,0x2}, {0x21CD,0x817,0x2}, {0x21CE,0x819,0x2}, {0x21CF,0x81B,0x2},
+	{0x2204,0x81D,0x2}, {0x2209,0x81F,0x2}, {0x220C,0x821,0x2}, {0x2224,0x823,0x2}, {0x2226,0x825,0x2}, {0x2241,0x827,0x2},
+	{0x2244,0x829,0x2}, {0x2247,0x82B,0x2}, {0x2249,0x82D,0x2}, {0x2260,0x82F,0x2}, {0x2262,0x831,0x2}, {0x226D,0x833,0x2},
+	{0x226E,0x835,0x2}, {0x226F,0x837,0x2}, {0x2270,0x839,0x2}, {0x2271,0x83B,0x2}, {0x2274,0x83D,0x2}, {0x2275,0x83F,0x2},
+	{0x2278,0x841,0x2}, {0x2279,0x843,0x2}, {0x2280,0x845,0x2}, {0x2281,0x847,0x2}, {0x2284,0x849,0x2}, {0x2285,0x84B,0x2},
+	{0x2288,0x84D,0x2}, {0x2289,0x84F,0x2}, {0x22AC,0x851,0x2}, {0x22AD,0x853,0x2}, {0x22AE,0x855,0x2}, {0x22AF,0x857,0x2},
+	{0x22E0,0x859,0x2}, {0x22E1,0x85B,0x2}, {0x22E2,0x85D,0x2}, {0x22E3,0x85F,0x2}, {0x22EA,0x861,0x2}, {0x22EB,0x863,0x2},
+	{0x22EC,0x865,0x2}, {0x22ED,0x867,0x2}, {0x2329,0x869,0x1}, {0x232A,0x86A,0x1}, {0x2ADC,0x86B,0x2}, {0x304C,0x86D,0x2},
+	{0x304E,0x86F,0x2}, {0x3050,0x871,0x2}, {0x3052,0x873,0x2}, {0x3054,0x875,0x2}, {0x3056,0x877,0x2}, {0x3058,0x879,0x2},
+	{0x305A,0x87B,0x2}, {0x305C,0x87D,0x2}, {0x305E,0x87F,0x2}, {0x3060,0x881,0x2}, {0x3062,0x883,0x2}, {0x3065,0x885,0x2},
+	{0x3067,0x887,0x2}, {0x3069,0x889,0x2}, {0x3070,0x88B,0x2}, {0x3071,0x88D,0x2}, {0x3073,0x88F,0x2}, {0x3074,0x891,0x2},
+	{0x3076,0x893,0x2}, {0x3077,0x895,0x2}, {0x3079,0x897,0x2}, {0x307A,0x899,0x2}, {0x307C,0x89B,0x2}, {0x307D,0x89D,0x2},
+	{0x3094,0x89F,0x2}, {0x309E,0x8A1,0x2}, {0x30AC,0x8A3,0x2}, {0x30AE,0x8A5,0x2}, {0x30B0,0x8A7,0x2}, {0x30B2,0x8A9,0x2},
+	{0x30B4,0x8AB,0x2}, {0x30B6,0x8AD,0x2}, {0x30B8,0x8AF,0x2}, {0x30BA,0x8B1,0x2}, {0x30BC,0x8B3,0x2}, {0x30BE,0x8B5,0x2},
+	{0x30C0,0x8B7,0x2}, {0x30C2,0x8B9,0x2}, {0x30C5,0x8BB,0x2}, {0x30C7,0x8BD,0x2}, {0x30C9,0x8BF,0x2}, {0x30D0,0x8C1,0x2},
+	{0x30D1,0x8C3,0x2}, {0x30D3,0x8C5,0x2}, {0x30D4,0x8C7,0x2}, {0x30D6,0x8C9,0x2}, {0x30D7,0x8CB,0x2}, {0x30D9,0x8CD,0x2},
+	{0x30DA,0x8CF,0x2}, {0x30DC,0x8D1,0x2}, {0x30DD,0x8D3,0x2}, {0x30F4,0x8D5,0x2}, {0x30F7,0x8D7,0x2}, {0x30F8,0x8D9,0x2},
+	{0x30F9,0x8DB,0x2}, {0x30FA,0x8DD,0x2}, {0x30FE,0x8DF,0x2}, {0xF900,0x8E1,0x1}, {0xF901,0x8E2,0x1}, {0xF902,0x8E3,0x1},
+	{0xF903,0x8E4,0x1}, {0xF904,0x8E5,0x1}, {0xF905,0x8E6,0x1}, {0xF906,0x8E7,0x1}, {0xF907,0x8E8,0x1}, {0xF908,0x8E9,0x1},
+	{0xF909,0x8EA,0x1}, {0xF90A,0x8EB,0x1}, {0xF90B,0x8EC,0x1}, {0xF90C,0x8ED,0x1}, {0xF90D,0x8EE,0x1}, {0xF90E,0x8EF,0x1},
+	{0xF90F,0x8F0,0x1}, {0xF910,0x8F1,0x1}, {0xF911,0x8F2,0x1}, {0xF912,0x8F3,0x1}, {0xF913,0x8F4,0x1}, {0xF914,0x8F5,0x1},
+	{0xF915,0x8F6,0x1}, {0xF916,0x8F7,0x1}, {0xF917,0x8F8,0x1}, {0xF918,0x8F9,0x1}, {0xF919,0x8FA,0x1}, {0xF91A,0x8FB,0x1},
+	{0xF91B,0x8FC,0x1}, {0xF91C,0x8FD,0x1}, {0xF91D,0x8FE,0x1}, {0xF91E,0x8FF,0x1}, {0xF91F,0x900,0x1}, {0xF920,0x901,0x1},
+	{0xF921,0x902,0x1}, {0xF922,0x903,0x1}, {0xF923,0x904,0x1}, {0xF924,0x905,0x1}, {0xF925,0x906,0x1}, {0xF926,0x907,0x1},
+	{0xF927,0x908,0x1}, {0xF928,0x909,0x1}, {0xF929,0x90A,0x1}, {0xF92A,0x90B,0x1}, {0xF92B,0x90C,0x1}, {0xF92C,0x90D,0x1},
+	{0xF92D,0x90E,0x1}, {0xF92E,0x90F,0x1}, {0xF92F,0x910,0x1}, {0xF930,0x911,0x1}, {0xF931,0x912,0x1}, {0xF932,0x913,0x1},
+	{0xF933,0x914,0x1}, {0xF934,0x915,0x1}, {0xF935,0x916,0x1}, {0xF936,0x917,0x1}, {0xF937,0x918,0x1}, {0xF938,0x919,0x1},
+	{0xF939,0x91A,0x1}, {0xF93A,0x91B,0x1}, {0xF93B,0x91C,0x1}, {0xF93C,0x91D,0x1}, {0xF93D,0x91E,0x1}, {0xF93E,0x91F,0x1},
+	{0xF93F,0x920,0x1}, {0xF940,0x921,0x1}, {0xF941,0x922,0x1}, {0xF942,0x923,0x1}, {0xF943,0x924,0x1}, {0xF944,0x925,0x1},
+	{0xF945,0x926,0x1}, {0xF946,0x927,0x1}, {0xF947,0x928,0x1}, {0xF948,0x929,0x1}, {0xF949,0x92A,0x1}, {0xF94A,0x92B,0x1},
+	{0xF94B,0x92C,0x1}, {0xF94C,0x92D,0x1}, {0xF94D,0x92E,0x1}, {0xF94E,0x92F,0x1}, {0xF94F,0x930,0x1}, {0xF950,0x931,0x1},
+	{0xF951,0x932,0x1}, {0xF952,0x933,0x1}, {0xF953,0x934,0x1}, {0xF954,0x935,0x1}, {0xF955,0x936,0x1}, {0xF956,0x937,0x1},
+	{0xF957,0x938,0x1}, {0xF958,0x939,0x1}, {0xF959,0x93A,0x1}, {0xF95A,0x93B,0x1}, {0xF95B,0x93C,0x1}, {0xF95C,0x93D,0x1},
+	{0xF95D,0x93E,0x1}, {0xF95E,0x93F,0x1}, {0xF95F,0x940,0x1}, {0xF960,0x941,0x1}, {0xF961,0x942,0x1}, {0xF962,0x943,0x1},
+	{0xF963,0x944,0x1}, {0xF964,0x945,0x1}, {0xF965,0x946,0x1}, {0xF966,0x947,0x1}, {0xF967,0x948,0x1}, {0xF968,0x949,0x1},
+	{0xF969,0x94A,0x1}, {0xF96A,0x94B,0x1}, {0xF96B,0x94C,0x1}, {0xF96C,0x94D,0x1}, {0xF96D,0x94E,0x1}, {0xF96E,0x94F,0x1},
+	{0xF96F,0x950,0x1}, {0xF970,0x951,0x1}, {0xF971,0x952,0x1}, {0xF972,0x953,0x1}, {0xF973,0x954,0x1}, {0xF974,0x955,0x1},
+	{0xF975,0x956,0x1}, {0xF976,0x957,0x1}, {0xF977,0x958,0x1}, {0xF978,0x959,0x1}, {0xF979,0x95A,0x1}, {0xF97A,0x95B,0x1},
+	{0xF97B,0x95C,0x1}, {0xF97C,0x95D,0x1}, {0xF97D,0x95E,0x1}, {0xF97E,0x95F,0x1}, {0xF97F,0x960,0x1}, {0xF980,0x961,0x1},
+	{0xF981,0x962,0x1}, {0xF982,0x963,0x1}, {0xF983,0x964,0x1}, {0xF984,0x965,0x1}, {0xF985,0x966,0x1}, {0xF986,0x967,0x1},
+	{0xF987,0x968,0x1}, {0xF988,0x969,0x1}, {0xF989,0x96A,0x1}, {0xF98A,0x96B,0x1}, {0xF98B,0x96C,0x1}, {0xF98C,0x96D,0x1},
+	{0xF98D,0x96E,0x1}, {0xF98E,0x96F,0x1}, {0xF98F,0x970,0x1}, {0xF990,0x971,0x1}, {0xF991,0x972,0x1}, {0xF992,0x973,0x1},
+	{0xF993,0x974,0x1}, {0xF994,0x975,0x1}, {0xF995,0x976,0x1}, {0xF996,0x977,0x1}, {0xF997,0x978,0x1}, {0xF998,0x979,0x1},
+	{0xF999,0x97A,0x1}, {0xF99A,0x97B,0x1}, {0xF99B,0x97C,0x1}, {0xF99C,0x97D,0x1}, {0xF99D,0x97E,0x1}, {0xF99E,0x97F,0x1},
+	{0xF99F,0x980,0x1}, {0xF9A0,0x981,0x1}, {0xF9A1,0x982,0x1}, {0xF9A2,0x983,0x1}, {0xF9A3,0x984,0x1}, {0xF9A4,0x985,0x1},
+	{0xF9A5,0x986,0x1}, {0xF9A6,0x987,0x1}, {0xF9A7,0x988,0x1}, {0xF9A8,0x989,0x1}, {0xF9A9,0x98A,0x1}, {0xF9AA,0x98B,0x1},
+	{0xF9AB,0x98C,0x1}, {0xF9AC,0x98D,0x1}, {0xF9AD,0x98E,0x1}, {0xF9AE,0x98F,0x1}, {0xF9AF,0x990,0x1}, {0xF9B0,0x991,0x1},
+	{0xF9B1,0x992,0x1}, {0xF9B2,0x993,0x1}, {0xF9B3,0x994,0x1}, {0xF9B4,0x995,0x1}, {0xF9B5,0x996,0x1}, {0xF9B6,0x997,0x1},
+	{0xF9B7,0x998,0x1}, {0xF9B8,0x999,0x1}, {0xF9B9,0x99A,0x1}, {0xF9BA,0x99B,0x1}, {0xF9BB,0x99C,0x1}, {0xF9BC,0x99D,0x1},
+	{0xF9BD,0x99E,0x1}, {0xF9BE,0x99F,0x1}, {0xF9BF,0x9A0,0x1}, {0xF9C0,0x9A1,0x1}, {0xF9C1,0x9A2,0x1}, {0xF9C2,0x9A3,0x1},
+	{0xF9C3,0x9A4,0x1}, {0xF9C4,0x9A5,0x1}, {0xF9C5,0x9A6,0x1}, {0xF9C6,0x9A7,0x1}, {0xF9C7,0x9A8,0x1}, {0xF9C8,0x9A9,0x1},
+	{0xF9C9,0x9AA,0x1}, {0xF9CA,0x9AB,0x1}, {0xF9CB,0x9AC,0x1}, {0xF9CC,0x9AD,0x1}, {0xF9CD,0x9AE,0x1}, {0xF9CE,0x9AF,0x1},
+	{0xF9CF,0x9B0,0x1}, {0xF9D0,0x9B1,0x1}, {0xF9D1,0x9B2,0x1}, {0xF9D2,0x9B3,0x1}, {0xF9D3,0x9B4,0x1}, {0xF9D4,0x9B5,0x1},
+	{0xF9D5,0x9B6,0x1}, {0xF9D6,0x9B7,0x1}, {0xF9D7,0x9B8,0x1}, {0xF9D8,0x9B9,0x1}, {0xF9D9,0x9BA,0x1}, {0xF9DA,0x9BB,0x1},
+	{0xF9DB,0x9BC,0x1}, {0xF9DC,0x9BD,0x1}, {0xF9DD,0x9BE,0x1}, {0xF9DE,0x9BF,0x1}, {0xF9DF,0x9C0,0x1}, {0xF9E0,0x9C1,0x1},
+	{0xF9E1,0x9C2,0x1}, {0xF9E2,0x9C3,0x1}, {0xF9E3,0x9C4,0x1}, {0xF9E4,0x9C5,0x1}, {0xF9E5,0x9C6,0x1}, {0xF9E6,0x9C7,0x1},
+	{0xF9E7,0x9C8,0x1}, {0xF9E8,0x9C9,0x1}, {0xF9E9,0x9CA,0x1}, {0xF9EA,0x9CB,0x1}, {0xF9EB,0x9CC,0x1}, {0xF9EC,0x9CD,0x1},
+	{0xF9ED,0x9CE,0x1}, {0xF9EE,0x9CF,0x1}, {0xF9EF,0x9D0,0x1}, {0xF9F0,0x9D1,0x1}, {0xF9F1,0x9D2,0x1}, {0xF9F2,0x9D3,0x1},
+	{0xF9F3,0x9D4,0x1}, {0xF9F4,0x9D5,0x1}, {0xF9F5,0x9D6,0x1}, {0xF9F6,0x9D7,0x1}, {0xF9F7,0x9D8,0x1}, {0xF9F8,0x9D9,0x1},
+	{0xF9F9,0x9DA,0x1}, {0xF9FA,0x9DB,0x1}, {0xF9FB,0x9DC,0x1}, {0xF9FC,0x9DD,0x1}, {0xF9FD,0x9DE,0x1}, {0xF9FE,0x9DF,0x1},
+	{0xF9FF,0x9E0,0x1}, {0xFA00,0x9E1,0x1}, {0xFA01,0x9E2,0x1}, {0xFA02,0x9E3,0x1}, {0xFA03,0x9E4,0x1}, {0xFA04,0x9E5,0x1},
+	{0xFA05,0x9E6,0x1}, {0xFA06,0x9E7,0x1}, {0xFA07,0x9E8,0x1}, {0xFA08,0x9E9,0x1}, {0xFA09,0x9EA,0x1}, {0xFA0A,0x9EB,0x1},
+	{0xFA0B,0x9EC,0x1}, {0xFA0C,0x9ED,0x1}, {0xFA0D,0x9EE,0x1}, {0xFA10,0x9EF,0x1}, {0xFA12,0x9F0,0x1}, {0xFA15,0x9F1,0x1},
+	{0xFA16,0x9F2,0x1}, {0xFA17,0x9F3,0x1}, {0xFA18,0x9F4,0x1}, {0xFA19,0x9F5,0x1}, {0xFA1A,0x9F6,0x1}, {0xFA1B,0x9F7,0x1},
+	{0xFA1C,0x9F8,0x1}, {0xFA1D,0x9F9,0x1}, {0xFA1E,0x9FA,0x1}, {0xFA20,0x9FB,0x1}, {0xFA22,0x9FC,0x1}, {0xFA25,0x9FD,0x1},
+	{0xFA26,0x9FE,0x1}, {0xFA2A,0x9FF,0x1}, {0xFA2B,0xA00,0x1}, {0xFA2C,0xA01,0x1}, {0xFA2D,0xA02,0x1}, {0xFA2E,0xA03,0x1},
+	{0xFA2F,0xA04,0x1}, {0xFA30,0xA05,0x1}, {0xFA31,0xA06,0x1}, {0xFA32,0xA07,0x1}, {0xFA33,0xA08,0x1}, {0xFA34,0xA09,0x1},
+	{0xFA35,0xA0A,0x1}, {0xFA36,0xA0B,0x1}, {0xFA37,0xA0C,0x1}, {0xFA38,0xA0D,0x1}, {0xFA39,0xA0E,0x1}, {0xFA3A,0xA0F,0x1},
+	{0xFA3B,0xA10,0x1}, {0xFA3C,0xA11,0x1}, {0xFA3D,0xA12,0x1}, {0xFA3E,0xA13,0x1}, {0xFA3F,0xA14,0x1}, {0xFA40,0xA15,0x1},
+	{0xFA41,0xA16,0x1}, {0xFA42,0xA17,0x1}, {0xFA43,0xA18,0x1}, {0xFA44,0xA19,0x1}, {0xFA45,0xA1A,0x1}, {0xFA46,0xA1B,0x1},
+	{0xFA47,0xA1C,0x1}, {0xFA48,0xA1D,0x1}, {0xFA49,0xA1E,0x1}, {0xFA4A,0xA1F,0x1}, {0xFA4B,0xA20,0x1}, {0xFA4C,0xA21,0x1},
+	{0xFA4D,0xA22,0x1}, {0xFA4E,0xA23,0x1}, {0xFA4F,0xA24,0x1}, {0xFA50,0xA25,0x1}, {0xFA51,0xA26,0x1}, {0xFA52,0xA27,0x1},
+	{0xFA53,0xA28,0x1}, {0xFA54,0xA29,0x1}, {0xFA55,0xA2A,0x1}, {0xFA56,0xA2B,0x1}, {0xFA57,0xA2C,0x1}, {0xFA58,0xA2D,0x1},
+	{0xFA59,0xA2E,0x1}, {0xFA5A,0xA2F,0x1}, {0xFA5B,0xA30,0x1}, {0xFA5C,0xA31,0x1}, {0xFA5D,0xA32,0x1}, {0xFA5E,0xA33,0x1},
+	{0xFA5F,0xA34,0x1}, {0xFA60,0xA35,0x1}, {0xFA61,0xA36,0x1}, {0xFA62,0xA37,0x1}, {0xFA63,0xA38,0x1}, {0xFA64,0xA39,0x1},
+	{0xFA65,0xA3A,0x1}, {0xFA66,0xA3B,0x1}, {0xFA67,0xA3C,0x1}, {0xFA68,0xA3D,0x1}, {0xFA69,0xA3E,0x1}, {0xFA6A,0xA3F,0x1},
+	{0xFA6B,0xA40,0x1}, {0xFA6C,0xA41,0x1}, {0xFA6D,0xA42,0x1}, {0xFA70,0xA43,0x1}, {0xFA71,0xA44,0x1}, {0xFA72,0xA45,0x1},
+	{0xFA73,0xA46,0x1}, {0xFA74,0xA47,0x1}, {0xFA75,0xA48,0x1}, {0xFA76,0xA49,0x1}, {0xFA77,0xA4A,0x1}, {0xFA78,0xA4B,0x1},
+	{0xFA79,0xA4C,0x1}, {0xFA7A,0xA4D,0x1}, {0xFA7B,0xA4E,0x1}, {0xFA7C,0xA4F,0x1}, {0xFA7D,0xA50,0x1}, {0xFA7E,0xA51,0x1},
+	{0xFA7F,0xA52,0x1}, {0xFA80,0xA53,0x1}, {0xFA81,0xA54,0x1}, {0xFA82,0xA55,0x1}, {0xFA83,0xA56,0x1}, {0xFA84,0xA57,0x1},
+	{0xFA85,0xA58,0x1}, {0xFA86,0xA59,0x1}, {0xFA87,0xA5A,0x1}, {0xFA88,0xA5B,0x1}, {0xFA89,0xA5C,0x1}, {0xFA8A,0xA5D,0x1},
+	{0xFA8B,0xA5E,0x1}, {0xFA8C,0xA5F,0x1}, {0xFA8D,0xA60,0x1}, {0xFA8E,0xA61,0x1}, {0xFA8F,0xA62,0x1}, {0xFA90,0xA63,0x1},
+	{0xFA91,0xA64,0x1}, {0xFA92,0xA65,0x1}, {0xFA93,0xA66,0x1}, {0xFA94,0xA67,0x1}, {0xFA95,0xA68,0x1}, {0xFA96,0xA69,0x1},
+	{0xFA97,0xA6A,0x1}, {0xFA98,0xA6B,0x1}, {0xFA99,0xA6C,0x1}, {0xFA9A,0xA6D,0x1}, {0xFA9B,0xA6E,0x1}, {0xFA9C,0xA6F,0x1},
+	{0xFA9D,0xA70,0x1}, {0xFA9E,0xA71,0x1}, {0xFA9F,0xA72,0x1}, {0xFAA0,0xA73,0x1}, {0xFAA1,0xA74,0x1}, {0xFAA2,0xA75,0x1},
+	{0xFAA3,0xA76,0x1}, {0xFAA4,0xA77,0x1}, {0xFAA5,0xA78,0x1}, {0xFAA6,0xA79,0x1}, {0xFAA7,0xA7A,0x1}, {0xFAA8,0xA7B,0x1},
+	{0xFAA9,0xA7C,0x1}, {0xFAAA,0xA7D,0x1}, {0xFAAB,0xA7E,0x1}, {0xFAAC,0xA7F,0x1}, {0xFAAD,0xA80,0x1}, {0xFAAE,0xA81,0x1},
+	{0xFAAF,0xA82,0x1}, {0xFAB0,0xA83,0x1}, {0xFAB1,0xA84,0x1}, {0xFAB2,0xA85,0x1}, {0xFAB3,0xA86,0x1}, {0xFAB4,0xA87,0x1},
+	{0xFAB5,0xA88,0x1}, {0xFAB6,0xA89,0x1}, {0xFAB7,0xA8A,0x1}, {0xFAB8,0xA8B,0x1}, {0xFAB9,0xA8C,0x1}, {0xFABA,0xA8D,0x1},
+	{0xFABB,0xA8E,0x1}, {0xFABC,0xA8F,0x1}, {0xFABD,0xA90,0x1}, {0xFABE,0xA91,0x1}, {0xFABF,0xA92,0x1}, {0xFAC0,0xA93,0x1},
+	{0xFAC1,0xA94,0x1}, {0xFAC2,0xA95,0x1}, {0xFAC3,0xA96,0x1}, {0xFAC4,0xA97,0x1}, {0xFAC5,0xA98,0x1}, {0xFAC6,0xA99,0x1},
+	{0xFAC7,0xA9A,0x1}, {0xFAC8,0xA9B,0x1}, {0xFAC9,0xA9C,0x1}, {0xFACA,0xA9D,0x1}, {0xFACB,0xA9E,0x1}, {0xFACC,0xA9F,0x1},
+	{0xFACD,0xAA0,0x1}, {0xFACE,0xAA1,0x1}, {0xFACF,0xAA2,0x1}, {0xFAD0,0xAA3,0x1}, {0xFAD1,0xAA4,0x1}, {0xFAD2,0xAA5,0x1},
+	{0xFAD3,0xAA6,0x1}, {0xFAD4,0xAA7,0x1}, {0xFAD5,0xAA8,0x1}, {0xFAD6,0xAA9,0x1}, {0xFAD7,0xAAA,0x1}, {0xFAD8,0xAAB,0x1},
+	{0xFAD9,0xAAC,0x1}, {0xFB1D,0xAAD,0x2}, {0xFB1F,0xAAF,0x2}, {0xFB2A,0xAB1,0x2}, {0xFB2B,0xAB3,0x2}, {0xFB2C,0xAB5,0x3},
+	{0xFB2D,0xAB8,0x3}, {0xFB2E,0xABB,0x2}, {0xFB2F,0xABD,0x2}, {0xFB30,0xABF,0x2}, {0xFB31,0xAC1,0x2}, {0xFB32,0xAC3,0x2},
+	{0xFB33,0xAC5,0x2}, {0xFB34,0xAC7,0x2}, {0xFB35,0xAC9,0x2}, {0xFB36,0xACB,0x2}, {0xFB38,0xACD,0x2}, {0xFB39,0xACF,0x2},
+	{0xFB3A,0xAD1,0x2}, {0xFB3B,0xAD3,0x2}, {0xFB3C,0xAD5,0x2}, {0xFB3E,0xAD7,0x2}, {0xFB40,0xAD9,0x2}, {0xFB41,0xADB,0x2},
+	{0xFB43,0xADD,0x2}, {0xFB44,0xADF,0x2}, {0xFB46,0xAE1,0x2}, {0xFB47,0xAE3,0x2}, {0xFB48,0xAE5,0x2}, {0xFB49,0xAE7,0x2},
+	{0xFB4A,0xAE9,0x2}, {0xFB4B,0xAEB,0x2}, {0xFB4C,0xAED,0x2}, {0xFB4D,0xAEF,0x2}, {0xFB4E,0xAF1,0x2}, {0x1109A,0xAF3,0x2},
+	{0x1109C,0xAF5,0x2}, {0x110AB,0xAF7,0x2}, {0x1112E,0xAF9,0x2}, {0x1112F,0xAFB,0x2}, {0x1134B,0xAFD,0x2}, {0x1134C,0xAFF,0x2},
+	{0x114BB,0xB01,0x2}, {0x114BC,0xB03,0x2}, {0x114BE,0xB05,0x2}, {0x115BA,0xB07,0x2}, {0x115BB,0xB09,0x2}, {0x11938,0xB0B,0x2},
+	{0x1D15E,0xB0D,0x2}, {0x1D15F,0xB0F,0x2}, {0x1D160,0xB11,0x3}, {0x1D161,0xB14,0x3}, {0x1D162,0xB17,0x3}, {0x1D163,0xB1A,0x3},
+	{0x1D164,0xB1D,0x3}, {0x1D1BB,0xB20,0x2}, {0x1D1BC,0xB22,0x2}, {0x1D1BD,0xB24,0x3}, {0x1D1BE,0xB27,0x3}, {0x1D1BF,0xB2A,0x3},
+	{0x1D1C0,0xB2D,0x3}, {0x2F800,0xB30,0x1}, {0x2F801,0xB31,0x1}, {0x2F802,0xB32,0x1}, {0x2F803,0xB33,0x1}, {0x2F804,0xB34,0x1},
+	{0x2F805,0xB35,0x1}, {0x2F806,0xB36,0x1}, {0x2F807,0xB37,0x1}, {0x2F808,0xB38,0x1}, {0x2F809,0xB39,0x1}, {0x2F80A,0xB3A,0x1},
+	{0x2F80B,0xB3B,0x1}, {0x2F80C,0xB3C,0x1}, {0x2F80D,0xB3D,0x1}, {0x2F80E,0xB3E,0x1}, {0x2F80F,0xB3F,0x1}, {0x2F810,0xB40,0x1},
+	{0x2F811,0xB41,0x1}, {0x2F812,0xB42,0x1}, {0x2F813,0xB43,0x1}, {0x2F814,0xB44,0x1}, {0x2F815,0xB45,0x1}, {0x2F816,0xB46,0x1},
+	{0x2F817,0xB47,0x1}, {0x2F818,0xB48,0x1}, {0x2F819,0xB49,0x1}, {0x2F81A,0xB4A,0x1}, {0x2F81B,0xB4B,0x1}, {0x2F81C,0xB4C,0x1},
+	{0x2F81D,0xB4D,0x1}, {0x2F81E,0xB4E,0x1}, {0x2F81F,0xB4F,0x1}, {0x2F820,0xB50,0x1}, {0x2F821,0xB51,0x1}, {0x2F822,0xB52,0x1},
+	{0x2F823,0xB53,0x1}, {0x2F824,0xB54,0x1}, {0x2F825,0xB55,0x1}, {0x2F826,0xB56,0x1}, {0x2F827,0xB57,0x1}, {0x2F828,0xB58,0x1},
+	{0x2F829,0xB59,0x1}, {0x2F82A,0xB5A,0x1}, {0x2F82B,0xB5B,0x1}, {0x2F82C,0xB5C,0x1}, {0x2F82D,0xB5D,0x1}, {0x2F82E,0xB5E,0x1},
+	{0x2F82F,0xB5F,0x1}, {0x2F830,0xB60,0x1}, {0x2F831,0xB61,0x1}, {0x2F832,0xB62,0x1}, {0x2F833,0xB63,0x1}, {0x2F834,0xB64,0x1},
+	{0x2F835,0xB65,0x1}, {0x2F836,0xB66,0x1}, {0x2F837,0xB67,0x1}, {0x2F838,0xB68,0x1}, {0x2F839,0xB69,0x1}, {0x2F83A,0xB6A,0x1},
+	{0x2F83B,0xB6B,0x1}, {0x2F83C,0xB6C,0x1}, {0x2F83D,0xB6D,0x1}, {0x2F83E,0xB6E,0x1}, {0x2F83F,0xB6F,0x1}, {0x2F840,0xB70,0x1},
+	{0x2F841,0xB71,0x1}, {0x2F842,0xB72,0x1}, {0x2F843,0xB73,0x1}, {0x2F844,0xB74,0x1}, {0x2F845,0xB75,0x1}, {0x2F846,0xB76,0x1},
+	{0x2F847,0xB77,0x1}, {0x2F848,0xB78,0x1}, {0x2F849,0xB79,0x1}, {0x2F84A,0xB7A,0x1}, {0x2F84B,0xB7B,0x1}, {0x2F84C,0xB7C,0x1},
+	{0x2F84D,0xB7D,0x1}, {0x2F84E,0xB7E,0x1}, {0x2F84F,0xB7F,0x1}, {0x2F850,0xB80,0x1}, {0x2F851,0xB81,0x1}, {0x2F852,0xB82,0x1},
+	{0x2F853,0xB83,0x1}, {0x2F854,0xB84,0x1}, {0x2F855,0xB85,0x1}, {0x2F856,0xB86,0x1}, {0x2F857,0xB87,0x1}, {0x2F858,0xB88,0x1},
+	{0x2F859,0xB89,0x1}, {0x2F85A,0xB8A,0x1}, {0x2F85B,0xB8B,0x1}, {0x2F85C,0xB8C,0x1}, {0x2F85D,0xB8D,0x1}, {0x2F85E,0xB8E,0x1},
+	{0x2F85F,0xB8F,0x1}, {0x2F860,0xB90,0x1}, {0x2F861,0xB91,0x1}, {0x2F862,0xB92,0x1}, {0x2F863,0xB93,0x1}, {0x2F864,0xB94,0x1},
+	{0x2F865,0xB95,0x1}, {0x2F866,0xB96,0x1}, {0x2F867,0xB97,0x1}, {0x2F868,0xB98,0x1}, {0x2F869,0xB99,0x1}, {0x2F86A,0xB9A,0x1},
+	{0x2F86B,0xB9B,0x1}, {0x2F86C,0xB9C,0x1}, {0x2F86D,0xB9D,0x1}, {0x2F86E,0xB9E,0x1}, {0x2F86F,0xB9F,0x1}, {0x2F870,0xBA0,0x1},
+	{0x2F871,0xBA1,0x1}, {0x2F872,0xBA2,0x1}, {0x2F873,0xBA3,0x1}, {0x2F874,0xBA4,0x1}, {0x2F875,0xBA5,0x1}, {0x2F876,0xBA6,0x1},
+	{0x2F877,0xBA7,0x1}, {0x2F878,0xBA8,0x1}, {0x2F879,0xBA9,0x1}, {0x2F87A,0xBAA,0x1}, {0x2F87B,0xBAB,0x1}, {0x2F87C,0xBAC,0x1},
+	{0x2F87D,0xBAD,0x1}, {0x2F87E,0xBAE,0x1}, {0x2F87F,0xBAF,0x1}, {0x2F880,0xBB0,0x1}, {0x2F881,0xBB1,0x1}, {0x2F882,0xBB2,0x1},
+	{0x2F883,0xBB3,0x1}, {0x2F884,0xBB4,0x1}, {0x2F885,0xBB5,0x1}, {0x2F886,0xBB6,0x1}, {0x2F887,0xBB7,0x1}, {0x2F888,0xBB8,0x1},
+	{0x2F889,0xBB9,0x1}, {0x2F88A,0xBBA,0x1}, {0x2F88B,0xBBB,0x1}, {0x2F88C,0xBBC,0x1}, {0x2F88D,0xBBD,0x1}, {0x2F88E,0xBBE,0x1},
+	{0x2F88F,0xBBF,0x1}, {0x2F890,0xBC0,0x1}, {0x2F891,0xBC1,0x1}, {0x2F892,0xBC2,0x1}, {0x2F893,0xBC3,0x1}, {0x2F894,0xBC4,0x1},
+	{0x2F895,0xBC5,0x1}, {0x2F896,0xBC6,0x1}, {0x2F897,0xBC7,0x1}, {0x2F898,0xBC8,0x1}, {0x2F899,0xBC9,0x1}, {0x2F89A,0xBCA,0x1},
+	{0x2F89B,0xBCB,0x1}, {0x2F89C,0xBCC,0x1}, {0x2F89D,0xBCD,0x1}, {0x2F89E,0xBCE,0x1}, {0x2F89F,0xBCF,0x1}, {0x2F8A0,0xBD0,0x1},
+	{0x2F8A1,0xBD1,0x1}, {0x2F8A2,0xBD2,0x1}, {0x2F8A3,0xBD3,0x1}, {0x2F8A4,0xBD4,0x1}, {0x2F8A5,0xBD5,0x1}, {0x2F8A6,0xBD6,0x1},
+	{0x2F8A7,0xBD7,0x1}, {0x2F8A8,0xBD8,0x1}, {0x2F8A9,0xBD9,0x1}, {0x2F8AA,0xBDA,0x1}, {0x2F8AB,0xBDB,0x1}, {0x2F8AC,0xBDC,0x1},
+	{0x2F8AD,0xBDD,0x1}, {0x2F8AE,0xBDE,0x1}, {0x2F8AF,0xBDF,0x1}, {0x2F8B0,0xBE0,0x1}, {0x2F8B1,0xBE1,0x1}, {0x2F8B2,0xBE2,0x1},
+	{0x2F8B3,0xBE3,0x1}, {0x2F8B4,0xBE4,0x1}, {0x2F8B5,0xBE5,0x1}, {0x2F8B6,0xBE6,0x1}, {0x2F8B7,0xBE7,0x1}, {0x2F8B8,0xBE8,0x1},
+	{0x2F8B9,0xBE9,0x1}, {0x2F8BA,0xBEA,0x1}, {0x2F8BB,0xBEB,0x1}, {0x2F8BC,0xBEC,0x1}, {0x2F8BD,0xBED,0x1}, {0x2F8BE,0xBEE,0x1},
+	{0x2F8BF,0xBEF,0x1}, {0x2F8C0,0xBF0,0x1}, {0x2F8C1,0xBF1,0x1}, {0x2F8C2,0xBF2,0x1}, {0x2F8C3,0xBF3,0x1}, {0x2F8C4,0xBF4,0x1},
+	{0x2F8C5,0xBF5,0x1}, {0x2F8C6,0xBF6,0x1}, {0x2F8C7,0xBF7,0x1}, {0x2F8C8,0xBF8,0x1}, {0x2F8C9,0xBF9,0x1}, {0x2F8CA,0xBFA,0x1},
+	{0x2F8CB,0xBFB,0x1}, {0x2F8CC,0xBFC,0x1}, {0x2F8CD,0xBFD,0x1}, {0x2F8CE,0xBFE,0x1}, {0x2F8CF,0xBFF,0x1}, {0x2F8D0,0xC00,0x1},
+	{0x2F8D1,0xC01,0x1}, {0x2F8D2,0xC02,0x1}, {0x2F8D3,0xC03,0x1}, {0x2F8D4,0xC04,0x1}, {0x2F8D5,0xC05,0x1}, {0x2F8D6,0xC06,0x1},
+	{0x2F8D7,0xC07,0x1}, {0x2F8D8,0xC08,0x1}, {0x2F8D9,0xC09,0x1}, {0x2F8DA,0xC0A,0x1}, {0x2F8DB,0xC0B,0x1}, {0x2F8DC,0xC0C,0x1},
+	{0x2F8DD,0xC0D,0x1}, {0x2F8DE,0xC0E,0x1}, {0x2F8DF,0xC0F,0x1}, {0x2F8E0,0xC10,0x1}, {0x2F8E1,0xC11,0x1}, {0x2F8E2,0xC12,0x1},
+	{0x2F8E3,0xC13,0x1}, {0x2F8E4,0xC14,0x1}, {0x2F8E5,0xC15,0x1}, {0x2F8E6,0xC16,0x1}, {0x2F8E7,0xC17,0x1}, {0x2F8E8,0xC18,0x1},
+	{0x2F8E9,0xC19,0x1}, {0x2F8EA,0xC1A,0x1}, {0x2F8EB,0xC1B,0x1}, {0x2F8EC,0xC1C,0x1}, {0x2F8ED,0xC1D,0x1}, {0x2F8EE,0xC1E,0x1},
+	{0x2F8EF,0xC1F,0x1}, {0x2F8F0,0xC20,0x1}, {0x2F8F1,0xC21,0x1}, {0x2F8F2,0xC22,0x1}, {0x2F8F3,0xC23,0x1}, {0x2F8F4,0xC24,0x1},
+	{0x2F8F5,0xC25,0x1}, {0x2F8F6,0xC26,0x1}, {0x2F8F7,0xC27,0x1}, {0x2F8F8,0xC28,0x1}, {0x2F8F9,0xC29,0x1}, {0x2F8FA,0xC2A,0x1},
+	{0x2F8FB,0xC2B,0x1}, {0x2F8FC,0xC2C,0x1}, {0x2F8FD,0xC2D,0x1}, {0x2F8FE,0xC2E,0x1}, {0x2F8FF,0xC2F,0x1}, {0x2F900,0xC30,0x1},
+	{0x2F901,0xC31,0x1}, {0x2F902,0xC32,0x1}, {0x2F903,0xC33,0x1}, {0x2F904,0xC34,0x1}, {0x2F905,0xC35,0x1}, {0x2F906,0xC36,0x1},
+	{0x2F907,0xC37,0x1}, {0x2F908,0xC38,0x1}, {0x2F909,0xC39,0x1}, {0x2F90A,0xC3A,0x1}, {0x2F90B,0xC3B,0x1}, {0x2F90C,0xC3C,0x1},
+	{0x2F90D,0xC3D,0x1}, {0x2F90E,0xC3E,0x1}, {0x2F90F,0xC3F,0x1}, {0x2F910,0xC40,0x1}, {0x2F911,0xC41,0x1}, {0x2F912,0xC42,0x1},
+	{0x2F913,0xC43,0x1}, {0x2F914,0xC44,0x1}, {0x2F915,0xC45,0x1}, {0x2F916,0xC46,0x1}, {0x2F917,0xC47,0x1}, {0x2F918,0xC48,0x1},
+	{0x2F919,0xC49,0x1}, {0x2F91A,0xC4A,0x1}, {0x2F91B,0xC4B,0x1}, {0x2F91C,0xC4C,0x1}, {0x2F91D,0xC4D,0x1}, {0x2F91E,0xC4E,0x1},
+	{0x2F91F,0xC4F,0x1}, {0x2F920,0xC50,0x1}, {0x2F921,0xC51,0x1}, {0x2F922,0xC52,0x1}, {0x2F923,0xC53,0x1}, {0x2F924,0xC54,0x1},
+	{0x2F925,0xC55,0x1}, {0x2F926,0xC56,0x1}, {0x2F927,0xC57,0x1}, {0x2F928,0xC58,0x1}, {0x2F929,0xC59,0x1}, {0x2F92A,0xC5A,0x1},
+	{0x2F92B,0xC5B,0x1}, {0x2F92C,0xC5C,0x1}, {0x2F92D,0xC5D,0x1}, {0x2F92E,0xC5E,0x1}, {0x2F92F,0xC5F,0x1}, {0x2F930,0xC60,0x1},
+	{0x2F931,0xC61,0x1}, {0x2F932,0xC62,0x1}, {0x2F933,0xC63,0x1}, {0x2F934,0xC64,0x1}, {0x2F935,0xC65,0x1}, {0x2F936,0xC66,0x1},
+	{0x2F937,0xC67,0x1}, {0x2F938,0xC68,0x1}, {0x2F939,0xC69,0x1}, {0x2F93A,0xC6A,0x1}, {0x2F93B,0xC6B,0x1}, {0x2F93C,0xC6C,0x1},
+	{0x2F93D,0xC6D,0x1}, {0x2F93E,0xC6E,0x1}, {0x2F93F,0xC6F,0x1}, {0x2F940,0xC70,0x1}, {0x2F941,0xC71,0x1}, {0x2F942,0xC72,0x1},
+	{0x2F943,0xC73,0x1}, {0x2F944,0xC74,0x1}, {0x2F945,0xC75,0x1}, {0x2F946,0xC76,0x1}, {0x2F947,0xC77,0x1}, {0x2F948,0xC78,0x1},
+	{0x2F949,0xC79,0x1}, {0x2F94A,0xC7A,0x1}, {0x2F94B,0xC7B,0x1}, {0x2F94C,0xC7C,0x1}, {0x2F94D,0xC7D,0x1}, {0x2F94E,0xC7E,0x1},
+	{0x2F94F,0xC7F,0x1}, {0x2F950,0xC80,0x1}, {0x2F951,0xC81,0x1}, {0x2F952,0xC82,0x1}, {0x2F953,0xC83,0x1}, {0x2F954,0xC84,0x1},
+	{0x2F955,0xC85,0x1}, {0x2F956,0xC86,0x1}, {0x2F957,0xC87,0x1}, {0x2F958,0xC88,0x1}, {0x2F959,0xC89,0x1}, {0x2F95A,0xC8A,0x1},
+	{0x2F95B,0xC8B,0x1}, {0x2F95C,0xC8C,0x1}, {0x2F95D,0xC8D,0x1}, {0x2F95E,0xC8E,0x1}, {0x2F95F,0xC8F,0x1}, {0x2F960,0xC90,0x1},
+	{0x2F961,0xC91,0x1}, {0x2F962,0xC92,0x1}, {0x2F963,0xC93,0x1}, {0x2F964,0xC94,0x1}, {0x2F965,0xC95,0x1}, {0x2F966,0xC96,0x1},
+	{0x2F967,0xC97,0x1}, {0x2F968,0xC98,0x1}, {0x2F969,0xC99,0x1}, {0x2F96A,0xC9A,0x1}, {0x2F96B,0xC9B,0x1}, {0x2F96C,0xC9C,0x1},
+	{0x2F96D,0xC9D,0x1}, {0x2F96E,0xC9E,0x1}, {0x2F96F,0xC9F,0x1}, {0x2F970,0xCA0,0x1}, {0x2F971,0xCA1,0x1}, {0x2F972,0xCA2,0x1},
+	{0x2F973,0xCA3,0x1}, {0x2F974,0xCA4,0x1}, {0x2F975,0xCA5,0x1}, {0x2F976,0xCA6,0x1}, {0x2F977,0xCA7,0x1}, {0x2F978,0xCA8,0x1},
+	{0x2F979,0xCA9,0x1}, {0x2F97A,0xCAA,0x1}, {0x2F97B,0xCAB,0x1}, {0x2F97C,0xCAC,0x1}, {0x2F97D,0xCAD,0x1}, {0x2F97E,0xCAE,0x1},
+	{0x2F97F,0xCAF,0x1}, {0x2F980,0xCB0,0x1}, {0x2F981,0xCB1,0x1}, {0x2F982,0xCB2,0x1}, {0x2F983,0xCB3,0x1}, {0x2F984,0xCB4,0x1},
+	{0x2F985,0xCB5,0x1}, {0x2F986,0xCB6,0x1}, {0x2F987,0xCB7,0x1}, {0x2F988,0xCB8,0x1}, {0x2F989,0xCB9,0x1}, {0x2F98A,0xCBA,0x1},
+	{0x2F98B,0xCBB,0x1}, {0x2F98C,0xCBC,0x1}, {0x2F98D,0xCBD,0x1}, {0x2F98E,0xCBE,0x1}, {0x2F98F,0xCBF,0x1}, {0x2F990,0xCC0,0x1},
+	{0x2F991,0xCC1,0x1}, {0x2F992,0xCC2,0x1}, {0x2F993,0xCC3,0x1}, {0x2F994,0xCC4,0x1}, {0x2F995,0xCC5,0x1}, {0x2F996,0xCC6,0x1},
+	{0x2F997,0xCC7,0x1}, {0x2F998,0xCC8,0x1}, {0x2F999,0xCC9,0x1}, {0x2F99A,0xCCA,0x1}, {0x2F99B,0xCCB,0x1}, {0x2F99C,0xCCC,0x1},
+	{0x2F99D,0xCCD,0x1}, {0x2F99E,0xCCE,0x1}, {0x2F99F,0xCCF,0x1}, {0x2F9A0,0xCD0,0x1}, {0x2F9A1,0xCD1,0x1}, {0x2F9A2,0xCD2,0x1},
+	{0x2F9A3,0xCD3,0x1}, {0x2F9A4,0xCD4,0x1}, {0x2F9A5,0xCD5,0x1}, {0x2F9A6,0xCD6,0x1}, {0x2F9A7,0xCD7,0x1}, {0x2F9A8,0xCD8,0x1},
+	{0x2F9A9,0xCD9,0x1}, {0x2F9AA,0xCDA,0x1}, {0x2F9AB,0xCDB,0x1}, {0x2F9AC,0xCDC,0x1}, {0x2F9AD,0xCDD,0x1}, {0x2F9AE,0xCDE,0x1},
+	{0x2F9AF,0xCDF,0x1}, {0x2F9B0,0xCE0,0x1}, {0x2F9B1,0xCE1,0x1}, {0x2F9B2,0xCE2,0x1}, {0x2F9B3,0xCE3,0x1}, {0x2F9B4,0xCE4,0x1},
+	{0x2F9B5,0xCE5,0x1}, {0x2F9B6,0xCE6,0x1}, {0x2F9B7,0xCE7,0x1}, {0x2F9B8,0xCE8,0x1}, {0x2F9B9,0xCE9,0x1}, {0x2F9BA,0xCEA,0x1},
+	{0x2F9BB,0xCEB,0x1}, {0x2F9BC,0xCEC,0x1}, {0x2F9BD,0xCED,0x1}, {0x2F9BE,0xCEE,0x1}, {0x2F9BF,0xCEF,0x1}, {0x2F9C0,0xCF0,0x1},
+	{0x2F9C1,0xCF1,0x1}, {0x2F9C2,0xCF2,0x1}, {0x2F9C3,0xCF3,0x1}, {0x2F9C4,0xCF4,0x1}, {0x2F9C5,0xCF5,0x1}, {0x2F9C6,0xCF6,0x1},
+	{0x2F9C7,0xCF7,0x1}, {0x2F9C8,0xCF8,0x1}, {0x2F9C9,0xCF9,0x1}, {0x2F9CA,0xCFA,0x1}, {0x2F9CB,0xCFB,0x1}, {0x2F9CC,0xCFC,0x1},
+	{0x2F9CD,0xCFD,0x1}, {0x2F9CE,0xCFE,0x1}, {0x2F9CF,0xCFF,0x1}, {0x2F9D0,0xD00,0x1}, {0x2F9D1,0xD01,0x1}, {0x2F9D2,0xD02,0x1},
+	{0x2F9D3,0xD03,0x1}, {0x2F9D4,0xD04,0x1}, {0x2F9D5,0xD05,0x1}, {0x2F9D6,0xD06,0x1}, {0x2F9D7,0xD07,0x1}, {0x2F9D8,0xD08,0x1},
+	{0x2F9D9,0xD09,0x1}, {0x2F9DA,0xD0A,0x1}, {0x2F9DB,0xD0B,0x1}, {0x2F9DC,0xD0C,0x1}, {0x2F9DD,0xD0D,0x1}, {0x2F9DE,0xD0E,0x1},
+	{0x2F9DF,0xD0F,0x1}, {0x2F9E0,0xD10,0x1}, {0x2F9E1,0xD11,0x1}, {0x2F9E2,0xD12,0x1}, {0x2F9E3,0xD13,0x1}, {0x2F9E4,0xD14,0x1},
+	{0x2F9E5,0xD15,0x1}, {0x2F9E6,0xD16,0x1}, {0x2F9E7,0xD17,0x1}, {0x2F9E8,0xD18,0x1}, {0x2F9E9,0xD19,0x1}, {0x2F9EA,0xD1A,0x1},
+	{0x2F9EB,0xD1B,0x1}, {0x2F9EC,0xD1C,0x1}, {0x2F9ED,0xD1D,0x1}, {0x2F9EE,0xD1E,0x1}, {0x2F9EF,0xD1F,0x1}, {0x2F9F0,0xD20,0x1},
+	{0x2F9F1,0xD21,0x1}, {0x2F9F2,0xD22,0x1}, {0x2F9F3,0xD23,0x1}, {0x2F9F4,0xD24,0x1}, {0x2F9F5,0xD25,0x1}, {0x2F9F6,0xD26,0x1},
+	{0x2F9F7,0xD27,0x1}, {0x2F9F8,0xD28,0x1}, {0x2F9F9,0xD29,0x1}, {0x2F9FA,0xD2A,0x1}, {0x2F9FB,0xD2B,0x1}, {0x2F9FC,0xD2C,0x1},
+	{0x2F9FD,0xD2D,0x1}, {0x2F9FE,0xD2E,0x1}, {0x2F9FF,0xD2F,0x1}, {0x2FA00,0xD30,0x1}, {0x2FA01,0xD31,0x1}, {0x2FA02,0xD32,0x1},
+	{0x2FA03,0xD33,0x1}, {0x2FA04,0xD34,0x1}, {0x2FA05,0xD35,0x1}, {0x2FA06,0xD36,0x1}, {0x2FA07,0xD37,0x1}, {0x2FA08,0xD38,0x1},
+	{0x2FA09,0xD39,0x1}, {0x2FA0A,0xD3A,0x1}, {0x2FA0B,0xD3B,0x1}, {0x2FA0C,0xD3C,0x1}, {0x2FA0D,0xD3D,0x1}, {0x2FA0E,0xD3E,0x1},
+	{0x2FA0F,0xD3F,0x1}, {0x2FA10,0xD40,0x1}, {0x2FA11,0xD41,0x1}, {0x2FA12,0xD42,0x1}, {0x2FA13,0xD43,0x1}, {0x2FA14,0xD44,0x1},
+	{0x2FA15,0xD45,0x1}, {0x2FA16,0xD46,0x1}, {0x2FA17,0xD47,0x1}, {0x2FA18,0xD48,0x1}, {0x2FA19,0xD49,0x1}, {0x2FA1A,0xD4A,0x1},
+	{0x2FA1B,0xD4B,0x1}, {0x2FA1C,0xD4C,0x1}, {0x2FA1D,0xD4D,0x1},
+};
+static const unsigned int DECOMP_DATA[] = {
+	0x41,0x300,0x41,0x301,0x41,0x302,0x41,0x303,0x41,0x308,0x41,0x30A,
+	0x43,0x327,0x45,0x300,0x45,0x301,0x45,0x302,0x45,0x308,0x49,0x300,
+	0x49,0x301,0x49,0x302,0x49,0x308,0x4E,0x303,0x4F,0x300,0x4F,0x301,
+	0x4F,0x302,0x4F,0x303,0x4F,0x308,0x55,0x300,0x55,0x301,0x55,0x302,
+	0x55,0x308,0x59,0x301,0x61,0x300,0x61,0x301,0x61,0x302,0x61,0x303,
+	0x61,0x308,0x61,0x30A,0x63,0x327,0x65,0x300,0x65,0x301,0x65,0x302,
+	0x65,0x308,0x69,0x300,0x69,0x301,0x69,0x302,0x69,0x308,0x6E,0x303,
+	0x6F,0x300,0x6F,0x301,0x6F,0x302,0x6F,0x303,0x6F,0x308,0x75,0x300,
+	0x75,0x301,0x75,0x302,0x75,0x308,0x79,0x301,0x79,0x308,0x41,0x304,
+	0x61,0x304,0x41,0x306,0x61,0x306,0x41,0x328,0x61,0x328,0x43,0x301,
+	0x63,0x301,0x43,0x302,0x63,0x302,0x43,0x307,0x63,0x307,0x43,0x30C,
+	0x63,0x30C,0x44,0x30C,0x64,0x30C,0x45,0x304,0x65,0x304,0x45,0x306,
+	0x65,0x306,0x45,0x307,0x65,0x307,0x45,0x328,0x65,0x328,0x45,0x30C,
+	0x65,0x30C,0x47,0x302,0x67,0x302,0x47,0x306,0x67,0x306,0x47,0x307,
+	0x67,0x307,0x47,0x327,0x67,0x327,0x48,0x302,0x68,0x302,0x49,0x303,
+	0x69,0x303,0x49,0x304,0x69,0x304,0x49,0x306,0x69,0x306,0x49,0x328,
+	0x69,0x328,0x49,0x307,0x4A,0x302,0x6A,0x302,0x4B,0x327,0x6B,0x327,
+	0x4C,0x301,0x6C,0x301,0x4C,0x327,0x6C,0x327,0x4C,0x30C,0x6C,0x30C,
+	0x4E,0x301,0x6E,0x301,0x4E,0x327,0x6E,0x327,0x4E,0x30C,0x6E,0x30C,
+	0x4F,0x304,0x6F,0x304,0x4F,0x306,0x6F,0x306,0x4F,0x30B,0x6F,0x30B,
+	0x52,0x301,0x72,0x301,0x52,0x327,0x72,0x327,0x52,0x30C,0x72,0x30C,
+	0x53,0x301,0x73,0x301,0x53,0x302,0x73,0x302,0x53,0x327,0x73,0x327,
+	0x53,0x30C,0x73,0x30C,0x54,0x327,0x74,0x327,0x54,0x30C,0x74,0x30C,
+	0x55,0x303,0x75,0x303,0x55,0x304,0x75,0x304,0x55,0x306,0x75,0x306,
+	0x55,0x30A,0x75,0x30A,0x55,0x30B,0x75,0x30B,0x55,0x328,0x75,0x328,
+	0x57,0x302,0x77,0x302,0x59,0x302,0x79,0x302,0x59,0x308,0x5A,0x301,
+	0x7A,0x301,0x5A,0x307,0x7A,0x307,0x5A,0x30C,0x7A,0x30C,0x4F,0x31B,
+	0x6F,0x31B,0x55,0x31B,0x75,0x31B,0x41,0x30C,0x61,0x30C,0x49,0x30C,
+	0x69,0x30C,0x4F,0x30C,0x6F,0x30C,0x55,0x30C,0x75,0x30C,0x55,0x308,
+	0x304,0x75,0x308,0x304,0x55,0x308,0x301,0x75,0x308,0x301,0x55,0x308,
+	0x30C,0x75,0x308,0x30C,0x55,0x308,0x300,0x75,0x308,0x300,0x41,0x308,
+	0x304,0x61,0x308,0x304,0x41,0x307,0x304,0x61,0x307,0x304,0xC6,0x304,
+	0xE6,0x304,0x47,0x30C,0x67,0x30C,0x4B,0x30C,0x6B,0x30C,0x4F,0x328,
+	0x6F,0x328,0x4F,0x328,0x304,0x6F,0x328,0x304,0x1B7,0x30C,0x292,0x30C,
+	0x6A,0x30C,0x47,0x301,0x67,0x301,0x4E,0x300,0x6E,0x300,0x41,0x30A,
+	0x301,0x61,0x30A,0x301,0xC6,0x301,0xE6,0x301,0xD8,0x301,0xF8,0x301,
+	0x41,0x30F,0x61,0x30F,0x41,0x311,0x61,0x311,0x45,0x30F,0x65,0x30F,
+	0x45,0x311,0x65,0x311,0x49,0x30F,0x69,0x30F,0x49,0x311,0x69,0x311,
+	0x4F,0x30F,0x6F,0x30F,0x4F,0x311,0x6F,0x311,0x52,0x30F,0x72,0x30F,
+	0x52,0x311,0x72,0x311,0x55,0x30F,0x75,0x30F,0x55,0x311,0x75,0x311,
+	0x53,0x326,0x73,0x326,0x54,0x326,0x74,0x326,0x48,0x30C,0x68,0x30C,
+	0x41,0x307,0x61,0x307,0x45,0x327,0x65,0x327,0x4F,0x308,0x304,0x6F,
+	0x308,0x304,0x4F,0x303,0x304,0x6F,0x303,0x304,0x4F,0x307,0x6F,0x307,
+	0x4F,0x307,0x304,0x6F,0x307,0x304,0x59,0x304,0x79,0x304,0x300,0x301,
+	0x313,0x308,0x301,0x2B9,0x3B,0xA8,0x301,0x391,0x301,0xB7,0x395,0x301,
+	0x397,0x301,0x399,0x301,0x39F,0x301,0x3A5,0x301,0x3A9,0x301,0x3B9,0x308,
+	0x301,0x399,0x308,0x3A5,0x308,0x3B1,0x301,0x3B5,0x301,0x3B7,0x301,0x3B9,
+	0x301,0x3C5,0x308,0x301,0x3B9,0x308,0x3C5,0x308,0x3BF,0x301,0x3C5,0x301,
+	0x3C9,0x301,0x3D2,0x301,0x3D2,0x308,0x415,0x300,0x415,0x308,0x413,0x301,
+	0x406,0x308,0x41A,0x301,0x418,0x300,0x423,0x306,0x418,0x306,0x438,0x306,
+	0x435,0x300,0x435,0x308,0x433,0x301,0x456,0x308,0x43A,0x301,0x438,0x300,
+	0x443,0x306,0x474,0x30F,0x475,0x30F,0x416,0x306,0x436,0x306,0x410,0x306,
+	0x430,0x306,0x410,0x308,0x430,0x308,0x415,0x306,0x435,0x306,0x4D8,0x308,
+	0x4D9,0x308,0x416,0x308,0x436,0x308,0x417,0x308,0x437,0x308,0x418,0x304,
+	0x438,0x304,0x418,0x308,0x438,0x308,0x41E,0x308,0x43E,0x308,0x4E8,0x308,
+	0x4E9,0x308,0x42D,0x308,0x44D,0x308,0x423,0x304,0x443,0x304,0x423,0x308,
+	0x443,0x308,0x423,0x30B,0x443,0x30B,0x427,0x308,0x447,0x308,0x42B,0x308,
+	0x44B,0x308,0x627,0x653,0x627,0x654,0x648,0x654,0x627,0x655,0x64A,0x654,
+	0x6D5,0x654,0x6C1,0x654,0x6D2,0x654,0x928,0x93C,0x930,0x93C,0x933,0x93C,
+	0x915,0x93C,0x916,0x93C,0x917,0x93C,0x91C,0x93C,0x921,0x93C,0x922,0x93C,
+	0x92B,0x93C,0x92F,0x93C,0x9C7,0x9BE,0x9C7,0x9D7,0x9A1,0x9BC,0x9A2,0x9BC,
+	0x9AF,0x9BC,0xA32,0xA3C,0xA38,0xA3C,0xA16,0xA3C,0xA17,0xA3C,0xA1C,0xA3C,
+	0xA2B,0xA3C,0xB47,0xB56,0xB47,0xB3E,0xB47,0xB57,0xB21,0xB3C,0xB22,0xB3C,
+	0xB92,0xBD7,0xBC6,0xBBE,0xBC7,0xBBE,0xBC6,0xBD7,0xC46,0xC56,0xCBF,0xCD5,
+	0xCC6,0xCD5,0xCC6,0xCD6,0xCC6,0xCC2,0xCC6,0xCC2,0xCD5,0xD46,0xD3E,0xD47,
+	0xD3E,0xD46,0xD57,0xDD9,0xDCA,0xDD9,0xDCF,0xDD9,0xDCF,0xDCA,0xDD9,0xDDF,
+	0xF42,0xFB7,0xF4C,0xFB7,0xF51,0xFB7,0xF56,0xFB7,0xF5B,0xFB7,0xF40,0xFB5,
+	0xF71,0xF72,0xF71,0xF74,0xFB2,0xF80,0xFB3,0xF80,0xF71,0xF80,0xF92,0xFB7,
+	0xF9C,0xFB7,0xFA1,0xFB7,0xFA6,0xFB7,0xFAB,0xFB7,0xF90,0xFB5,0x1025,0x102E,
+	0x1B05,0x1B35,0x1B07,0x1B35,0x1B09,0x1B35,0x1B0B,0x1B35,0x1B0D,0x1B35,0x1B11,0x1B35,
+	0x1B3A,0x1B35,0x1B3C,0x1B35,0x1B3E,0x1B35,0x1B3F,0x1B35,0x1B42,0x1B35,0x41,0x325,
+	0x61,0x325,0x42,0x307,0x62,0x307,0x42,0x323,0x62,0x323,0x42,0x331,
+	0x62,0x331,0x43,0x327,0x301,0x63,0x327,0x301,0x44,0x307,0x64,0x307,
+	0x44,0x323,0x64,0x323,0x44,0x331,0x64,0x331,0x44,0x327,0x64,0x327,
+	0x44,0x32D,0x64,0x32D,0x45,0x304,0x300,0x65,0x304,0x300,0x45,0x304,
+	0x301,0x65,0x304,0x301,0x45,0x32D,0x65,0x32D,0x45,0x330,0x65,0x330,
+	0x45,0x327,0x306,0x65,0x327,0x306,0x46,0x307,0x66,0x307,0x47,0x304,
+	0x67,0x304,0x48,0x307,0x68,0x307,0x48,0x323,0x68,0x323,0x48,0x308,
+	0x68,0x308,0x48,0x327,0x68,0x327,0x48,0x32E,0x68,0x32E,0x49,0x330,
+	0x69,0x330,0x49,0x308,0x301,0x69,0x308,0x301,0x4B,0x301,0x6B,0x301,
+	0x4B,0x323,0x6B,0x323,0x4B,0x331,0x6B,0x331,0x4C,0x323,0x6C,0x323,
+	0x4C,0x323,0x304,0x6C,0x323,0x304,0x4C,0x331,0x6C,0x331,0x4C,0x32D,
+	0x6C,0x32D,0x4D,0x301,0x6D,0x301,0x4D,0x307,0x6D,0x307,0x4D,0x323,
+	0x6D,0x323,0x4E,0x307,0x6E,0x307,0x4E,0x323,0x6E,0x323,0x4E,0x331,
+	0x6E,0x331,0x4E,0x32D,0x6E,0x32D,0x4F,0x303,0x301,0x6F,0x303,0x301,
+	0x4F,0x303,0x308,0x6F,0x303,0x308,0x4F,0x304,0x300,0x6F,0x304,0x300,
+	0x4F,0x304,0x301,0x6F,0x304,0x301,0x50,0x301,0x70,0x301,0x50,0x307,
+	0x70,0x307,0x52,0x307,0x72,0x307,0x52,0x323,0x72,0x323,0x52,0x323,
+	0x304,0x72,0x323,0x304,0x52,0x331,0x72,0x331,0x53,0x307,0x73,0x307,
+	0x53,0x323,0x73,0x323,0x53,0x301,0x307,0x73,0x301,0x307,0x53,0x30C,
+	0x307,0x73,0x30C,0x307,0x53,0x323,0x307,0x73,0x323,0x307,0x54,0x307,
+	0x74,0x307,0x54,0x323,0x74,0x323,0x54,0x331,0x74,0x331,0x54,0x32D,
+	0x74,0x32D,0x55,0x324,0x75,0x324,0x55,0x330,0x75,0x330,0x55,0x32D,
+	0x75,0x32D,0x55,0x303,0x301,0x75,0x303,0x301,0x55,0x304,0x308,0x75,
+	0x304,0x308,0x56,0x303,0x76,0x303,0x56,0x323,0x76,0x323,0x57,0x300,
+	0x77,0x300,0x57,0x301,0x77,0x301,0x57,0x308,0x77,0x308,0x57,0x307,
+	0x77,0x307,0x57,0x323,0x77,0x323,0x58,0x307,0x78,0x307,0x58,0x308,
+	0x78,0x308,0x59,0x307,0x79,0x307,0x5A,0x302,0x7A,0x302,0x5A,0x323,
+	0x7A,0x323,0x5A,0x331,0x7A,0x331,0x68,0x331,0x74,0x308,0x77,0x30A,
+	0x79,0x30A,0x17F,0x307,0x41,0x323,0x61,0x323,0x41,0x309,0x61,0x309,
+	0x41,0x302,0x301,0x61,0x302,0x301,0x41,0x302,0x300,0x61,0x302,0x300,
+	0x41,0x302,0x309,0x61,0x302,0x309,0x41,0x302,0x303,0x61,0x302,0x303,
+	0x41,0x323,0x302,0x61,0x323,0x302,0x41,0x306,0x301,0x61,0x306,0x301,
+	0x41,0x306,0x300,0x61,0x306,0x300,0x41,0x306,0x309,0x61,0x306,0x309,
+	0x41,0x306,0x303,0x61,0x306,0x303,0x41,0x323,0x306,0x61,0x323,0x306,
+	0x45,0x323,0x65,0x323,0x45,0x309,0x65,0x309,0x45,0x303,0x65,0x303,
+	0x45,0x302,0x301,0x65,0x302,0x301,0x45,0x302,0x300,0x65,0x302,0x300,
+	0x45,0x302,0x309,0x65,0x302,0x309,0x45,0x302,0x303,0x65,0x302,0x303,
+	0x45,0x323,0x302,0x65,0x323,0x302,0x49,0x309,0x69,0x309,0x49,0x323,
+	0x69,0x323,0x4F,0x323,0x6F,0x323,0x4F,0x309,0x6F,0x309,0x4F,0x302,
+	0x301,0x6F,0x302,0x301,0x4F,0x302,0x300,0x6F,0x302,0x300,0x4F,0x302,
+	0x309,0x6F,0x302,0x309,0x4F,0x302,0x303,0x6F,0x302,0x303,0x4F,0x323,
+	0x302,0x6F,0x323,0x302,0x4F,0x31B,0x301,0x6F,0x31B,0x301,0x4F,0x31B,
+	0x300,0x6F,0x31B,0x300,0x4F,0x31B,0x309,0x6F,0x31B,0x309,0x4F,0x31B,
+	0x303,0x6F,0x31B,0x303,0x4F,0x31B,0x323,0x6F,0x31B,0x323,0x55,0x323,
+	0x75,0x323,0x55,0x309,0x75,0x309,0x55,0x31B,0x301,0x75,0x31B,0x301,
+	0x55,0x31B,0x300,0x75,0x31B,0x300,0x55,0x31B,0x309,0x75,0x31B,0x309,
+	0x55,0x31B,0x303,0x75,0x31B,0x303,0x55,0x31B,0x323,0x75,0x31B,0x323,
+	0x59,0x300,0x79,0x300,0x59,0x323,0x79,0x323,0x59,0x309,0x79,0x309,
+	0x59,0x303,0x79,0x303,0x3B1,0x313,0x3B1,0x314,0x3B1,0x313,0x300,0x3B1,
+	0x314,0x300,0x3B1,0x313,0x301,0x3B1,0x314,0x301,0x3B1,0x313,0x342,0x3B1,
+	0x314,0x342,0x391,0x313,0x391,0x314,0x391,0x313,0x300,0x391,0x314,0x300,
+	0x391,0x313,0x301,0x391,0x314,0x301,0x391,0x313,0x342,0x391,0x314,0x342,
+	0x3B5,0x313,0x3B5,0x314,0x3B5,0x313,0x300,0x3B5,0x314,0x300,0x3B5,0x313,
+	0x301,0x3B5,0x314,0x301,0x395,0x313,0x395,0x314,0x395,0x313,0x300,0x395,
+	0x314,0x300,0x395,0x313,0x301,0x395,0x314,0x301,0x3B7,0x313,0x3B7,0x314,
+	0x3B7,0x313,0x300,0x3B7,0x314,0x300,0x3B7,0x313,0x301,0x3B7,0x314,0x301,
+	0x3B7,0x313,0x342,0x3B7,0x314,0x342,0x397,0x313,0x397,0x314,0x397,0x313,
+	0x300,0x397,0x314,0x300,0x397,0x313,0x301,0x397,0x314,0x301,0x397,0x313,
+	0x342,0x397,0x314,0x342,0x3B9,0x313,0x3B9,0x314,0x3B9,0x313,0x300,0x3B9,
+	0x314,0x300,0x3B9,0x313,0x301,0x3B9,0x314,0x301,0x3B9,0x313,0x342,0x3B9,
+	0x314,0x342,0x399,0x313,0x399,0x314,0x399,0x313,0x300,0x399,0x314,0x300,
+	0x399,0x313,0x301,0x399,0x314,0x301,0x399,0x313,0x342,0x399,0x314,0x342,
+	0x3BF,0x313,0x3BF,0x314,0x3BF,0x313,0x300,0x3BF,0x314,0x300,0x3BF,0x313,
+	0x301,0x3BF,0x314,0x301,0x39F,0x313,0x39F,0x314,0x39F,0x313,0x300,0x39F,
+	0x314,0x300,0x39F,0x313,0x301,0x39F,0x314,0x301,0x3C5,0x313,0x3C5,0x314,
+	0x3C5,0x313,0x300,0x3C5,0x314,0x300,0x3C5,0x313,0x301,0x3C5,0x314,0x301,
+	0x3C5,0x313,0x342,0x3C5,0x314,0x342,0x3A5,0x314,0x3A5,0x314,0x300,0x3A5,
+	0x314,0x301,0x3A5,0x314,0x342,0x3C9,0x313,0x3C9,0x314,0x3C9,0x313,0x300,
+	0x3C9,0x314,0x300,0x3C9,0x313,0x301,0x3C9,0x314,0x301,0x3C9,0x313,0x342,
+	0x3C9,0x314,0x342,0x3A9,0x313,0x3A9,0x314,0x3A9,0x313,0x300,0x3A9,0x314,
+	0x300,0x3A9,0x313,0x301,0x3A9,0x314,0x301,0x3A9,0x313,0x342,0x3A9,0x314,
+	0x342,0x3B1,0x300,0x3B1,0x301,0x3B5,0x300,0x3B5,0x301,0x3B7,0x300,0x3B7,
+	0x301,0x3B9,0x300,0x3B9,0x301,0x3BF,0x300,0x3BF,0x301,0x3C5,0x300,0x3C5,
+	0x301,0x3C9,0x300,0x3C9,0x301,0x3B1,0x313,0x345,0x3B1,0x314,0x345,0x3B1,
+	0x313,0x300,0x345,0x3B1,0x314,0x300,0x345,0x3B1,0x313,0x301,0x345,0x3B1,
+	0x314,0x301,0x345,0x3B1,0x313,0x342,0x345,0x3B1,0x314,0x342,0x345,0x391,
+	0x313,0x345,0x391,0x314,0x345,0x391,0x313,0x300,0x345,0x391,0x314,0x300,
+	0x345,0x391,0x313,0x301,0x345,0x391,0x314,0x301,0x345,0x391,0x313,0x342,
+	0x345,0x391,0x314,0x342,0x345,0x3B7,0x313,0x345,0x3B7,0x314,0x345,0x3B7,
+	0x313,0x300,0x345,0x3B7,0x314,0x300,0x345,0x3B7,0x313,0x301,0x345,0x3B7,
+	0x314,0x301,0x345,0x3B7,0x313,0x342,0x345,0x3B7,0x314,0x342,0x345,0x397,
+	0x313,0x345,0x397,0x314,0x345,0x397,0x313,0x300,0x345,0x397,0x314,0x300,
+	0x345,0x397,0x313,0x301,0x345,0x397,0x314,0x301,0x345,0x397,0x313,0x342,
+	0x345,0x397,0x314,0x342,0x345,0x3C9,0x313,0x345,0x3C9,0x314,0x345,0x3C9,
+	0x313,0x300,0x345,0x3C9,0x314,0x300,0x345,0x3C9,0x313,0x301,0x345,0x3C9,
+	0x314,0x301,0x345,0x3C9,0x313,0x342,0x345,0x3C9,0x314,0x342,0x345,0x3A9,
+	0x313,0x345,0x3A9,0x314,0x345,0x3A9,0x313,0x300,0x345,0x3A9,0x314,0x300,
+	0x345,0x3A9,0x313,0x301,0x345,0x3A9,0x314,0x301,0x345,0x3A9,0x313,0x342,
+	0x345,0x3A9,0x314,0x342,0x345,0x3B1,0x306,0x3B1,0x304,0x3B1,0x300,0x345,
+	0x3B1,0x345,0x3B1,0x301,0x345,0x3B1,0x342,0x3B1,0x342,0x345,0x391,0x306,
+	0x391,0x304,0x391,0x300,0x391,0x301,0x391,0x345,0x3B9,0xA8,0x342,0x3B7,
+	0x300,0x345,0x3B7,0x345,0x3B7,0x301,0x345,0x3B7,0x342,0x3B7,0x342,0x345,
+	0x395,0x300,0x395,0x301,0x397,0x300,0x397,0x301,0x397,0x345,0x1FBF,0x300,
+	0x1FBF,0x301,0x1FBF,0x342,0x3B9,0x306,0x3B9,0x304,0x3B9,0x308,0x300,0x3B9,
+	0x308,0x301,0x3B9,0x342,0x3B9,0x308,0x342,0x399,0x306,0x399,0x304,0x399,
+	0x300,0x399,0x301,0x1FFE,0x300,0x1FFE,0x301,0x1FFE,0x342,0x3C5,0x306,0x3C5,
+	0x304,0x3C5,0x308,0x300,0x3C5,0x308,0x301,0x3C1,0x313,0x3C1,0x314,0x3C5,
+	0x342,0x3C5,0x308,0x342,0x3A5,0x306,0x3A5,0x304,0x3A5,0x300,0x3A5,0x301,
+	0x3A1,0x314,0xA8,0x300,0xA8,0x301,0x60,0x3C9,0x300,0x345,0x3C9,0x345,
+	0x3C9,0x301,0x345,0x3C9,0x342,0x3C9,0x342,0x345,0x39F,0x300,0x39F,0x301,
+	0x3A9,0x300,0x3A9,0x301,0x3A9,0x345,0xB4,0x2002,0x2003,0x3A9,0x4B,0x41,
+	0x30A,0x2190,0x338,0x2192,0x338,0x2194,0x338,0x21D0,0x338,0x21D4,0x338,0x21D2,
+	0x338,0x2203,0x338,0x2208,0x338,0x220B,0x338,0x2223,0x338,0x2225,0x338,0x223C,
+	0x338,0x2243,0x338,0x2245,0x338,0x2248,0x338,0x3D,0x338,0x2261,0x338,0x224D,
+	0x338,0x3C,0x338,0x3E,0x338,0x2264,0x338,0x2265,0x338,0x2272,0x338,0x2273,
+	0x338,0x2276,0x338,0x2277,0x338,0x227A,0x338,0x227B,0x338,0x2282,0x338,0x2283,
+	0x338,0x2286,0x338,0x2287,0x338,0x22A2,0x338,0x22A8,0x338,0x22A9,0x338,0x22AB,
+	0x338,0x227C,0x338,0x227D,0x338,0x2291,0x338,0x2292,0x338,0x22B2,0x338,0x22B3,
+	0x338,0x22B4,0x338,0x22B5,0x338,0x3008,0x3009,0x2ADD,0x338,0x304B,0x3099,0x304D,
+	0x3099,0x304F,0x3099,0x3051,0x3099,0x3053,0x3099,0x3055,0x3099,0x3057,0x3099,0x3059,
+	0x3099,0x305B,0x3099,0x305D,0x3099,0x305F,0x3099,0x3061,0x3099,0x3064,0x3099,0x3066,
+	0x3099,0x3068,0x3099,0x306F,0x3099,0x306F,0x309A,0x3072,0x3099,0x3072,0x309A,0x3075,
+	0x3099,0x3075,0x309A,0x3078,0x3099,0x3078,0x309A,0x307B,0x3099,0x307B,0x309A,0x3046,
+	0x3099,0x309D,0x3099,0x30AB,0x3099,0x30AD,0x3099,0x30AF,0x3099,0x30B1,0x3099,0x30B3,
+	0x3099,0x30B5,0x3099,0x30B7,0x3099,0x30B9,0x3099,0x30BB,0x3099,0x30BD,0x3099,0x30BF,
+	0x3099,0x30C1,0x3099,0x30C4,0x3099,0x30C6,0x3099,0x30C8,0x3099,0x30CF,0x3099,0x30CF,
+	0x309A,0x30D2,0x3099,0x30D2,0x309A,0x30D5,0x3099,0x30D5,0x309A,0x30D8,0x3099,0x30D8,
+	0x309A,0x30DB,0x3099,0x30DB,0x309A,0x30A6,0x3099,0x30EF,0x3099,0x30F0,0x3099,0x30F1,
+	0x3099,0x30F2,0x3099,0x30FD,0x3099,0x8C48,0x66F4,0x8ECA,0x8CC8,0x6ED1,0x4E32,0x53E5,
+	0x9F9C,0x9F9C,0x5951,0x91D1,0x5587,0x5948,0x61F6,0x7669,0x7F85,0x863F,0x87BA,0x88F8,
+	0x908F,0x6A02,0x6D1B,0x70D9,0x73DE,0x843D,0x916A,0x99F1,0x4E82,0x5375,0x6B04,0x721B,
+	0x862D,0x9E1E,0x5D50,0x6FEB,0x85CD,0x8964,0x62C9,0x81D8,0x881F,0x5ECA,0x6717,0x6D6A,
+	0x72FC,0x90CE,0x4F86,0x51B7,0x52DE,0x64C4,0x6AD3,0x7210,0x76E7,0x8001,0x8606,0x865C,
+	0x8DEF,0x9732,0x9B6F,0x9DFA,0x788C,0x797F,0x7DA0,0x83C9,0x9304,0x9E7F,0x8AD6,0x58DF,
+	0x5F04,0x7C60,0x807E,0x7262,0x78CA,0x8CC2,0x96F7,0x58D8,0x5C62,0x6A13,0x6DDA,0x6F0F,
+	0x7D2F,0x7E37,0x964B,0x52D2,0x808B,0x51DC,0x51CC,0x7A1C,0x7DBE,0x83F1,0x9675,0x8B80,
+	0x62CF,0x6A02,0x8AFE,0x4E39,0x5BE7,0x6012,0x7387,0x7570,0x5317,0x78FB,0x4FBF,0x5FA9,
+	0x4E0D,0x6CCC,0x6578,0x7D22,0x53C3,0x585E,0x7701,0x8449,0x8AAA,0x6BBA,0x8FB0,0x6C88,
+	0x62FE,0x82E5,0x63A0,0x7565,0x4EAE,0x5169,0x51C9,0x6881,0x7CE7,0x826F,0x8AD2,0x91CF,
+	0x52F5,0x5442,0x5973,0x5EEC,0x65C5,0x6FFE,0x792A,0x95AD,0x9A6A,0x9E97,0x9ECE,0x529B,
+	0x66C6,0x6B77,0x8F62,0x5E74,0x6190,0x6200,0x649A,0x6F23,0x7149,0x7489,0x79CA,0x7DF4,
+	0x806F,0x8F26,0x84EE,0x9023,0x934A,0x5217,0x52A3,0x54BD,0x70C8,0x88C2,0x8AAA,0x5EC9,
+	0x5FF5,0x637B,0x6BAE,0x7C3E,0x7375,0x4EE4,0x56F9,0x5BE7,0x5DBA,0x601C,0x73B2,0x7469,
+	0x7F9A,0x8046,0x9234,0x96F6,0x9748,0x9818,0x4F8B,0x79AE,0x91B4,0x96B8,0x60E1,0x4E86,
+	0x50DA,0x5BEE,0x5C3F,0x6599,0x6A02,0x71CE,0x7642,0x84FC,0x907C,0x9F8D,0x6688,0x962E,
+	0x5289,0x677B,0x67F3,0x6D41,0x6E9C,0x7409,0x7559,0x786B,0x7D10,0x985E,0x516D,0x622E,
+	0x9678,0x502B,0x5D19,0x6DEA,0x8F2A,0x5F8B,0x6144,0x6817,0x7387,0x9686,0x5229,0x540F,
+	0x5C65,0x6613,0x674E,0x68A8,0x6CE5,0x7406,0x75E2,0x7F79,0x88CF,0x88E1,0x91CC,0x96E2,
+	0x533F,0x6EBA,0x541D,0x71D0,0x7498,0x85FA,0x96A3,0x9C57,0x9E9F,0x6797,0x6DCB,0x81E8,
+	0x7ACB,0x7B20,0x7C92,0x72C0,0x7099,0x8B58,0x4EC0,0x8336,0x523A,0x5207,0x5EA6,0x62D3,
+	0x7CD6,0x5B85,0x6D1E,0x66B4,0x8F3B,0x884C,0x964D,0x898B,0x5ED3,0x5140,0x55C0,0x585A,
+	0x6674,0x51DE,0x732A,0x76CA,0x793C,0x795E,0x7965,0x798F,0x9756,0x7CBE,0x7FBD,0x8612,
+	0x8AF8,0x9038,0x90FD,0x98EF,0x98FC,0x9928,0x9DB4,0x90DE,0x96B7,0x4FAE,0x50E7,0x514D,
+	0x52C9,0x52E4,0x5351,0x559D,0x5606,0x5668,0x5840,0x58A8,0x5C64,0x5C6E,0x6094,0x6168,
+	0x618E,0x61F2,0x654F,0x65E2,0x6691,0x6885,0x6D77,0x6E1A,0x6F22,0x716E,0x722B,0x7422,
+	0x7891,0x793E,0x7949,0x7948,0x7950,0x7956,0x795D,0x798D,0x798E,0x7A40,0x7A81,0x7BC0,
+	0x7DF4,0x7E09,0x7E41,0x7F72,0x8005,0x81ED,0x8279,0x8279,0x8457,0x8910,0x8996,0x8B01,
+	0x8B39,0x8CD3,0x8D08,0x8FB6,0x9038,0x96E3,0x97FF,0x983B,0x6075,0x242EE,0x8218,0x4E26,
+	0x51B5,0x5168,0x4F80,0x5145,0x5180,0x52C7,0x52FA,0x559D,0x5555,0x5599,0x55E2,0x585A,
+	0x58B3,0x5944,0x5954,0x5A62,0x5B28,0x5ED2,0x5ED9,0x5F69,0x5FAD,0x60D8,0x614E,0x6108,
+	0x618E,0x6160,0x61F2,0x6234,0x63C4,0x641C,0x6452,0x6556,0x6674,0x6717,0x671B,0x6756,
+	0x6B79,0x6BBA,0x6D41,0x6EDB,0x6ECB,0x6F22,0x701E,0x716E,0x77A7,0x7235,0x72AF,0x732A,
+	0x7471,0x7506,0x753B,0x761D,0x761F,0x76CA,0x76DB,0x76F4,0x774A,0x7740,0x78CC,0x7AB1,
+	0x7BC0,0x7C7B,0x7D5B,0x7DF4,0x7F3E,0x8005,0x8352,0x83EF,0x8779,0x8941,0x8986,0x8996,
+	0x8ABF,0x8AF8,0x8ACB,0x8B01,0x8AFE,0x8AED,0x8B39,0x8B8A,0x8D08,0x8F38,0x9072,0x9199,
+	0x9276,0x967C,0x96E3,0x9756,0x97DB,0x97FF,0x980B,0x983B,0x9B12,0x9F9C,0x2284A,0x22844,
+	0x233D5,0x3B9D,0x4018,0x4039,0x25249,0x25CD0,0x27ED3,0x9F43,0x9F8E,0x5D9,0x5B4,0x5F2,
+	0x5B7,0x5E9,0x5C1,0x5E9,0x5C2,0x5E9,0x5BC,0x5C1,0x5E9,0x5BC,0x5C2,0x5D0,
+	0x5B7,0x5D0,0x5B8,0x5D0,0x5BC,0x5D1,0x5BC,0x5D2,0x5BC,0x5D3,0x5BC,0x5D4,
+	0x5BC,0x5D5,0x5BC,0x5D6,0x5BC,0x5D8,0x5BC,0x5D9,0x5BC,0x5DA,0x5BC,0x5DB,
+	0x5BC,0x5DC,0x5BC,0x5DE,0x5BC,0x5E0,0x5BC,0x5E1,0x5BC,0x5E3,0x5BC,0x5E4,
+	0x5BC,0x5E6,0x5BC,0x5E7,0x5BC,0x5E8,0x5BC,0x5E9,0x5BC,0x5EA,0x5BC,0x5D5,
+	0x5B9,0x5D1,0x5BF,0x5DB,0x5BF,0x5E4,0x5BF,0x11099,0x110BA,0x1109B,0x110BA,0x110A5,
+	0x110BA,0x11131,0x11127,0x11132,0x11127,0x11347,0x1133E,0x11347,0x11357,0x114B9,0x114BA,0x114B9,
+	0x114B0,0x114B9,0x114BD,0x115B8,0x115AF,0x115B9,0x115AF,0x11935,0x11930,0x1D157,0x1D165,0x1D158,
+	0x1D165,0x1D158,0x1D165,0x1D16E,0x1D158,0x1D165,0x1D16F,0x1D158,0x1D165,0x1D170,0x1D158,0x1D165,
+	0x1D171,0x1D158,0x1D165,0x1D172,0x1D1B9,0x1D165,0x1D1BA,0x1D165,0x1D1B9,0x1D165,0x1D16E,0x1D1BA,
+	0x1D165,0x1D16E,0x1D1B9,0x1D165,0x1D16F,0x1D1BA,0x1D165,0x1D16F,0x4E3D,0x4E38,0x4E41,0x20122,
+	0x4F60,0x4FAE,0x4FBB,0x5002,0x507A,0x5099,0x50E7,0x50CF,0x349E,0x2063A,0x514D,0x5154,
+	0x5164,0x5177,0x2051C,0x34B9,0x5167,0x518D,0x2054B,0x5197,0x51A4,0x4ECC,0x51AC,0x51B5,
+	0x291DF,0x51F5,0x5203,0x34DF,0x523B,0x5246,0x5272,0x5277,0x3515,0x52C7,0x52C9,0x52E4,
+	0x52FA,0x5305,0x5306,0x5317,0x5349,0x5351,0x535A,0x5373,0x537D,0x537F,0x537F,0x537F,
+	0x20A2C,0x7070,0x53CA,0x53DF,0x20B63,0x53EB,0x53F1,0x5406,0x549E,0x5438,0x5448,0x5468,
+	0x54A2,0x54F6,0x5510,0x5553,0x5563,0x5584,0x5584,0x5599,0x55AB,0x55B3,0x55C2,0x5716,
+	0x5606,0x5717,0x5651,0x5674,0x5207,0x58EE,0x57CE,0x57F4,0x580D,0x578B,0x5832,0x5831,
+	0x58AC,0x214E4,0x58F2,0x58F7,0x5906,0x591A,0x5922,0x5962,0x216A8,0x216EA,0x59EC,0x5A1B,
+	0x5A27,0x59D8,0x5A66,0x36EE,0x36FC,0x5B08,0x5B3E,0x5B3E,0x219C8,0x5BC3,0x5BD8,0x5BE7,
+	0x5BF3,0x21B18,0x5BFF,0x5C06,0x5F53,0x5C22,0x3781,0x5C60,0x5C6E,0x5CC0,0x5C8D,0x21DE4,
+	0x5D43,0x21DE6,0x5D6E,0x5D6B,0x5D7C,0x5DE1,0x5DE2,0x382F,0x5DFD,0x5E28,0x5E3D,0x5E69,
+	0x3862,0x22183,0x387C,0x5EB0,0x5EB3,0x5EB6,0x5ECA,0x2A392,0x5EFE,0x22331,0x22331,0x8201,
+	0x5F22,0x5F22,0x38C7,0x232B8,0x261DA,0x5F62,0x5F6B,0x38E3,0x5F9A,0x5FCD,0x5FD7,0x5FF9,
+	0x6081,0x393A,0x391C,0x6094,0x226D4,0x60C7,0x6148,0x614C,0x614E,0x614C,0x617A,0x618E,
+	0x61B2,0x61A4,0x61AF,0x61DE,0x61F2,0x61F6,0x6210,0x621B,0x625D,0x62B1,0x62D4,0x6350,
+	0x22B0C,0x633D,0x62FC,0x6368,0x6383,0x63E4,0x22BF1,0x6422,0x63C5,0x63A9,0x3A2E,0x6469,
+	0x647E,0x649D,0x6477,0x3A6C,0x654F,0x656C,0x2300A,0x65E3,0x66F8,0x6649,0x3B19,0x6691,
+	0x3B08,0x3AE4,0x5192,0x5195,0x6700,0x669C,0x80AD,0x43D9,0x6717,0x671B,0x6721,0x675E,
+	0x6753,0x233C3,0x3B49,0x67FA,0x6785,0x6852,0x6885,0x2346D,0x688E,0x681F,0x6914,0x3B9D,
+	0x6942,0x69A3,0x69EA,0x6AA8,0x236A3,0x6ADB,0x3C18,0x6B21,0x238A7,0x6B54,0x3C4E,0x6B72,
+	0x6B9F,0x6BBA,0x6BBB,0x23A8D,0x21D0B,0x23AFA,0x6C4E,0x23CBC,0x6CBF,0x6CCD,0x6C67,0x6D16,
+	0x6D3E,0x6D77,0x6D41,0x6D69,0x6D78,0x6D85,0x23D1E,0x6D34,0x6E2F,0x6E6E,0x3D33,0x6ECB,
+	0x6EC7,0x23ED1,0x6DF9,0x6F6E,0x23F5E,0x23F8E,0x6FC6,0x7039,0x701E,0x701B,0x3D96,0x704A,
+	0x707D,0x7077,0x70AD,0x20525,0x7145,0x24263,0x719C,0x243AB,0x7228,0x7235,0x7250,0x24608,
+	0x7280,0x7295,0x24735,0x24814,0x737A,0x738B,0x3EAC,0x73A5,0x3EB8,0x3EB8,0x7447,0x745C,
+	0x7471,0x7485,0x74CA,0x3F1B,0x7524,0x24C36,0x753E,0x24C92,0x7570,0x2219F,0x7610,0x24FA1,
+	0x24FB8,0x25044,0x3FFC,0x4008,0x76F4,0x250F3,0x250F2,0x25119,0x25133,0x771E,0x771F,0x771F,
+	0x774A,0x4039,0x778B,0x4046,0x4096,0x2541D,0x784E,0x788C,0x78CC,0x40E3,0x25626,0x7956,
+	0x2569A,0x256C5,0x798F,0x79EB,0x412F,0x7A40,0x7A4A,0x7A4F,0x2597C,0x25AA7,0x25AA7,0x7AEE,
+	0x4202,0x25BAB,0x7BC6,0x7BC9,0x4227,0x25C80,0x7CD2,0x42A0,0x7CE8,0x7CE3,0x7D00,0x25F86,
+	0x7D63,0x4301,0x7DC7,0x7E02,0x7E45,0x4334,0x26228,0x26247,0x4359,0x262D9,0x7F7A,0x2633E,
+	0x7F95,0x7FFA,0x8005,0x264DA,0x26523,0x8060,0x265A8,0x8070,0x2335F,0x43D5,0x80B2,0x8103,
+	0x440B,0x813E,0x5AB5,0x267A7,0x267B5,0x23393,0x2339C,0x8201,0x8204,0x8F9E,0x446B,0x8291,
+	0x828B,0x829D,0x52B3,0x82B1,0x82B3,0x82BD,0x82E6,0x26B3C,0x82E5,0x831D,0x8363,0x83AD,
+	0x8323,0x83BD,0x83E7,0x8457,0x8353,0x83CA,0x83CC,0x83DC,0x26C36,0x26D6B,0x26CD5,0x452B,
+	0x84F1,0x84F3,0x8516,0x273CA,0x8564,0x26F2C,0x455D,0x4561,0x26FB1,0x270D2,0x456B,0x8650,
+	0x865C,0x8667,0x8669,0x86A9,0x8688,0x870E,0x86E2,0x8779,0x8728,0x876B,0x8786,0x45D7,
+	0x87E1,0x8801,0x45F9,0x8860,0x8863,0x27667,0x88D7,0x88DE,0x4635,0x88FA,0x34BB,0x278AE,
+	0x27966,0x46BE,0x46C7,0x8AA0,0x8AED,0x8B8A,0x8C55,0x27CA8,0x8CAB,0x8CC1,0x8D1B,0x8D77,
+	0x27F2F,0x20804,0x8DCB,0x8DBC,0x8DF0,0x208DE,0x8ED4,0x8F38,0x285D2,0x285ED,0x9094,0x90F1,
+	0x9111,0x2872E,0x911B,0x9238,0x92D7,0x92D8,0x927C,0x93F9,0x9415,0x28BFA,0x958B,0x4995,
+	0x95B7,0x28D77,0x49E6,0x96C3,0x5DB2,0x9723,0x29145,0x2921A,0x4A6E,0x4A76,0x97E0,0x2940A,
+	0x4AB2,0x29496,0x980B,0x980B,0x9829,0x295B6,0x98E2,0x4B33,0x9929,0x99A7,0x99C2,0x99FE,
+	0x4BCE,0x29B30,0x9B12,0x9C40,0x9CFD,0x4CCE,0x4CED,0x9D67,0x2A0CE,0x4CF8,0x2A105,0x2A20E,
+	0x2A291,0x9EBB,0x4D56,0x9EF9,0x9EFE,0x9F05,0x9F0F,0x9F16,0x9F3B,0x2A600,
+};
+
+// first code point, last code point, canonical combining class (0 if absent)
+static const unsigned int CCC_RANGES[][3] = {
+	{0x300,0x314,0xE6}, {0x315,0x315,0xE8}, {0x316,0x319,0xDC}, {0x31A,0x31A,0xE8}, {0x31B,0x31B,0xD8}, {0x31C,0x320,0xDC},
+	{0x321,0x322,0xCA}, {0x323,0x326,0xDC}, {0x327,0x328,0xCA}, {0x329,0x333,0xDC}, {0x334,0x338,0x1}, {0x339,0x33C,0xDC},
+	{0x33D,0x344,0xE6}, {0x345,0x345,0xF0}, {0x346,0x346,0xE6}, {0x347,0x349,0xDC}, {0x34A,0x34C,0xE6}, {0x34D,0x34E,0xDC},
+	{0x350,0x352,0xE6}, {0x353,0x356,0xDC}, {0x357,0x357,0xE6}, {0x358,0x358,0xE8}, {0x359,0x35A,0xDC}, {0x35B,0x35B,0xE6},
+	{0x35C,0x35C,0xE9}, {0x35D,0x35E,0xEA}, {0x35F,0x35F,0xE9}, {0x360,0x361,0xEA}, {0x362,0x362,0xE9}, {0x363,0x36F,0xE6},
+	{0x483,0x487,0xE6}, {0x591,0x591,0xDC}, {0x592,0x595,0xE6}, {0x596,0x596,0xDC}, {0x597,0x599,0xE6}, {0x59A,0x59A,0xDE},
+	{0x59B,0x59B,0xDC}, {0x59C,0x5A1,0xE6}, {0x5A2,0x5A7,0xDC}, {0x5A8,0x5A9,0xE6}, {0x5AA,0x5AA,0xDC}, {0x5AB,0x5AC,0xE6},
+	{0x5AD,0x5AD,0xDE}, {0x5AE,0x5AE,0xE4}, {0x5AF,0x5AF,0xE6}, {0x5B0,0x5B0,0xA}, {0x5B1,0x5B1,0xB}, {0x5B2,0x5B2,0xC},
+	{0x5B3,0x5B3,0xD}, {0x5B4,0x5B4,0xE}, {0x5B5,0x5B5,0xF}, {0x5B6,0x5B6,0x10}, {0x5B7,0x5B7,0x11}, {0x5B8,0x5B8,0x12},
+	{0x5B9,0x5BA,0x13}, {0x5BB,0x5BB,0x14}, {0x5BC,0x5BC,0x15}, {0x5BD,0x5BD,0x16}, {0x5BF,0x5BF,0x17}, {0x5C1,0x5C1,0x18},
+	{0x5C2,0x5C2,0x19}, {0x5C4,0x5C4,0xE6}, {0x5C5,0x5C5,0xDC}, {0x5C7,0x5C7,0x12}, {0x610,0x617,0xE6}, {0x618,0x618,0x1E},
+	{0x619,0x619,0x1F}, {0x61A,0x61A,0x20}, {0x64B,0x64B,0x1B}, {0x64C,0x64C,0x1C}, {0x64D,0x64D,0x1D}, {0x64E,0x64E,0x1E},
+	{0x64F,0x64F,0x1F}, {0x650,0x650,0x20}, {0x651,0x651,0x21}, {0x652,0x652,0x22}, {0x653,0x654,0xE6}, {0x655,0x656,0xDC},
+	{0x657,0x65B,0xE6}, {0x65C,0x65C,0xDC}, {0x65D,0x65E,0xE6}, {0x65F,0x65F,0xDC}, {0x670,0x670,0x23}, {0x6D6,0x6DC,0xE6},
+	{0x6DF,0x6E2,0xE6}, {0x6E3,0x6E3,0xDC}, {0x6E4,0x6E4,0xE6}, {0x6E7,0x6E8,0xE6}, {0x6EA,0x6EA,0xDC}, {0x6EB,0x6EC,0xE6},
+	{0x6ED,0x6ED,0xDC}, {0x711,0x711,0x24}, {0x730,0x730,0xE6}, {0x731,0x731,0xDC}, {0x732,0x733,0xE6}, {0x734,0x734,0xDC},
+	{0x735,0x736,0xE6}, {0x737,0x739,0xDC}, {0x73A,0x73A,0xE6}, {0x73B,0x73C,0xDC}, {0x73D,0x73D,0xE6}, {0x73E,0x73E,0xDC},
+	{0x73F,0x741,0xE6}, {0x742,0x742,0xDC}, {0x743,0x743,0xE6}, {0x744,0x744,0xDC}, {0x745,0x745,0xE6}, {0x746,0x746,0xDC},
+	{0x747,0x747,0xE6}, {0x748,0x748,0xDC}, {0x749,0x74A,0xE6}, {0x7EB,0x7F1,0xE6}, {0x7F2,0x7F2,0xDC}, {0x7F3,0x7F3,0xE6},
+	{0x7FD,0x7FD,0xDC}, {0x816,0x819,0xE6}, {0x81B,0x823,0xE6}, {0x825,0x827,0xE6}, {0x829,0x82D,0xE6}, {0x859,0x85B,0xDC},
+	{0x898,0x898,0xE6}, {0x899,0x89B,0xDC}, {0x89C,0x89F,0xE6}, {0x8CA,0x8CE,0xE6}, {0x8CF,0x8D3,0xDC}, {0x8D4,0x8E1,0xE6},
+	{0x8E3,0x8E3,0xDC}, {0x8E4,0x8E5,0xE6}, {0x8E6,0x8E6,0xDC}, {0x8E7,0x8E8,0xE6}, {0x8E9,0x8E9,0xDC}, {0x8EA,0x8EC,0xE6},
+	{0x8ED,0x8EF,0xDC}, {0x8F0,0x8F0,0x1B}, {0x8F1,0x8F1,0x1C}, {0x8F2,0x8F2,0x1D}, {0x8F3,0x8F5,0xE6}, {0x8F6,0x8F6,0xDC},
+	{0x8F7,0x8F8,0xE6}, {0x8F9,0x8FA,0xDC}, {0x8FB,0x8FF,0xE6}, {0x93C,0x93C,0x7}, {0x94D,0x94D,0x9}, {0x951,0x951,0xE6},
+	{0x952,0x952,0xDC}, {0x953,0x954,0xE6}, {0x9BC,0x9BC,0x7}, {0x9CD,0x9CD,0x9}, {0x9FE,0x9FE,0xE6}, {0xA3C,0xA3C,0x7},
+	{0xA4D,0xA4D,0x9}, {0xABC,0xABC,0x7}, {0xACD,0xACD,0x9}, {0xB3C,0xB3C,0x7}, {0xB4D,0xB4D,0x9}, {0xBCD,0xBCD,0x9},
+	{0xC3C,0xC3C,0x7}, {0xC4D,0xC4D,0x9}, {0xC55,0xC55,0x54}, {0xC56,0xC56,0x5B}, {0xCBC,0xCBC,0x7}, {0xCCD,0xCCD,0x9},
+	{0xD3B,0xD3C,0x9}, {0xD4D,0xD4D,0x9}, {0xDCA,0xDCA,0x9}, {0xE38,0xE39,0x67}, {0xE3A,0xE3A,0x9}, {0xE48,0xE4B,0x6B},
+	{0xEB8,0xEB9,0x76}, {0xEBA,0xEBA,0x9}, {0xEC8,0xECB,0x7A}, {0xF18,0xF19,0xDC}, {0xF35,0xF35,0xDC}, {0xF37,0xF37,0xDC},
+	{0xF39,0xF39,0xD8}, {0xF71,0xF71,0x81}, {0xF72,0xF72,0x82}, {0xF74,0xF74,0x84}, {0xF7A,0xF7D,0x82}, {0xF80,0xF80,0x82},
+	{0xF82,0xF83,0xE6}, {0xF84,0xF84,0x9}, {0xF86,0xF87,0xE6}, {0xFC6,0xFC6,0xDC}, {0x1037,0x1037,0x7}, {0x1039,0x103A,0x9},
+	{0x108D,0x108D,0xDC}, {0x135D,0x135F,0xE6}, {0x1714,0x1715,0x9}, {0x1734,0x1734,0x9}, {0x17D2,0x17D2,0x9}, {0x17DD,0x17DD,0xE6},
+	{0x18A9,0x18A9,0xE4}, {0x1939,0x1939,0xDE}, {0x193A,0x193A,0xE6}, {0x193B,0x193B,0xDC}, {0x1A17,0x1A17,0xE6}, {0x1A18,0x1A18,0xDC},
+	{0x1A60,0x1A60,0x9}, {0x1A75,0x1A7C,0xE6}, {0x1A7F,0x1A7F,0xDC}, {0x1AB0,0x1AB4,0xE6}, {0x1AB5,0x1ABA,0xDC}, {0x1ABB,0x1ABC,0xE6},
+	{0x1ABD,0x1ABD,0xDC}, {0x1ABF,0x1AC0,0xDC}, {0x1AC1,0x1AC2,0xE6}, {0x1AC3,0x1AC4,0xDC}, {0x1AC5,0x1AC9,0xE6}, {0x1ACA,0x1ACA,0xDC},
+	{0x1ACB,0x1ACE,0xE6}, {0x1B34,0x1B34,0x7}, {0x1B44,0x1B44,0x9}, {0x1B6B,0x1B6B,0xE6}, {0x1B6C,0x1B6C,0xDC}, {0x1B6D,0x1B73,0xE6},
+	{0x1BAA,0x1BAB,0x9}, {0x1BE6,0x1BE6,0x7}, {0x1BF2,0x1BF3,0x9}, {0x1C37,0x1C37,0x7}, {0x1CD0,0x1CD2,0xE6}, {0x1CD4,0x1CD4,0x1},
+	{0x1CD5,0x1CD9,0xDC}, {0x1CDA,0x1CDB,0xE6}, {0x1CDC,0x1CDF,0xDC}, {0x1CE0,0x1CE0,0xE6}, {0x1CE2,0x1CE8,0x1}, {0x1CED,0x1CED,0xDC},
+	{0x1CF4,0x1CF4,0xE6}, {0x1CF8,0x1CF9,0xE6}, {0x1DC0,0x1DC1,0xE6}, {0x1DC2,0x1DC2,0xDC}, {0x1DC3,0x1DC9,0xE6}, {0x1DCA,0x1DCA,0xDC},
+	{0x1DCB,0x1DCC,0xE6}, {0x1DCD,0x1DCD,0xEA}, {0x1DCE,0x1DCE,0xD6}, {0x1DCF,0x1DCF,0xDC}, {0x1DD0,0x1DD0,0xCA}, {0x1DD1,0x1DF5,0xE6},
+	{0x1DF6,0x1DF6,0xE8}, {0x1DF7,0x1DF8,0xE4}, {0x1DF9,0x1DF9,0xDC}, {0x1DFA,0x1DFA,0xDA}, {0x1DFB,0x1DFB,0xE6}, {0x1DFC,0x1DFC,0xE9},
+	{0x1DFD,0x1DFD,0xDC}, {0x1DFE,0x1DFE,0xE6}, {0x1DFF,0x1DFF,0xDC}, {0x20D0,0x20D1,0xE6}, {0x20D2,0x20D3,0x1}, {0x20D4,0x20D7,0xE6},
+	{0x20D8,0x20DA,0x1}, {0x20DB,0x20DC,0xE6}, {0x20E1,0x20E1,0xE6}, {0x20E5,0x20E6,0x1}, {0x20E7,0x20E7,0xE6}, {0x20E8,0x20E8,0xDC},
+	{0x20E9,0x20E9,0xE6}, {0x20EA,0x20EB,0x1}, {0x20EC,0x20EF,0xDC}, {0x20F0,0x20F0,0xE6}, {0x2CEF,0x2CF1,0xE6}, {0x2D7F,0x2D7F,0x9},
+	{0x2DE0,0x2DFF,0xE6}, {0x302A,0x302A,0xDA}, {0x302B,0x302B,0xE4}, {0x302C,0x302C,0xE8}, {0x302D,0x302D,0xDE}, {0x302E,0x302F,0xE0},
+	{0x3099,0x309A,0x8}, {0xA66F,0xA66F,0xE6}, {0xA674,0xA67D,0xE6}, {0xA69E,0xA69F,0xE6}, {0xA6F0,0xA6F1,0xE6}, {0xA806,0xA806,0x9},
+	{0xA82C,0xA82C,0x9}, {0xA8C4,0xA8C4,0x9}, {0xA8E0,0xA8F1,0xE6}, {0xA92B,0xA92D,0xDC}, {0xA953,0xA953,0x9}, {0xA9B3,0xA9B3,0x7},
+	{0xA9C0,0xA9C0,0x9}, {0xAAB0,0xAAB0,0xE6}, {0xAAB2,0xAAB3,0xE6}, {0xAAB4,0xAAB4,0xDC}, {0xAAB7,0xAAB8,0xE6}, {0xAABE,0xAABF,0xE6},
+	{0xAAC1,0xAAC1,0xE6}, {0xAAF6,0xAAF6,0x9}, {0xABED,0xABED,0x9}, {0xFB1E,0xFB1E,0x1A}, {0xFE20,0xFE26,0xE6}, {0xFE27,0xFE2D,0xDC},
+	{0xFE2E,0xFE2F,0xE6}, {0x101FD,0x101FD,0xDC}, {0x102E0,0x102E0,0xDC}, {0x10376,0x1037A,0xE6}, {0x10A0D,0x10A0D,0xDC}, {0x10A0F,0x10A0F,0xE6},
+	{0x10A38,0x10A38,0xE6}, {0x10A39,0x10A39,0x1}, {0x10A3A,0x10A3A,0xDC}, {0x10A3F,0x10A3F,0x9}, {0x10AE5,0x10AE5,0xE6}, {0x10AE6,0x10AE6,0xDC},
+	{0x10D24,0x10D27,0xE6}, {0x10EAB,0x10EAC,0xE6}, {0x10F46,0x10F47,0xDC}, {0x10F48,0x10F4A,0xE6}, {0x10F4B,0x10F4B,0xDC}, {0x10F4C,0x10F4C,0xE6},
+	{0x10F4D,0x10F50,0xDC}, {0x10F82,0x10F82,0xE6}, {0x10F83,0x10F83,0xDC}, {0x10F84,0x10F84,0xE6}, {0x10F85,0x10F85,0xDC}, {0x11046,0x11046,0x9},
+	{0x11070,0x11070,0x9}, {0x1107F,0x1107F,0x9}, {0x110B9,0x110B9,0x9}, {0x110BA,0x110BA,0x7}, {0x11100,0x11102,0xE6}, {0x11133,0x11134,0x9},
+	{0x11173,0x11173,0x7}, {0x111C0,0x111C0,0x9}, {0x111CA,0x111CA,0x7}, {0x11235,0x11235,0x9}, {0x11236,0x11236,0x7}, {0x112E9,0x112E9,0x7},
+	{0x112EA,0x112EA,0x9}, {0x1133B,0x1133C,0x7}, {0x1134D,0x1134D,0x9}, {0x11366,0x1136C,0xE6}, {0x11370,0x11374,0xE6}, {0x11442,0x11442,0x9},
+	{0x11446,0x11446,0x7}, {0x1145E,0x1145E,0xE6}, {0x114C2,0x114C2,0x9}, {0x114C3,0x114C3,0x7}, {0x115BF,0x115BF,0x9}, {0x115C0,0x115C0,0x7},
+	{0x1163F,0x1163F,0x9}, {0x116B6,0x116B6,0x9}, {0x116B7,0x116B7,0x7}, {0x1172B,0x1172B,0x9}, {0x11839,0x11839,0x9}, {0x1183A,0x1183A,0x7},
+	{0x1193D,0x1193E,0x9}, {0x11943,0x11943,0x7}, {0x119E0,0x119E0,0x9}, {0x11A34,0x11A34,0x9}, {0x11A47,0x11A47,0x9}, {0x11A99,0x11A99,0x9},
+	{0x11C3F,0x11C3F,0x9}, {0x11D42,0x11D42,0x7}, {0x11D44,0x11D45,0x9}, {0x11D97,0x11D97,0x9}, {0x16AF0,0x16AF4,0x1}, {0x16B30,0x16B36,0xE6},
+	{0x16FF0,0x16FF1,0x6}, {0x1BC9E,0x1BC9E,0x1}, {0x1D165,0x1D166,0xD8}, {0x1D167,0x1D169,0x1}, {0x1D16D,0x1D16D,0xE2}, {0x1D16E,0x1D172,0xD8},
+	{0x1D17B,0x1D182,0xDC}, {0x1D185,0x1D189,0xE6}, {0x1D18A,0x1D18B,0xDC}, {0x1D1AA,0x1D1AD,0xE6}, {0x1D242,0x1D244,0xE6}, {0x1E000,0x1E006,0xE6},
+	{0x1E008,0x1E018,0xE6}, {0x1E01B,0x1E021,0xE6}, {0x1E023,0x1E024,0xE6}, {0x1E026,0x1E02A,0xE6}, {0x1E130,0x1E136,0xE6}, {0x1E2AE,0x1E2AE,0xE6},
+	{0x1E2EC,0x1E2EF,0xE6}, {0x1E8D0,0x1E8D6,0xDC}, {0x1E944,0x1E949,0xE6}, {0x1E94A,0x1E94A,0x7},
+};
+
+// first, second, primary composite
+static const unsigned int COMPOSE_PAIRS[][3] = {
+	{0x3C,0x338,0x226E}, {0x3D,0x338,0x2260}, {0x3E,0x338,0x226F}, {0x41,0x300,0xC0}, {0x41,0x301,0xC1},
+	{0x41,0x302,0xC2}, {0x41,0x303,0xC3}, {0x41,0x304,0x100}, {0x41,0x306,0x102}, {0x41,0x307,0x226},
+	{0x41,0x308,0xC4}, {0x41,0x309,0x1EA2}, {0x41,0x30A,0xC5}, {0x41,0x30C,0x1CD}, {0x41,0x30F,0x200},
+	{0x41,0x311,0x202}, {0x41,0x323,0x1EA0}, {0x41,0x325,0x1E00}, {0x41,0x328,0x104}, {0x42,0x307,0x1E02},
+	{0x42,0x323,0x1E04}, {0x42,0x331,0x1E06}, {0x43,0x301,0x106}, {0x43,0x302,0x108}, {0x43,0x307,0x10A},
+	{0x43,0x30C,0x10C}, {0x43,0x327,0xC7}, {0x44,0x307,0x1E0A}, {0x44,0x30C,0x10E}, {0x44,0x323,0x1E0C},
+	{0x44,0x327,0x1E10}, {0x44,0x32D,0x1E12}, {0x44,0x331,0x1E0E}, {0x45,0x300,0xC8}, {0x45,0x301,0xC9},
+	{0x45,0x302,0xCA}, {0x45,0x303,0x1EBC}, {0x45,0x304,0x112}, {0x45,0x306,0x114}, {0x45,0x307,0x116},
+	{0x45,0x308,0xCB}, {0x45,0x309,0x1EBA}, {0x45,0x30C,0x11A}, {0x45,0x30F,0x204}, {0x45,0x311,0x206},
+	{0x45,0x323,0x1EB8}, {0x45,0x327,0x228}, {0x45,0x328,0x118}, {0x45,0x32D,0x1E18}, {0x45,0x330,0x1E1A},
+	{0x46,0x307,0x1E1E}, {0x47,0x301,0x1F4}, {0x47,0x302,0x11C}, {0x47,0x304,0x1E20}, {0x47,0x306,0x11E},
+	{0x47,0x307,0x120}, {0x47,0x30C,0x1E6}, {0x47,0x327,0x122}, {0x48,0x302,0x124}, {0x48,0x307,0x1E22},
+	{0x48,0x308,0x1E26}, {0x48,0x30C,0x21E}, {0x48,0x323,0x1E24}, {0x48,0x327,0x1E28}, {0x48,0x32E,0x1E2A},
+	{0x49,0x300,0xCC}, {0x49,0x301,0xCD}, {0x49,0x302,0xCE}, {0x49,0x303,0x128}, {0x49,0x304,0x12A},
+	{0x49,0x306,0x12C}, {0x49,0x307,0x130}, {0x49,0x308,0xCF}, {0x49,0x309,0x1EC8}, {0x49,0x30C,0x1CF},
+	{0x49,0x30F,0x208}, {0x49,0x311,0x20A}, {0x49,0x323,0x1ECA}, {0x49,0x328,0x12E}, {0x49,0x330,0x1E2C},
+	{0x4A,0x302,0x134}, {0x4B,0x301,0x1E30}, {0x4B,0x30C,0x1E8}, {0x4B,0x323,0x1E32}, {0x4B,0x327,0x136},
+	{0x4B,0x331,0x1E34}, {0x4C,0x301,0x139}, {0x4C,0x30C,0x13D}, {0x4C,0x323,0x1E36}, {0x4C,0x327,0x13B},
+	{0x4C,0x32D,0x1E3C}, {0x4C,0x331,0x1E3A}, {0x4D,0x301,0x1E3E}, {0x4D,0x307,0x1E40}, {0x4D,0x323,0x1E42},
+	{0x4E,0x300,0x1F8}, {0x4E,0x301,0x143}, {0x4E,0x303,0xD1}, {0x4E,0x307,0x1E44}, {0x4E,0x30C,0x147},
+	{0x4E,0x323,0x1E46}, {0x4E,0x327,0x145}, {0x4E,0x32D,0x1E4A}, {0x4E,0x331,0x1E48}, {0x4F,0x300,0xD2},
+	{0x4F,0x301,0xD3}, {0x4F,0x302,0xD4}, {0x4F,0x303,0xD5}, {0x4F,0x304,0x14C}, {0x4F,0x306,0x14E},
+	{0x4F,0x307,0x22E}, {0x4F,0x308,0xD6}, {0x4F,0x309,0x1ECE}, {0x4F,0x30B,0x150}, {0x4F,0x30C,0x1D1},
+	{0x4F,0x30F,0x20C}, {0x4F,0x311,0x20E}, {0x4F,0x31B,0x1A0}, {0x4F,0x323,0x1ECC}, {0x4F,0x328,0x1EA},
+	{0x50,0x301,0x1E54}, {0x50,0x307,0x1E56}, {0x52,0x301,0x154}, {0x52,0x307,0x1E58}, {0x52,0x30C,0x158},
+	{0x52,0x30F,0x210}, {0x52,0x311,0x212}, {0x52,0x323,0x1E5A}, {0x52,0x327,0x156}, {0x52,0x331,0x1E5E},
+	{0x53,0x301,0x15A}, {0x53,0x302,0x15C}, {0x53,0x307,0x1E60}, {0x53,0x30C,0x160}, {0x53,0x323,0x1E62},
+	{0x53,0x326,0x218}, {0x53,0x327,0x15E}, {0x54,0x307,0x1E6A}, {0x54,0x30C,0x164}, {0x54,0x323,0x1E6C},
+	{0x54,0x326,0x21A}, {0x54,0x327,0x162}, {0x54,0x32D,0x1E70}, {0x54,0x331,0x1E6E}, {0x55,0x300,0xD9},
+	{0x55,0x301,0xDA}, {0x55,0x302,0xDB}, {0x55,0x303,0x168}, {0x55,0x304,0x16A}, {0x55,0x306,0x16C},
+	{0x55,0x308,0xDC}, {0x55,0x309,0x1EE6}, {0x55,0x30A,0x16E}, {0x55,0x30B,0x170}, {0x55,0x30C,0x1D3},
+	{0x55,0x30F,0x214}, {0x55,0x311,0x216}, {0x55,0x31B,0x1AF}, {0x55,0x323,0x1EE4}, {0x55,0x324,0x1E72},
+	{0x55,0x328,0x172}, {0x55,0x32D,0x1E76}, {0x55,0x330,0x1E74}, {0x56,0x303,0x1E7C}, {0x56,0x323,0x1E7E},
+	{0x57,0x300,0x1E80}, {0x57,0x301,0x1E82}, {0x57,0x302,0x174}, {0x57,0x307,0x1E86}, {0x57,0x308,0x1E84},
+	{0x57,0x323,0x1E88}, {0x58,0x307,0x1E8A}, {0x58,0x308,0x1E8C}, {0x59,0x300,0x1EF2}, {0x59,0x301,0xDD},
+	{0x59,0x302,0x176}, {0x59,0x303,0x1EF8}, {0x59,0x304,0x232}, {0x59,0x307,0x1E8E}, {0x59,0x308,0x178},
+	{0x59,0x309,0x1EF6}, {0x59,0x323,0x1EF4}, {0x5A,0x301,0x179}, {0x5A,0x302,0x1E90}, {0x5A,0x307,0x17B},
+	{0x5A,0x30C,0x17D}, {0x5A,0x323,0x1E92}, {0x5A,0x331,0x1E94}, {0x61,0x300,0xE0}, {0x61,0x301,0xE1},
+	{0x61,0x302,0xE2}, {0x61,0x303,0xE3}, {0x61,0x304,0x101}, {0x61,0x306,0x103}, {0x61,0x307,0x227},
+	{0x61,0x308,0xE4}, {0x61,0x309,0x1EA3}, {0x61,0x30A,0xE5}, {0x61,0x30C,0x1CE}, {0x61,0x30F,0x201},
+	{0x61,0x311,0x203}, {0x61,0x323,0x1EA1}, {0x61,0x325,0x1E01}, {0x61,0x328,0x105}, {0x62,0x307,0x1E03},
+	{0x62,0x323,0x1E05}, {0x62,0x331,0x1E07}, {0x63,0x301,0x107}, {0x63,0x302,0x109}, {0x63,0x307,0x10B},
+	{0x63,0x30C,0x10D}, {0x63,0x327,0xE7}, {0x64,0x307,0x1E0B}, {0x64,0x30C,0x10F}, {0x64,0x323,0x1E0D},
+	{0x64,0x327,0x1E11}, {0x64,0x32D,0x1E13}, {0x64,0x331,0x1E0F}, {0x65,0x300,0xE8}, {0x65,0x301,0xE9},
+	{0x65,0x302,0xEA}, {0x65,0x303,0x1EBD}, {0x65,0x304,0x113}, {0x65,0x306,0x115}, {0x65,0x307,0x117},
+	{0x65,0x308,0xEB}, {0x65,0x309,0x1EBB}, {0x65,0x30C,0x11B}, {0x65,0x30F,0x205}, {0x65,0x311,0x207},
+	{0x65,0x323,0x1EB9}, {0x65,0x327,0x229}, {0x65,0x328,0x119}, {0x65,0x32D,0x1E19}, {0x65,0x330,0x1E1B},
+	{0x66,0x307,0x1E1F}, {0x67,0x301,0x1F5}, {0x67,0x302,0x11D}, {0x67,0x304,0x1E21}, {0x67,0x306,0x11F},
+	{0x67,0x307,0x121}, {0x67,0x30C,0x1E7}, {0x67,0x327,0x123}, {0x68,0x302,0x125}, {0x68,0x307,0x1E23},
+	{0x68,0x308,0x1E27}, {0x68,0x30C,0x21F}, {0x68,0x323,0x1E25}, {0x68,0x327,0x1E29}, {0x68,0x32E,0x1E2B},
+	{0x68,0x331,0x1E96}, {0x69,0x300,0xEC}, {0x69,0x301,0xED}, {0x69,0x302,0xEE}, {0x69,0x303,0x129},
+	{0x69,0x304,0x12B}, {0x69,0x306,0x12D}, {0x69,0x308,0xEF}, {0x69,0x309,0x1EC9}, {0x69,0x30C,0x1D0},
+	{0x69,0x30F,0x209}, {0x69,0x311,0x20B}, {0x69,0x323,0x1ECB}, {0x69,0x328,0x12F}, {0x69,0x330,0x1E2D},
+	{0x6A,0x302,0x135}, {0x6A,0x30C,0x1F0}, {0x6B,0x301,0x1E31}, {0x6B,0x30C,0x1E9}, {0x6B,0x323,0x1E33},
+	{0x6B,0x327,0x137}, {0x6B,0x331,0x1E35}, {0x6C,0x301,0x13A}, {0x6C,0x30C,0x13E}, {0x6C,0x323,0x1E37},
+	{0x6C,0x327,0x13C}, {0x6C,0x32D,0x1E3D}, {0x6C,0x331,0x1E3B}, {0x6D,0x301,0x1E3F}, {0x6D,0x307,0x1E41},
+	{0x6D,0x323,0x1E43}, {0x6E,0x300,0x1F9}, {0x6E,0x301,0x144}, {0x6E,0x303,0xF1}, {0x6E,0x307,0x1E45},
+	{0x6E,0x30C,0x148}, {0x6E,0x323,0x1E47}, {0x6E,0x327,0x146}, {0x6E,0x32D,0x1E4B}, {0x6E,0x331,0x1E49},
+	{0x6F,0x300,0xF2}, {0x6F,0x301,0xF3}, {0x6F,0x302,0xF4}, {0x6F,0x303,0xF5}, {0x6F,0x304,0x14D},
+	{0x6F,0x306,0x14F}, {0x6F,0x307,0x22F}, {0x6F,0x308,0xF6}, {0x6F,0x309,0x1ECF}, {0x6F,0x30B,0x151},
+	{0x6F,0x30C,0x1D2}, {0x6F,0x30F,0x20D}, {0x6F,0x311,0x20F}, {0x6F,0x31B,0x1A1}, {0x6F,0x323,0x1ECD},
+	{0x6F,0x328,0x1EB}, {0x70,0x301,0x1E55}, {0x70,0x307,0x1E57}, {0x72,0x301,0x155}, {0x72,0x307,0x1E59},
+	{0x72,0x30C,0x159}, {0x72,0x30F,0x211}, {0x72,0x311,0x213}, {0x72,0x323,0x1E5B}, {0x72,0x327,0x157},
+	{0x72,0x331,0x1E5F}, {0x73,0x301,0x15B}, {0x73,0x302,0x15D}, {0x73,0x307,0x1E61}, {0x73,0x30C,0x161},
+	{0x73,0x323,0x1E63}, {0x73,0x326,0x219}, {0x73,0x327,0x15F}, {0x74,0x307,0x1E6B}, {0x74,0x308,0x1E97},
+	{0x74,0x30C,0x165}, {0x74,0x323,0x1E6D}, {0x74,0x326,0x21B}, {0x74,0x327,0x163}, {0x74,0x32D,0x1E71},
+	{0x74,0x331,0x1E6F}, {0x75,0x300,0xF9}, {0x75,0x301,0xFA}, {0x75,0x302,0xFB}, {0x75,0x303,0x169},
+	{0x75,0x304,0x16B}, {0x75,0x306,0x16D}, {0x75,0x308,0xFC}, {0x75,0x309,0x1EE7}, {0x75,0x30A,0x16F},
+	{0x75,0x30B,0x171}, {0x75,0x30C,0x1D4}, {0x75,0x30F,0x215}, {0x75,0x311,0x217}, {0x75,0x31B,0x1B0},
+	{0x75,0x323,0x1EE5}, {0x75,0x324,0x1E73}, {0x75,0x328,0x173}, {0x75,0x32D,0x1E77}, {0x75,0x330,0x1E75},
+	{0x76,0x303,0x1E7D}, {0x76,0x323,0x1E7F}, {0x77,0x300,0x1E81}, {0x77,0x301,0x1E83}, {0x77,0x302,0x175},
+	{0x77,0x307,0x1E87}, {0x77,0x308,0x1E85}, {0x77,0x30A,0x1E98}, {0x77,0x323,0x1E89}, {0x78,0x307,0x1E8B},
+	{0x78,0x308,0x1E8D}, {0x79,0x300,0x1EF3}, {0x79,0x301,0xFD}, {0x79,0x302,0x177}, {0x79,0x303,0x1EF9},
+	{0x79,0x304,0x233}, {0x79,0x307,0x1E8F}, {0x79,0x308,0xFF}, {0x79,0x309,0x1EF7}, {0x79,0x30A,0x1E99},
+	{0x79,0x323,0x1EF5}, {0x7A,0x301,0x17A}, {0x7A,0x302,0x1E91}, {0x7A,0x307,0x17C}, {0x7A,0x30C,0x17E},
+	{0x7A,0x323,0x1E93}, {0x7A,0x331,0x1E95}, {0xA8,0x300,0x1FED}, {0xA8,0x301,0x385}, {0xA8,0x342,0x1FC1},
+	{0xC2,0x300,0x1EA6}, {0xC2,0x301,0x1EA4}, {0xC2,0x303,0x1EAA}, {0xC2,0x309,0x1EA8}, {0xC4,0x304,0x1DE},
+	{0xC5,0x301,0x1FA}, {0xC6,0x301,0x1FC}, {0xC6,0x304,0x1E2}, {0xC7,0x301,0x1E08}, {0xCA,0x300,0x1EC0},
+	{0xCA,0x301,0x1EBE}, {0xCA,0x303,0x1EC4}, {0xCA,0x309,0x1EC2}, {0xCF,0x301,0x1E2E}, {0xD4,0x300,0x1ED2},
+	{0xD4,0x301,0x1ED0}, {0xD4,0x303,0x1ED6}, {0xD4,0x309,0x1ED4}, {0xD5,0x301,0x1E4C}, {0xD5,0x304,0x22C},
+	{0xD5,0x308,0x1E4E}, {0xD6,0x304,0x22A}, {0xD8,0x301,0x1FE}, {0xDC,0x300,0x1DB}, {0xDC,0x301,0x1D7},
+	{0xDC,0x304,0x1D5}, {0xDC,0x30C,0x1D9}, {0xE2,0x300,0x1EA7}, {0xE2,0x301,0x1EA5}, {0xE2,0x303,0x1EAB},
+	{0xE2,0x309,0x1EA9}, {0xE4,0x304,0x1DF}, {0xE5,0x301,0x1FB}, {0xE6,0x301,0x1FD}, {0xE6,0x304,0x1E3},
+	{0xE7,0x301,0x1E09}, {0xEA,0x300,0x1EC1}, {0xEA,0x301,0x1EBF}, {0xEA,0x303,0x1EC5}, {0xEA,0x309,0x1EC3},
+	{0xEF,0x301,0x1E2F}, {0xF4,0x300,0x1ED3}, {0xF4,0x301,0x1ED1}, {0xF4,0x303,0x1ED7}, {0xF4,0x309,0x1ED5},
+	{0xF5,0x301,0x1E4D}, {0xF5,0x304,0x22D}, {0xF5,0x308,0x1E4F}, {0xF6,0x304,0x22B}, {0xF8,0x301,0x1FF},
+	{0xFC,0x300,0x1DC}, {0xFC,0x301,0x1D8}, {0xFC,0x304,0x1D6}, {0xFC,0x30C,0x1DA}, {0x102,0x300,0x1EB0},
+	{0x102,0x301,0x1EAE}, {0x102,0x303,0x1EB4}, {0x102,0x309,0x1EB2}, {0x103,0x300,0x1EB1}, {0x103,0x301,0x1EAF},
+	{0x103,0x303,0x1EB5}, {0x103,0x309,0x1EB3}, {0x112,0x300,0x1E14}, {0x112,0x301,0x1E16}, {0x113,0x300,0x1E15},
+	{0x113,0x301,0x1E17}, {0x14C,0x300,0x1E50}, {0x14C,0x301,0x1E52}, {0x14D,0x300,0x1E51}, {0x14D,0x301,0x1E53},
+	{0x15A,0x307,0x1E64}, {0x15B,0x307,0x1E65}, {0x160,0x307,0x1E66}, {0x161,0x307,0x1E67}, {0x168,0x301,0x1E78},
+	{0x169,0x301,0x1E79}, {0x16A,0x308,0x1E7A}, {0x16B,0x308,0x1E7B}, {0x17F,0x307,0x1E9B}, {0x1A0,0x300,0x1EDC},
+	{0x1A0,0x301,0x1EDA}, {0x1A0,0x303,0x1EE0}, {0x1A0,0x309,0x1EDE}, {0x1A0,0x323,0x1EE2}, {0x1A1,0x300,0x1EDD},
+	{0x1A1,0x301,0x1EDB}, {0x1A1,0x303,0x1EE1}, {0x1A1,0x309,0x1EDF}, {0x1A1,0x323,0x1EE3}, {0x1AF,0x300,0x1EEA},
+	{0x1AF,0x301,0x1EE8}, {0x1AF,0x303,0x1EEE}, {0x1AF,0x309,0x1EEC}, {0x1AF,0x323,0x1EF0}, {0x1B0,0x300,0x1EEB},
+	{0x1B0,0x301,0x1EE9}, {0x1B0,0x303,0x1EEF}, {0x1B0,0x309,0x1EED}, {0x1B0,0x323,0x1EF1}, {0x1B7,0x30C,0x1EE},
+	{0x1EA,0x304,0x1EC}, {0x1EB,0x304,0x1ED}, {0x226,0x304,0x1E0}, {0x227,0x304,0x1E1}, {0x228,0x306,0x1E1C},
+	{0x229,0x306,0x1E1D}, {0x22E,0x304,0x230}, {0x22F,0x304,0x231}, {0x292,0x30C,0x1EF}, {0x391,0x300,0x1FBA},
+	{0x391,0x301,0x386}, {0x391,0x304,0x1FB9}, {0x391,0x306,0x1FB8}, {0x391,0x313,0x1F08}, {0x391,0x314,0x1F09},
+	{0x391,0x345,0x1FBC}, {0x395,0x300,0x1FC8}, {0x395,0x301,0x388}, {0x395,0x313,0x1F18}, {0x395,0x314,0x1F19},
+	{0x397,0x300,0x1FCA}, {0x397,0x301,0x389}, {0x397,0x313,0x1F28}, {0x397,0x314,0x1F29}, {0x397,0x345,0x1FCC},
+	{0x399,0x300,0x1FDA}, {0x399,0x301,0x38A}, {0x399,0x304,0x1FD9}, {0x399,0x306,0x1FD8}, {0x399,0x308,0x3AA},
+	{0x399,0x313,0x1F38}, {0x399,0x314,0x1F39}, {0x39F,0x300,0x1FF8}, {0x39F,0x301,0x38C}, {0x39F,0x313,0x1F48},
+	{0x39F,0x314,0x1F49}, {0x3A1,0x314,0x1FEC}, {0x3A5,0x300,0x1FEA}, {0x3A5,0x301,0x38E}, {0x3A5,0x304,0x1FE9},
+	{0x3A5,0x306,0x1FE8}, {0x3A5,0x308,0x3AB}, {0x3A5,0x314,0x1F59}, {0x3A9,0x300,0x1FFA}, {0x3A9,0x301,0x38F},
+	{0x3A9,0x313,0x1F68}, {0x3A9,0x314,0x1F69}, {0x3A9,0x345,0x1FFC}, {0x3AC,0x345,0x1FB4}, {0x3AE,0x345,0x1FC4},
+	{0x3B1,0x300,0x1F70}, {0x3B1,0x301,0x3AC}, {0x3B1,0x304,0x1FB1}, {0x3B1,0x306,0x1FB0}, {0x3B1,0x313,0x1F00},
+	{0x3B1,0x314,0x1F01}, {0x3B1,0x342,0x1FB6}, {0x3B1,0x345,0x1FB3}, {0x3B5,0x300,0x1F72}, {0x3B5,0x301,0x3AD},
+	{0x3B5,0x313,0x1F10}, {0x3B5,0x314,0x1F11}, {0x3B7,0x300,0x1F74}, {0x3B7,0x301,0x3AE}, {0x3B7,0x313,0x1F20},
+	{0x3B7,0x314,0x1F21}, {0x3B7,0x342,0x1FC6}, {0x3B7,0x345,0x1FC3}, {0x3B9,0x300,0x1F76}, {0x3B9,0x301,0x3AF},
+	{0x3B9,0x304,0x1FD1}, {0x3B9,0x306,0x1FD0}, {0x3B9,0x308,0x3CA}, {0x3B9,0x313,0x1F30}, {0x3B9,0x314,0x1F31},
+	{0x3B9,0x342,0x1FD6}, {0x3BF,0x300,0x1F78}, {0x3BF,0x301,0x3CC}, {0x3BF,0x313,0x1F40}, {0x3BF,0x314,0x1F41},
+	{0x3C1,0x313,0x1FE4}, {0x3C1,0x314,0x1FE5}, {0x3C5,0x300,0x1F7A}, {0x3C5,0x301,0x3CD}, {0x3C5,0x304,0x1FE1},
+	{0x3C5,0x306,0x1FE0}, {0x3C5,0x308,0x3CB}, {0x3C5,0x313,0x1F50}, {0x3C5,0x314,0x1F51}, {0x3C5,0x342,0x1FE6},
+	{0x3C9,0x300,0x1F7C}, {0x3C9,0x301,0x3CE}, {0x3C9,0x313,0x1F60}, {0x3C9,0x314,0x1F61}, {0x3C9,0x342,0x1FF6},
+	{0x3C9,0x345,0x1FF3}, {0x3CA,0x300,0x1FD2}, {0x3CA,0x301,0x390}, {0x3CA,0x342,0x1FD7}, {0x3CB,0x300,0x1FE2},
+	{0x3CB,0x301,0x3B0}, {0x3CB,0x342,0x1FE7}, {0x3CE,0x345,0x1FF4}, {0x3D2,0x301,0x3D3}, {0x3D2,0x308,0x3D4},
+	{0x406,0x308,0x407}, {0x410,0x306,0x4D0}, {0x410,0x308,0x4D2}, {0x413,0x301,0x403}, {0x415,0x300,0x400},
+	{0x415,0x306,0x4D6}, {0x415,0x308,0x401}, {0x416,0x306,0x4C1}, {0x416,0x308,0x4DC}, {0x417,0x308,0x4DE},
+	{0x418,0x300,0x40D}, {0x418,0x304,0x4E2}, {0x418,0x306,0x419}, {0x418,0x308,0x4E4}, {0x41A,0x301,0x40C},
+	{0x41E,0x308,0x4E6}, {0x423,0x304,0x4EE}, {0x423,0x306,0x40E}, {0x423,0x308,0x4F0}, {0x423,0x30B,0x4F2},
+	{0x427,0x308,0x4F4}, {0x42B,0x308,0x4F8}, {0x42D,0x308,0x4EC}, {0x430,0x306,0x4D1}, {0x430,0x308,0x4D3},
+	{0x433,0x301,0x453}, {0x435,0x300,0x450}, {0x435,0x306,0x4D7}, {0x435,0x308,0x451}, {0x436,0x306,0x4C2},
+	{0x436,0x308,0x4DD}, {0x437,0x308,0x4DF}, {0x438,0x300,0x45D}, {0x438,0x304,0x4E3}, {0x438,0x306,0x439},
+	{0x438,0x308,0x4E5}, {0x43A,0x301,0x45C}, {0x43E,0x308,0x4E7}, {0x443,0x304,0x4EF}, {0x443,0x306,0x45E},
+	{0x443,0x308,0x4F1}, {0x443,0x30B,0x4F3}, {0x447,0x308,0x4F5}, {0x44B,0x308,0x4F9}, {0x44D,0x308,0x4ED},
+	{0x456,0x308,0x457}, {0x474,0x30F,0x476}, {0x475,0x30F,0x477}, {0x4D8,0x308,0x4DA}, {0x4D9,0x308,0x4DB},
+	{0x4E8,0x308,0x4EA}, {0x4E9,0x308,0x4EB}, {0x627,0x653,0x622}, {0x627,0x654,0x623}, {0x627,0x655,0x625},
+	{0x648,0x654,0x624}, {0x64A,0x654,0x626}, {0x6C1,0x654,0x6C2}, {0x6D2,0x654,0x6D3}, {0x6D5,0x654,0x6C0},
+	{0x928,0x93C,0x929}, {0x930,0x93C,0x931}, {0x933,0x93C,0x934}, {0x9C7,0x9BE,0x9CB}, {0x9C7,0x9D7,0x9CC},
+	{0xB47,0xB3E,0xB4B}, {0xB47,0xB56,0xB48}, {0xB47,0xB57,0xB4C}, {0xB92,0xBD7,0xB94}, {0xBC6,0xBBE,0xBCA},
+	{0xBC6,0xBD7,0xBCC}, {0xBC7,0xBBE,0xBCB}, {0xC46,0xC56,0xC48}, {0xCBF,0xCD5,0xCC0}, {0xCC6,0xCC2,0xCCA},
+	{0xCC6,0xCD5,0xCC7}, {0xCC6,0xCD6,0xCC8}, {0xCCA,0xCD5,0xCCB}, {0xD46,0xD3E,0xD4A}, {0xD46,0xD57,0xD4C},
+	{0xD47,0xD3E,0xD4B}, {0xDD9,0xDCA,0xDDA}, {0xDD9,0xDCF,0xDDC}, {0xDD9,0xDDF,0xDDE}, {0xDDC,0xDCA,0xDDD},
+	{0x1025,0x102E,0x1026}, {0x1B05,0x1B35,0x1B06}, {0x1B07,0x1B35,0x1B08}, {0x1B09,0x1B35,0x1B0A}, {0x1B0B,0x1B35,0x1B0C},
+	{0x1B0D,0x1B35,0x1B0E}, {0x1B11,0x1B35,0x1B12}, {0x1B3A,0x1B35,0x1B3B}, {0x1B3C,0x1B35,0x1B3D}, {0x1B3E,0x1B35,0x1B40},
+	{0x1B3F,0x1B35,0x1B41}, {0x1B42,0x1B35,0x1B43}, {0x1E36,0x304,0x1E38}, {0x1E37,0x304,0x1E39}, {0x1E5A,0x304,0x1E5C},
+	{0x1E5B,0x304,0x1E5D}, {0x1E62,0x307,0x1E68}, {0x1E63,0x307,0x1E69}, {0x1EA0,0x302,0x1EAC}, {0x1EA0,0x306,0x1EB6},
+	{0x1EA1,0x302,0x1EAD}, {0x1EA1,0x306,0x1EB7}, {0x1EB8,0x302,0x1EC6}, {0x1EB9,0x302,0x1EC7}, {0x1ECC,0x302,0x1ED8},
+	{0x1ECD,0x302,0x1ED9}, {0x1F00,0x300,0x1F02}, {0x1F00,0x301,0x1F04}, {0x1F00,0x342,0x1F06}, {0x1F00,0x345,0x1F80},
+	{0x1F01,0x300,0x1F03}, {0x1F01,0x301,0x1F05}, {0x1F01,0x342,0x1F07}, {0x1F01,0x345,0x1F81}, {0x1F02,0x345,0x1F82},
+	{0x1F03,0x345,0x1F83}, {0x1F04,0x345,0x1F84}, {0x1F05,0x345,0x1F85}, {0x1F06,0x345,0x1F86}, {0x1F07,0x345,0x1F87},
+	{0x1F08,0x300,0x1F0A}, {0x1F08,0x301,0x1F0C}, {0x1F08,0x342,0x1F0E}, {0x1F08,0x345,0x1F88}, {0x1F09,0x300,0x1F0B},
+	{0x1F09,0x301,0x1F0D}, {0x1F09,0x342,0x1F0F}, {0x1F09,0x345,0x1F89}, {0x1F0A,0x345,0x1F8A}, {0x1F0B,0x345,0x1F8B},
+	{0x1F0C,0x345,0x1F8C}, {0x1F0D,0x345,0x1F8D}, {0x1F0E,0x345,0x1F8E}, {0x1F0F,0x345,0x1F8F}, {0x1F10,0x300,0x1F12},
+	{0x1F10,0x301,0x1F14}, {0x1F11,0x300,0x1F13}, {0x1F11,0x301,0x1F15}, {0x1F18,0x300,0x1F1A}, {0x1F18,0x301,0x1F1C},
+	{0x1F19,0x300,0x1F1B}, {0x1F19,0x301,0x1F1D}, {0x1F20,0x300,0x1F22}, {0x1F20,0x301,0x1F24}, {0x1F20,0x342,0x1F26},
+	{0x1F20,0x345,0x1F90}, {0x1F21,0x300,0x1F23}, {0x1F21,0x301,0x1F25}, {0x1F21,0x342,0x1F27}, {0x1F21,0x345,0x1F91},
+	{0x1F22,0x345,0x1F92}, {0x1F23,0x345,0x1F93}, {0x1F24,0x345,0x1F94}, {0x1F25,0x345,0x1F95}, {0x1F26,0x345,0x1F96},
+	{0x1F27,0x345,0x1F97}, {0x1F28,0x300,0x1F2A}, {0x1F28,0x301,0x1F2C}, {0x1F28,0x342,0x1F2E}, {0x1F28,0x345,0x1F98},
+	{0x1F29,0x300,0x1F2B}, {0x1F29,0x301,0x1F2D}, {0x1F29,0x342,0x1F2F}, {0x1F29,0x345,0x1F99}, {0x1F2A,0x345,0x1F9A},
+	{0x1F2B,0x345,0x1F9B}, {0x1F2C,0x345,0x1F9C}, {0x1F2D,0x345,0x1F9D}, {0x1F2E,0x345,0x1F9E}, {0x1F2F,0x345,0x1F9F},
+	{0x1F30,0x300,0x1F32}, {0x1F30,0x301,0x1F34}, {0x1F30,0x342,0x1F36}, {0x1F31,0x300,0x1F33}, {0x1F31,0x301,0x1F35},
+	{0x1F31,0x342,0x1F37}, {0x1F38,0x300,0x1F3A}, {0x1F38,0x301,0x1F3C}, {0x1F38,0x342,0x1F3E}, {0x1F39,0x300,0x1F3B},
+	{0x1F39,0x301,0x1F3D}, {0x1F39,0x342,0x1F3F}, {0x1F40,0x300,0x1F42}, {0x1F40,0x301,0x1F44}, {0x1F41,0x300,0x1F43},
+	{0x1F41,0x301,0x1F45}, {0x1F48,0x300,0x1F4A}, {0x1F48,0x301,0x1F4C}, {0x1F49,0x300,0x1F4B}, {0x1F49,0x301,0x1F4D},
+	{0x1F50,0x300,0x1F52}, {0x1F50,0x301,0x1F54}, {0x1F50,0x342,0x1F56}, {0x1F51,0x300,0x1F53}, {0x1F51,0x301,0x1F55},
+	{0x1F51,0x342,0x1F57}, {0x1F59,0x300,0x1F5B}, {0x1F59,0x301,0x1F5D}, {0x1F59,0x342,0x1F5F}, {0x1F60,0x300,0x1F62},
+	{0x1F60,0x301,0x1F64}, {0x1F60,0x342,0x1F66}, {0x1F60,0x345,0x1FA0}, {0x1F61,0x300,0x1F63}, {0x1F61,0x301,0x1F65},
+	{0x1F61,0x342,0x1F67}, {0x1F61,0x345,0x1FA1}, {0x1F62,0x345,0x1FA2}, {0x1F63,0x345,0x1FA3}, {0x1F64,0x345,0x1FA4},
+	{0x1F65,0x345,0x1FA5}, {0x1F66,0x345,0x1FA6}, {0x1F67,0x345,0x1FA7}, {0x1F68,0x300,0x1F6A}, {0x1F68,0x301,0x1F6C},
+	{0x1F68,0x342,0x1F6E}, {0x1F68,0x345,0x1FA8}, {0x1F69,0x300,0x1F6B}, {0x1F69,0x301,0x1F6D}, {0x1F69,0x342,0x1F6F},
+	{0x1F69,0x345,0x1FA9}, {0x1F6A,0x345,0x1FAA}, {0x1F6B,0x345,0x1FAB}, {0x1F6C,0x345,0x1FAC}, {0x1F6D,0x345,0x1FAD},
+	{0x1F6E,0x345,0x1FAE}, {0x1F6F,0x345,0x1FAF}, {0x1F70,0x345,0x1FB2}, {0x1F74,0x345,0x1FC2}, {0x1F7C,0x345,0x1FF2},
+	{0x1FB6,0x345,0x1FB7}, {0x1FBF,0x300,0x1FCD}, {0x1FBF,0x301,0x1FCE}, {0x1FBF,0x342,0x1FCF}, {0x1FC6,0x345,0x1FC7},
+	{0x1FF6,0x345,0x1FF7}, {0x1FFE,0x300,0x1FDD}, {0x1FFE,0x301,0x1FDE}, {0x1FFE,0x342,0x1FDF}, {0x2190,0x338,0x219A},
+	{0x2192,0x338,0x219B}, {0x2194,0x338,0x21AE}, {0x21D0,0x338,0x21CD}, {0x21D2,0x338,0x21CF}, {0x21D4,0x338,0x21CE},
+	{0x2203,0x338,0x2204}, {0x2208,0x338,0x2209}, {0x220B,0x338,0x220C}, {0x2223,0x338,0x2224}, {0x2225,0x338,0x2226},
+	{0x223C,0x338,0x2241}, {0x2243,0x338,0x2244}, {0x2245,0x338,0x2247}, {0x2248,0x338,0x2249}, {0x224D,0x338,0x226D},
+	{0x2261,0x338,0x2262}, {0x2264,0x338,0x2270}, {0x2265,0x338,0x2271}, {0x2272,0x338,0x2274}, {0x2273,0x338,0x2275},
+	{0x2276,0x338,0x2278}, {0x2277,0x338,0x2279}, {0x227A,0x338,0x2280}, {0x227B,0x338,0x2281}, {0x227C,0x338,0x22E0},
+	{0x227D,0x338,0x22E1}, {0x2282,0x338,0x2284}, {0x2283,0x338,0x2285}, {0x2286,0x338,0x2288}, {0x2287,0x338,0x2289},
+	{0x2291,0x338,0x22E2}, {0x2292,0x338,0x22E3}, {0x22A2,0x338,0x22AC}, {0x22A8,0x338,0x22AD}, {0x22A9,0x338,0x22AE},
+	{0x22AB,0x338,0x22AF}, {0x22B2,0x338,0x22EA}, {0x22B3,0x338,0x22EB}, {0x22B4,0x338,0x22EC}, {0x22B5,0x338,0x22ED},
+	{0x3046,0x3099,0x3094}, {0x304B,0x3099,0x304C}, {0x304D,0x3099,0x304E}, {0x304F,0x3099,0x3050}, {0x3051,0x3099,0x3052},
+	{0x3053,0x3099,0x3054}, {0x3055,0x3099,0x3056}, {0x3057,0x3099,0x3058}, {0x3059,0x3099,0x305A}, {0x305B,0x3099,0x305C},
+	{0x305D,0x3099,0x305E}, {0x305F,0x3099,0x3060}, {0x3061,0x3099,0x3062}, {0x3064,0x3099,0x3065}, {0x3066,0x3099,0x3067},
+	{0x3068,0x3099,0x3069}, {0x306F,0x3099,0x3070}, {0x306F,0x309A,0x3071}, {0x3072,0x3099,0x3073}, {0x3072,0x309A,0x3074},
+	{0x3075,0x3099,0x3076}, {0x3075,0x309A,0x3077}, {0x3078,0x3099,0x3079}, {0x3078,0x309A,0x307A}, {0x307B,0x3099,0x307C},
+	{0x307B,0x309A,0x307D}, {0x309D,0x3099,0x309E}, {0x30A6,0x3099,0x30F4}, {0x30AB,0x3099,0x30AC}, {0x30AD,0x3099,0x30AE},
+	{0x30AF,0x3099,0x30B0}, {0x30B1,0x3099,0x30B2}, {0x30B3,0x3099,0x30B4}, {0x30B5,0x3099,0x30B6}, {0x30B7,0x3099,0x30B8},
+	{0x30B9,0x3099,0x30BA}, {0x30BB,0x3099,0x30BC}, {0x30BD,0x3099,0x30BE}, {0x30BF,0x3099,0x30C0}, {0x30C1,0x3099,0x30C2},
+	{0x30C4,0x3099,0x30C5}, {0x30C6,0x3099,0x30C7}, {0x30C8,0x3099,0x30C9}, {0x30CF,0x3099,0x30D0}, {0x30CF,0x309A,0x30D1},
+	{0x30D2,0x3099,0x30D3}, {0x30D2,0x309A,0x30D4}, {0x30D5,0x3099,0x30D6}, {0x30D5,0x309A,0x30D7}, {0x30D8,0x3099,0x30D9},
+	{0x30D8,0x309A,0x30DA}, {0x30DB,0x3099,0x30DC}, {0x30DB,0x309A,0x30DD}, {0x30EF,0x3099,0x30F7}, {0x30F0,0x3099,0x30F8},
+	{0x30F1,0x3099,0x30F9}, {0x30F2,0x3099,0x30FA}, {0x30FD,0x3099,0x30FE}, {0x11099,0x110BA,0x1109A}, {0x1109B,0x110BA,0x1109C},
+	{0x110A5,0x110BA,0x110AB}, {0x11131,0x11127,0x1112E}, {0x11132,0x11127,0x1112F}, {0x11347,0x1133E,0x1134B}, {0x11347,0x11357,0x1134C},
+	{0x114B9,0x114B0,0x114BC}, {0x114B9,0x114BA,0x114BB}, {0x114B9,0x114BD,0x114BE}, {0x115B8,0x115AF,0x115BA}, {0x115B9,0x115AF,0x115BB},
+	{0x11935,0x11930,0x11938},
+};
+
+// code point, its case folding
+static const unsigned int FOLD_SINGLE[][2] = {
+	{0x41,0x61}, {0x42,0x62}, {0x43,0x63}, {0x44,0x64}, {0x45,0x65}, {0x46,0x66}, {0x47,0x67}, {0x48,0x68},
+	{0x49,0x69}, {0x4A,0x6A}, {0x4B,0x6B}, {0x4C,0x6C}, {0x4D,0x6D}, {0x4E,0x6E}, {0x4F,0x6F}, {0x50,0x70},
+	{0x51,0x71}, {0x52,0x72}, {0x53,0x73}, {0x54,0x74}, {0x55,0x75}, {0x56,0x76}, {0x57,0x77}, {0x58,0x78},
+	{0x59,0x79}, {0x5A,0x7A}, {0xB5,0x3BC}, {0xC0,0xE0}, {0xC1,0xE1}, {0xC2,0xE2}, {0xC3,0xE3}, {0xC4,0xE4},
+	{0xC5,0xE5}, {0xC6,0xE6}, {0xC7,0xE7}, {0xC8,0xE8}, {0xC9,0xE9}, {0xCA,0xEA}, {0xCB,0xEB}, {0xCC,0xEC},
+	{0xCD,0xED}, {0xCE,0xEE}, {0xCF,0xEF}, {0xD0,0xF0}, {0xD1,0xF1}, {0xD2,0xF2}, {0xD3,0xF3}, {0xD4,0xF4},
+	{0xD5,0xF5}, {0xD6,0xF6}, {0xD8,0xF8}, {0xD9,0xF9}, {0xDA,0xFA}, {0xDB,0xFB}, {0xDC,0xFC}, {0xDD,0xFD},
+	{0xDE,0xFE}, {0x100,0x101}, {0x102,0x103}, {0x104,0x105}, {0x106,0x107}, {0x108,0x109}, {0x10A,0x10B}, {0x10C,0x10D},
+	{0x10E,0x10F}, {0x110,0x111}, {0x112,0x113}, {0x114,0x115}, {0x116,0x117}, {0x118,0x119}, {0x11A,0x11B}, {0x11C,0x11D},
+	{0x11E,0x11F}, {0x120,0x121}, {0x122,0x123}, {0x124,0x125}, {0x126,0x127}, {0x128,0x129}, {0x12A,0x12B}, {0x12C,0x12D},
+	{0x12E,0x12F}, {0x132,0x133}, {0x134,0x135}, {0x136,0x137}, {0x139,0x13A}, {0x13B,0x13C}, {0x13D,0x13E}, {0x13F,0x140},
+	{0x141,0x142}, {0x143,0x144}, {0x145,0x146}, {0x147,0x148}, {0x14A,0x14B}, {0x14C,0x14D}, {0x14E,0x14F}, {0x150,0x151},
+	{0x152,0x153}, {0x154,0x155}, {0x156,0x157}, {0x158,0x159}, {0x15A,0x15B}, {0x15C,0x15D}, {0x15E,0x15F}, {0x160,0x161},
+	{0x162,0x163}, {0x164,0x165}, {0x166,0x167}, {0x168,0x169}, {0x16A,0x16B}, {0x16C,0x16D}, {0x16E,0x16F}, {0x170,0x171},
+	{0x172,0x173}, {0x174,0x175}, {0x176,0x177}, {0x178,0xFF}, {0x179,0x17A}, {0x17B,0x17C}, {0x17D,0x17E}, {0x17F,0x73},
+	{0x181,0x253}, {0x182,0x183}, {0x184,0x185}, {0x186,0x254}, {0x187,0x188}, {0x189,0x256}, {0x18A,0x257}, {0x18B,0x18C},
+	{0x18E,0x1DD}, {0x18F,0x259}, {0x190,0x25B}, {0x191,0x192}, {0x193,0x260}, {0x194,0x263}, {0x196,0x269}, {0x197,0x268},
+	{0x198,0x199}, {0x19C,0x26F}, {0x19D,0x272}, {0x19F,0x275}, {0x1A0,0x1A1}, {0x1A2,0x1A3}, {0x1A4,0x1A5}, {0x1A6,0x280},
+	{0x1A7,0x1A8}, {0x1A9,0x283}, {0x1AC,0x1AD}, {0x1AE,0x288}, {0x1AF,0x1B0}, {0x1B1,0x28A}, {0x1B2,0x28B}, {0x1B3,0x1B4},
+	{0x1B5,0x1B6}, {0x1B7,0x292}, {0x1B8,0x1B9}, {0x1BC,0x1BD}, {0x1C4,0x1C6}, {0x1C5,0x1C6}, {0x1C7,0x1C9}, {0x1C8,0x1C9},
+	{0x1CA,0x1CC}, {0x1CB,0x1CC}, {0x1CD,0x1CE}, {0x1CF,0x1D0}, {0x1D1,0x1D2}, {0x1D3,0x1D4}, {0x1D5,0x1D6}, {0x1D7,0x1D8},
+	{0x1D9,0x1DA}, {0x1DB,0x1DC}, {0x1DE,0x1DF}, {0x1E0,0x1E1}, {0x1E2,0x1E3}, {0x1E4,0x1E5}, {0x1E6,0x1E7}, {0x1E8,0x1E9},
+	{0x1EA,0x1EB}, {0x1EC,0x1ED}, {0x1EE,0x1EF}, {0x1F1,0x1F3}, {0x1F2,0x1F3}, {0x1F4,0x1F5}, {0x1F6,0x195}, {0x1F7,0x1BF},
+	{0x1F8,0x1F9}, {0x1FA,0x1FB}, {0x1FC,0x1FD}, {0x1FE,0x1FF}, {0x200,0x201}, {0x202,0x203}, {0x204,0x205}, {0x206,0x207},
+	{0x208,0x209}, {0x20A,0x20B}, {0x20C,0x20D}, {0x20E,0x20F}, {0x210,0x211}, {0x212,0x213}, {0x214,0x215}, {0x216,0x217},
+	{0x218,0x219}, {0x21A,0x21B}, {0x21C,0x21D}, {0x21E,0x21F}, {0x220,0x19E}, {0x222,0x223}, {0x224,0x225}, {0x226,0x227},
+	{0x228,0x229}, {0x22A,0x22B}, {0x22C,0x22D}, {0x22E,0x22F}, {0x230,0x231}, {0x232,0x233}, {0x23A,0x2C65}, {0x23B,0x23C},
+	{0x23D,0x19A}, {0x23E,0x2C66}, {0x241,0x242}, {0x243,0x180}, {0x244,0x289}, {0x245,0x28C}, {0x246,0x247}, {0x248,0x249},
+	{0x24A,0x24B}, {0x24C,0x24D}, {0x24E,0x24F}, {0x345,0x3B9}, {0x370,0x371}, {0x372,0x373}, {0x376,0x377}, {0x37F,0x3F3},
+	{0x386,0x3AC}, {0x388,0x3AD}, {0x389,0x3AE}, {0x38A,0x3AF}, {0x38C,0x3CC}, {0x38E,0x3CD}, {0x38F,0x3CE}, {0x391,0x3B1},
+	{0x392,0x3B2}, {0x393,0x3B3}, {0x394,0x3B4}, {0x395,0x3B5}, {0x396,0x3B6}, {0x397,0x3B7}, {0x398,0x3B8}, {0x399,0x3B9},
+	{0x39A,0x3BA}, {0x39B,0x3BB}, {0x39C,0x3BC}, {0x39D,0x3BD}, {0x39E,0x3BE}, {0x39F,0x3BF}, {0x3A0,0x3C0}, {0x3A1,0x3C1},
+	{0x3A3,0x3C3}, {0x3A4,0x3C4}, {0x3A5,0x3C5}, {0x3A6,0x3C6}, {0x3A7,0x3C7}, {0x3A8,0x3C8}, {0x3A9,0x3C9}, {0x3AA,0x3CA},
+	{0x3AB,0x3CB}, {0x3C2,0x3C3}, {0x3CF,0x3D7}, {0x3D0,0x3B2}, {0x3D1,0x3B8}, {0x3D5,0x3C6}, {0x3D6,0x3C0}, {0x3D8,0x3D9},
+	{0x3DA,0x3DB}, {0x3DC,0x3DD}, {0x3DE,0x3DF}, {0x3E0,0x3E1}, {0x3E2,0x3E3}, {0x3E4,0x3E5}, {0x3E6,0x3E7}, {0x3E8,0x3E9},
+	{0x3EA,0x3EB}, {0x3EC,0x3ED}, {0x3EE,0x3EF}, {0x3F0,0x3BA}, {0x3F1,0x3C1}, {0x3F4,0x3B8}, {0x3F5,0x3B5}, {0x3F7,0x3F8},
+	{0x3F9,0x3F2}, {0x3FA,0x3FB}, {0x3FD,0x37B}, {0x3FE,0x37C}, {0x3FF,0x37D}, {0x400,0x450}, {0x401,0x451}, {0x402,0x452},
+	{0x403,0x453}, {0x404,0x454}, {0x405,0x455}, {0x406,0x456}, {0x407,0x457}, {0x408,0x458}, {0x409,0x459}, {0x40A,0x45A},
+	{0x40B,0x45B}, {0x40C,0x45C}, {0x40D,0x45D}, {0x40E,0x45E}, {0x40F,0x45F}, {0x410,0x430}, {0x411,0x431}, {0x412,0x432},
+	{0x413,0x433}, {0x414,0x434}, {0x415,0x435}, {0x416,0x436}, {0x417,0x437}, {0x418,0x438}, {0x419,0x439}, {0x41A,0x43A},
+	{0x41B,0x43B}, {0x41C,0x43C}, {0x41D,0x43D}, {0x41E,0x43E}, {0x41F,0x43F}, {0x420,0x440}, {0x421,0x441}, {0x422,0x442},
+	{0x423,0x443}, {0x424,0x444}, {0x425,0x445}, {0x426,0x446}, {0x427,0x447}, {0x428,0x448}, {0x429,0x449}, {0x42A,0x44A},
+	{0x42B,0x44B}, {0x42C,0x44C}, {0x42D,0x44D}, {0x42E,0x44E}, {0x42F,0x44F}, {0x460,0x461}, {0x462,0x463}, {0x464,0x465},
+	{0x466,0x467}, {0x468,0x469}, {0x46A,0x46B}, {0x46C,0x46D}, {0x46E,0x46F}, {0x470,0x471}, {0x472,0x473}, {0x474,0x475},
+	{0x476,0x477}, {0x478,0x479}, {0x47A,0x47B}, {0x47C,0x47D}, {0x47E,0x47F}, {0x480,0x481}, {0x48A,0x48B}, {0x48C,0x48D},
+	{0x48E,0x48F}, {0x490,0x491}, {0x492,0x493}, {0x494,0x495}, {0x496,0x497}, {0x498,0x499}, {0x49A,0x49B}, {0x49C,0x49D},
+	{0x49E,0x49F}, {0x4A0,0x4A1}, {0x4A2,0x4A3}, {0x4A4,0x4A5}, {0x4A6,0x4A7}, {0x4A8,0x4A9}, {0x4AA,0x4AB}, {0x4AC,0x4AD},
+	{0x4AE,0x4AF}, {0x4B0,0x4B1}, {0x4B2,0x4B3}, {0x4B4,0x4B5}, {0x4B6,0x4B7}, {0x4B8,0x4B9}, {0x4BA,0x4BB}, {0x4BC,0x4BD},
+	{0x4BE,0x4BF}, {0x4C0,0x4CF}, {0x4C1,0x4C2}, {0x4C3,0x4C4}, {0x4C5,0x4C6}, {0x4C7,0x4C8}, {0x4C9,0x4CA}, {0x4CB,0x4CC},
+	{0x4CD,0x4CE}, {0x4D0,0x4D1}, {0x4D2,0x4D3}, {0x4D4,0x4D5}, {0x4D6,0x4D7}, {0x4D8,0x4D9}, {0x4DA,0x4DB}, {0x4DC,0x4DD},
+	{0x4DE,0x4DF}, {0x4E0,0x4E1}, {0x4E2,0x4E3}, {0x4E4,0x4E5}, {0x4E6,0x4E7}, {0x4E8,0x4E9}, {0x4EA,0x4EB}, {0x4EC,0x4ED},
+	{0x4EE,0x4EF}, {0x4F0,0x4F1}, {0x4F2,0x4F3}, {0x4F4,0x4F5}, {0x4F6,0x4F7}, {0x4F8,0x4F9}, {0x4FA,0x4FB}, {0x4FC,0x4FD},
+	{0x4FE,0x4FF}, {0x500,0x501}, {0x502,0x503}, {0x504,0x505}, {0x506,0x507}, {0x508,0x509}, {0x50A,0x50B}, {0x50C,0x50D},
+	{0x50E,0x50F}, {0x510,0x511}, {0x512,0x513}, {0x514,0x515}, {0x516,0x517}, {0x518,0x519}, {0x51A,0x51B}, {0x51C,0x51D},
+	{0x51E,0x51F}, {0x520,0x521}, {0x522,0x523}, {0x524,0x525}, {0x526,0x527}, {0x528,0x529}, {0x52A,0x52B}, {0x52C,0x52D},
+	{0x52E,0x52F}, {0x531,0x561}, {0x532,0x562}, {0x533,0x563}, {0x534,0x564}, {0x535,0x565}, {0x536,0x566}, {0x537,0x567},
+	{0x538,0x568}, {0x539,0x569}, {0x53A,0x56A}, {0x53B,0x56B}, {0x53C,0x56C}, {0x53D,0x56D}, {0x53E,0x56E}, {0x53F,0x56F},
+	{0x540,0x570}, {0x541,0x571}, {0x542,0x572}, {0x543,0x573}, {0x544,0x574}, {0x545,0x575}, {0x546,0x576}, {0x547,0x577},
+	{0x548,0x578}, {0x549,0x579}, {0x54A,0x57A}, {0x54B,0x57B}, {0x54C,0x57C}, {0x54D,0x57D}, {0x54E,0x57E}, {0x54F,0x57F},
+	{0x550,0x580}, {0x551,0x581}, {0x552,0x582}, {0x553,0x583}, {0x554,0x584}, {0x555,0x585}, {0x556,0x586}, {0x10A0,0x2D00},
+	{0x10A1,0x2D01}, {0x10A2,0x2D02}, {0x10A3,0x2D03}, {0x10A4,0x2D04}, {0x10A5,0x2D05}, {0x10A6,0x2D06}, {0x10A7,0x2D07}, {0x10A8,0x2D08},
+	{0x10A9,0x2D09}, {0x10AA,0x2D0A}, {0x10AB,0x2D0B}, {0x10AC,0x2D0C}, {0x10AD,0x2D0D}, {0x10AE,0x2D0E}, {0x10AF,0x2D0F}, {0x10B0,0x2D10},
+	{0x10B1,0x2D11}, {0x10B2,0x2D12}, {0x10B3,0x2D13}, {0x10B4,0x2D14}, {0x10B5,0x2D15}, {0x10B6,0x2D16}, {0x10B7,0x2D17}, {0x10B8,0x2D18},
+	{0x10B9,0x2D19}, {0x10BA,0x2D1A}, {0x10BB,0x2D1B}, {0x10BC,0x2D1C}, {0x10BD,0x2D1D}, {0x10BE,0x2D1E}, {0x10BF,0x2D1F}, {0x10C0,0x2D20},
+	{0x10C1,0x2D21}, {0x10C2,0x2D22}, {0x10C3,0x2D23}, {0x10C4,0x2D24}, {0x10C5,0x2D25}, {0x10C7,0x2D27}, {0x10CD,0x2D2D}, {0x13F8,0x13F0},
+	{0x13F9,0x13F1}, {0x13FA,0x13F2}, {0x13FB,0x13F3}, {0x13FC,0x13F4}, {0x13FD,0x13F5}, {0x1C80,0x432}, {0x1C81,0x434}, {0x1C82,0x43E},
+	{0x1C83,0x441}, {0x1C84,0x442}, {0x1C85,0x442}, {0x1C86,0x44A}, {0x1C87,0x463}, {0x1C88,0xA64B}, {0x1C90,0x10D0}, {0x1C91,0x10D1},
+	{0x1C92,0x10D2}, {0x1C93,0x10D3}, {0x1C94,0x10D4}, {0x1C95,0x10D5}, {0x1C96,0x10D6}, {0x1C97,0x10D7}, {0x1C98,0x10D8}, {0x1C99,0x10D9},
+	{0x1C9A,0x10DA}, {0x1C9B,0x10DB}, {0x1C9C,0x10DC}, {0x1C9D,0x10DD}, {0x1C9E,0x10DE}, {0x1C9F,0x10DF}, {0x1CA0,0x10E0}, {0x1CA1,0x10E1},
+	{0x1CA2,0x10E2}, {0x1CA3,0x10E3}, {0x1CA4,0x10E4}, {0x1CA5,0x10E5}, {0x1CA6,0x10E6}, {0x1CA7,0x10E7}, {0x1CA8,0x10E8}, {0x1CA9,0x10E9},
+	{0x1CAA,0x10EA}, {0x1CAB,0x10EB}, {0x1CAC,0x10EC}, {0x1CAD,0x10ED}, {0x1CAE,0x10EE}, {0x1CAF,0x10EF}, {0x1CB0,0x10F0}, {0x1CB1,0x10F1},
+	{0x1CB2,0x10F2}, {0x1CB3,0x10F3}, {0x1CB4,0x10F4}, {0x1CB5,0x10F5}, {0x1CB6,0x10F6}, {0x1CB7,0x10F7}, {0x1CB8,0x10F8}, {0x1CB9,0x10F9},
+	{0x1CBA,0x10FA}, {0x1CBD,0x10FD}, {0x1CBE,0x10FE}, {0x1CBF,0x10FF}, {0x1E00,0x1E01}, {0x1E02,0x1E03}, {0x1E04,0x1E05}, {0x1E06,0x1E07},
+	{0x1E08,0x1E09}, {0x1E0A,0x1E0B}, {0x1E0C,0x1E0D}, {0x1E0E,0x1E0F}, {0x1E10,0x1E11}, {0x1E12,0x1E13}, {0x1E14,0x1E15}, {0x1E16,0x1E17},
+	{0x1E18,0x1E19}, {0x1E1A,0x1E1B}, {0x1E1C,0x1E1D}, {0x1E1E,0x1E1F}, {0x1E20,0x1E21}, {0x1E22,0x1E23}, {0x1E24,0x1E25}, {0x1E26,0x1E27},
+	{0x1E28,0x1E29}, {0x1E2A,0x1E2B}, {0x1E2C,0x1E2D}, {0x1E2E,0x1E2F}, {0x1E30,0x1E31}, {0x1E32,0x1E33}, {0x1E34,0x1E35}, {0x1E36,0x1E37},
+	{0x1E38,0x1E39}, {0x1E3A,0x1E3B}, {0x1E3C,0x1E3D}, {0x1E3E,0x1E3F}, {0x1E40,0x1E41}, {0x1E42,0x1E43}, {0x1E44,0x1E45}, {0x1E46,0x1E47},
+	{0x1E48,0x1E49}, {0x1E4A,0x1E4B}, {0x1E4C,0x1E4D}, {0x1E4E,0x1E4F}, {0x1E50,0x1E51}, {0x1E52,0x1E53}, {0x1E54,0x1E55}, {0x1E56,0x1E57},
+	{0x1E58,0x1E59}, {0x1E5A,0x1E5B}, {0x1E5C,0x1E5D}, {0x1E5E,0x1E5F}, {0x1E60,0x1E61}, {0x1E62,0x1E63}, {0x1E64,0x1E65}, {0x1E66,0x1E67},
+	{0x1E68,0x1E69}, {0x1E6A,0x1E6B}, {0x1E6C,0x1E6D}, {0x1E6E,0x1E6F}, {0x1E70,0x1E71}, {0x1E72,0x1E73}, {0x1E74,0x1E75}, {0x1E76,0x1E77},
+	{0x1E78,0x1E79}, {0x1E7A,0x1E7B}, {0x1E7C,0x1E7D}, {0x1E7E,0x1E7F}, {0x1E80,0x1E81}, {0x1E82,0x1E83}, {0x1E84,0x1E85}, {0x1E86,0x1E87},
+	{0x1E88,0x1E89}, {0x1E8A,0x1E8B}, {0x1E8C,0x1E8D}, {0x1E8E,0x1E8F}, {0x1E90,0x1E91}, {0x1E92,0x1E93}, {0x1E94,0x1E95}, {0x1E9B,0x1E61},
+	{0x1EA0,0x1EA1}, {0x1EA2,0x1EA3}, {0x1EA4,0x1EA5}, {0x1EA6,0x1EA7}, {0x1EA8,0x1EA9}, {0x1EAA,0x1EAB}, {0x1EAC,0x1EAD}, {0x1EAE,0x1EAF},
+	{0x1EB0,0x1EB1}, {0x1EB2,0x1EB3}, {0x1EB4,0x1EB5}, {0x1EB6,0x1EB7}, {0x1EB8,0x1EB9}, {0x1EBA,0x1EBB}, {0x1EBC,0x1EBD}, {0x1EBE,0x1EBF},
+	{0x1EC0,0x1EC1}, {0x1EC2,0x1EC3}, {0x1EC4,0x1EC5}, {0x1EC6,0x1EC7}, {0x1EC8,0x1EC9}, {0x1ECA,0x1ECB}, {0x1ECC,0x1ECD}, {0x1ECE,0x1ECF},
+	{0x1ED0,0x1ED1}, {0x1ED2,0x1ED3}, {0x1ED4,0x1ED5}, {0x1ED6,0x1ED7}, {0x1ED8,0x1ED9}, {0x1EDA,0x1EDB}, {0x1EDC,0x1EDD}, {0x1EDE,0x1EDF},
+	{0x1EE0,0x1EE1}, {0x1EE2,0x1EE3}, {0x1EE4,0x1EE5}, {0x1EE6,0x1EE7}, {0x1EE8,0x1EE9}, {0x1EEA,0x1EEB}, {0x1EEC,0x1EED}, {0x1EEE,0x1EEF},
+	{0x1EF0,0x1EF1}, {0x1EF2,0x1EF3}, {0x1EF4,0x1EF5}, {0x1EF6,0x1EF7}, {0x1EF8,0x1EF9}, {0x1EFA,0x1EFB}, {0x1EFC,0x1EFD}, {0x1EFE,0x1EFF},
+	{0x1F08,0x1F00}, {0x1F09,0x1F01}, {0x1F0A,0x1F02}, {0x1F0B,0x1F03}, {0x1F0C,0x1F04}, {0x1F0D,0x1F05}, {0x1F0E,0x1F06}, {0x1F0F,0x1F07},
+	{0x1F18,0x1F10}, {0x1F19,0x1F11}, {0x1F1A,0x1F12}, {0x1F1B,0x1F13}, {0x1F1C,0x1F14}, {0x1F1D,0x1F15}, {0x1F28,0x1F20}, {0x1F29,0x1F21},
+	{0x1F2A,0x1F22}, {0x1F2B,0x1F23}, {0x1F2C,0x1F24}, {0x1F2D,0x1F25}, {0x1F2E,0x1F26}, {0x1F2F,0x1F27}, {0x1F38,0x1F30}, {0x1F39,0x1F31},
+	{0x1F3A,0x1F32}, {0x1F3B,0x1F33}, {0x1F3C,0x1F34}, {0x1F3D,0x1F35}, {0x1F3E,0x1F36}, {0x1F3F,0x1F37}, {0x1F48,0x1F40}, {0x1F49,0x1F41},
+	{0x1F4A,0x1F42}, {0x1F4B,0x1F43}, {0x1F4C,0x1F44}, {0x1F4D,0x1F45}, {0x1F59,0x1F51}, {0x1F5B,0x1F53}, {0x1F5D,0x1F55}, {0x1F5F,0x1F57},
+	{0x1F68,0x1F60}, {0x1F69,0x1F61}, {0x1F6A,0x1F62}, {0x1F6B,0x1F63}, {0x1F6C,0x1F64}, {0x1F6D,0x1F65}, {0x1F6E,0x1F66}, {0x1F6F,0x1F67},
+	{0x1FB8,0x1FB0}, {0x1FB9,0x1FB1}, {0x1FBA,0x1F70}, {0x1FBB,0x1F71}, {0x1FBE,0x3B9}, {0x1FC8,0x1F72}, {0x1FC9,0x1F73}, {0x1FCA,0x1F74},
+	{0x1FCB,0x1F75}, {0x1FD8,0x1FD0}, {0x1FD9,0x1FD1}, {0x1FDA,0x1F76}, {0x1FDB,0x1F77}, {0x1FE8,0x1FE0}, {0x1FE9,0x1FE1}, {0x1FEA,0x1F7A},
+	{0x1FEB,0x1F7B}, {0x1FEC,0x1FE5}, {0x1FF8,0x1F78}, {0x1FF9,0x1F79}, {0x1FFA,0x1F7C}, {0x1FFB,0x1F7D}, {0x2126,0x3C9}, {0x212A,0x6B},
+	{0x212B,0xE5}, {0x2132,0x214E}, {0x2160,0x2170}, {0x2161,0x2171}, {0x2162,0x2172}, {0x2163,0x2173}, {0x2164,0x2174}, {0x2165,0x2175},
+	{0x2166,0x2176}, {0x2167,0x2177}, {0x2168,0x2178}, {0x2169,0x2179}, {0x216A,0x217A}, {0x216B,0x217B}, {0x216C,0x217C}, {0x216D,0x217D},
+	{0x216E,0x217E}, {0x216F,0x217F}, {0x2183,0x2184}, {0x24B6,0x24D0}, {0x24B7,0x24D1}, {0x24B8,0x24D2}, {0x24B9,0x24D3}, {0x24BA,0x24D4},
+	{0x24BB,0x24D5}, {0x24BC,0x24D6}, {0x24BD,0x24D7}, {0x24BE,0x24D8}, {0x24BF,0x24D9}, {0x24C0,0x24DA}, {0x24C1,0x24DB}, {0x24C2,0x24DC},
+	{0x24C3,0x24DD}, {0x24C4,0x24DE}, {0x24C5,0x24DF}, {0x24C6,0x24E0}, {0x24C7,0x24E1}, {0x24C8,0x24E2}, {0x24C9,0x24E3}, {0x24CA,0x24E4},
+	{0x24CB,0x24E5}, {0x24CC,0x24E6}, {0x24CD,0x24E7}, {0x24CE,0x24E8}, {0x24CF,0x24E9}, {0x2C00,0x2C30}, {0x2C01,0x2C31}, {0x2C02,0x2C32},
+	{0x2C03,0x2C33}, {0x2C04,0x2C34}, {0x2C05,0x2C35}, {0x2C06,0x2C36}, {0x2C07,0x2C37}, {0x2C08,0x2C38}, {0x2C09,0x2C39}, {0x2C0A,0x2C3A},
+	{0x2C0B,0x2C3B}, {0x2C0C,0x2C3C}, {0x2C0D,0x2C3D}, {0x2C0E,0x2C3E}, {0x2C0F,0x2C3F}, {0x2C10,0x2C40}, {0x2C11,0x2C41}, {0x2C12,0x2C42},
+	{0x2C13,0x2C43}, {0x2C14,0x2C44}, {0x2C15,0x2C45}, {0x2C16,0x2C46}, {0x2C17,0x2C47}, {0x2C18,0x2C48}, {0x2C19,0x2C49}, {0x2C1A,0x2C4A},
+	{0x2C1B,0x2C4B}, {0x2C1C,0x2C4C}, {0x2C1D,0x2C4D}, {0x2C1E,0x2C4E}, {0x2C1F,0x2C4F}, {0x2C20,0x2C50}, {0x2C21,0x2C51}, {0x2C22,0x2C52},
+	{0x2C23,0x2C53}, {0x2C24,0x2C54}, {0x2C25,0x2C55}, {0x2C26,0x2C56}, {0x2C27,0x2C57}, {0x2C28,0x2C58}, {0x2C29,0x2C59}, {0x2C2A,0x2C5A},
+	{0x2C2B,0x2C5B}, {0x2C2C,0x2C5C}, {0x2C2D,0x2C5D}, {0x2C2E,0x2C5E}, {0x2C2F,0x2C5F}, {0x2C60,0x2C61}, {0x2C62,0x26B}, {0x2C63,0x1D7D},
+	{0x2C64,0x27D}, {0x2C67,0x2C68}, {0x2C69,0x2C6A}, {0x2C6B,0x2C6C}, {0x2C6D,0x251}, {0x2C6E,0x271}, {0x2C6F,0x250}, {0x2C70,0x252},
+	{0x2C72,0x2C73}, {0x2C75,0x2C76}, {0x2C7E,0x23F}, {0x2C7F,0x240}, {0x2C80,0x2C81}, {0x2C82,0x2C83}, {0x2C84,0x2C85}, {0x2C86,0x2C87},
+	{0x2C88,0x2C89}, {0x2C8A,0x2C8B}, {0x2C8C,0x2C8D}, {0x2C8E,0x2C8F}, {0x2C90,0x2C91}, {0x2C92,0x2C93}, {0x2C94,0x2C95}, {0x2C96,0x2C97},
+	{0x2C98,0x2C99}, {0x2C9A,0x2C9B}, {0x2C9C,0x2C9D}, {0x2C9E,0x2C9F}, {0x2CA0,0x2CA1}, {0x2CA2,0x2CA3}, {0x2CA4,0x2CA5}, {0x2CA6,0x2CA7},
+	{0x2CA8,0x2CA9}, {0x2CAA,0x2CAB}, {0x2CAC,0x2CAD}, {0x2CAE,0x2CAF}, {0x2CB0,0x2CB1}, {0x2CB2,0x2CB3}, {0x2CB4,0x2CB5}, {0x2CB6,0x2CB7},
+	{0x2CB8,0x2CB9}, {0x2CBA,0x2CBB}, {0x2CBC,0x2CBD}, {0x2CBE,0x2CBF}, {0x2CC0,0x2CC1}, {0x2CC2,0x2CC3}, {0x2CC4,0x2CC5}, {0x2CC6,0x2CC7},
+	{0x2CC8,0x2CC9}, {0x2CCA,0x2CCB}, {0x2CCC,0x2CCD}, {0x2CCE,0x2CCF}, {0x2CD0,0x2CD1}, {0x2CD2,0x2CD3}, {0x2CD4,0x2CD5}, {0x2CD6,0x2CD7},
+	{0x2CD8,0x2CD9}, {0x2CDA,0x2CDB}, {0x2CDC,0x2CDD}, {0x2CDE,0x2CDF}, {0x2CE0,0x2CE1}, {0x2CE2,0x2CE3}, {0x2CEB,0x2CEC}, {0x2CED,0x2CEE},
+	{0x2CF2,0x2CF3}, {0xA640,0xA641}, {0xA642,0xA643}, {0xA644,0xA645}, {0xA646,0xA647}, {0xA648,0xA649}, {0xA64A,0xA64B}, {0xA64C,0xA64D},
+	{0xA64E,0xA64F}, {0xA650,0xA651}, {0xA652,0xA653}, {0xA654,0xA655}, {0xA656,0xA657}, {0xA658,0xA659}, {0xA65A,0xA65B}, {0xA65C,0xA65D},
+	{0xA65E,0xA65F}, {0xA660,0xA661}, {0xA662,0xA663}, {0xA664,0xA665}, {0xA666,0xA667}, {0xA668,0xA669}, {0xA66A,0xA66B}, {0xA66C,0xA66D},
+	{0xA680,0xA681}, {0xA682,0xA683}, {0xA684,0xA685}, {0xA686,0xA687}, {0xA688,0xA689}, {0xA68A,0xA68B}, {0xA68C,0xA68D}, {0xA68E,0xA68F},
+	{0xA690,0xA691}, {0xA692,0xA693}, {0xA694,0xA695}, {0xA696,0xA697}, {0xA698,0xA699}, {0xA69A,0xA69B}, {0xA722,0xA723}, {0xA724,0xA725},
+	{0xA726,0xA727}, {0xA728,0xA729}, {0xA72A,0xA72B}, {0xA72C,0xA72D}, {0xA72E,0xA72F}, {0xA732,0xA733}, {0xA734,0xA735}, {0xA736,0xA737},
+	{0xA738,0xA739}, {0xA73A,0xA73B}, {0xA73C,0xA73D}, {0xA73E,0xA73F}, {0xA740,0xA741}, {0xA742,0xA743}, {0xA744,0xA745}, {0xA746,0xA747},
+	{0xA748,0xA749}, {0xA74A,0xA74B}, {0xA74C,0xA74D}, {0xA74E,0xA74F}, {0xA750,0xA751}, {0xA752,0xA753}, {0xA754,0xA755}, {0xA756,0xA757},
+	{0xA758,0xA759}, {0xA75A,0xA75B}, {0xA75C,0xA75D}, {0xA75E,0xA75F}, {0xA760,0xA761}, {0xA762,0xA763}, {0xA764,0xA765}, {0xA766,0xA767},
+	{0xA768,0xA769}, {0xA76A,0xA76B}, {0xA76C,0xA76D}, {0xA76E,0xA76F}, {0xA779,0xA77A}, {0xA77B,0xA77C}, {0xA77D,0x1D79}, {0xA77E,0xA77F},
+	{0xA780,0xA781}, {0xA782,0xA783}, {0xA784,0xA785}, {0xA786,0xA787}, {0xA78B,0xA78C}, {0xA78D,0x265}, {0xA790,0xA791}, {0xA792,0xA793},
+	{0xA796,0xA797}, {0xA798,0xA799}, {0xA79A,0xA79B}, {0xA79C,0xA79D}, {0xA79E,0xA79F}, {0xA7A0,0xA7A1}, {0xA7A2,0xA7A3}, {0xA7A4,0xA7A5},
+	{0xA7A6,0xA7A7}, {0xA7A8,0xA7A9}, {0xA7AA,0x266}, {0xA7AB,0x25C}, {0xA7AC,0x261}, {0xA7AD,0x26C}, {0xA7AE,0x26A}, {0xA7B0,0x29E},
+	{0xA7B1,0x287}, {0xA7B2,0x29D}, {0xA7B3,0xAB53}, {0xA7B4,0xA7B5}, {0xA7B6,0xA7B7}, {0xA7B8,0xA7B9}, {0xA7BA,0xA7BB}, {0xA7BC,0xA7BD},
+	{0xA7BE,0xA7BF}, {0xA7C0,0xA7C1}, {0xA7C2,0xA7C3}, {0xA7C4,0xA794}, {0xA7C5,0x282}, {0xA7C6,0x1D8E}, {0xA7C7,0xA7C8}, {0xA7C9,0xA7CA},
+	{0xA7D0,0xA7D1}, {0xA7D6,0xA7D7}, {0xA7D8,0xA7D9}, {0xA7F5,0xA7F6}, {0xAB70,0x13A0}, {0xAB71,0x13A1}, {0xAB72,0x13A2}, {0xAB73,0x13A3},
+	{0xAB74,0x13A4}, {0xAB75,0x13A5}, {0xAB76,0x13A6}, {0xAB77,0x13A7}, {0xAB78,0x13A8}, {0xAB79,0x13A9}, {0xAB7A,0x13AA}, {0xAB7B,0x13AB},
+	{0xAB7C,0x13AC}, {0xAB7D,0x13AD}, {0xAB7E,0x13AE}, {0xAB7F,0x13AF}, {0xAB80,0x13B0}, {0xAB81,0x13B1}, {0xAB82,0x13B2}, {0xAB83,0x13B3},
+	{0xAB84,0x13B4}, {0xAB85,0x13B5}, {0xAB86,0x13B6}, {0xAB87,0x13B7}, {0xAB88,0x13B8}, {0xAB89,0x13B9}, {0xAB8A,0x13BA}, {0xAB8B,0x13BB},
+	{0xAB8C,0x13BC}, {0xAB8D,0x13BD}, {0xAB8E,0x13BE}, {0xAB8F,0x13BF}, {0xAB90,0x13C0}, {0xAB91,0x13C1}, {0xAB92,0x13C2}, {0xAB93,0x13C3},
+	{0xAB94,0x13C4}, {0xAB95,0x13C5}, {0xAB96,0x13C6}, {0xAB97,0x13C7}, {0xAB98,0x13C8}, {0xAB99,0x13C9}, {0xAB9A,0x13CA}, {0xAB9B,0x13CB},
+	{0xAB9C,0x13CC}, {0xAB9D,0x13CD}, {0xAB9E,0x13CE}, {0xAB9F,0x13CF}, {0xABA0,0x13D0}, {0xABA1,0x13D1}, {0xABA2,0x13D2}, {0xABA3,0x13D3},
+	{0xABA4,0x13D4}, {0xABA5,0x13D5}, {0xABA6,0x13D6}, {0xABA7,0x13D7}, {0xABA8,0x13D8}, {0xABA9,0x13D9}, {0xABAA,0x13DA}, {0xABAB,0x13DB},
+	{0xABAC,0x13DC}, {0xABAD,0x13DD}, {0xABAE,0x13DE}, {0xABAF,0x13DF}, {0xABB0,0x13E0}, {0xABB1,0x13E1}, {0xABB2,0x13E2}, {0xABB3,0x13E3},
+	{0xABB4,0x13E4}, {0xABB5,0x13E5}, {0xABB6,0x13E6}, {0xABB7,0x13E7}, {0xABB8,0x13E8}, {0xABB9,0x13E9}, {0xABBA,0x13EA}, {0xABBB,0x13EB},
+	{0xABBC,0x13EC}, {0xABBD,0x13ED}, {0xABBE,0x13EE}, {0xABBF,0x13EF}, {0xFF21,0xFF41}, {0xFF22,0xFF42}, {0xFF23,0xFF43}, {0xFF24,0xFF44},
+	{0xFF25,0xFF45}, {0xFF26,0xFF46}, {0xFF27,0xFF47}, {0xFF28,0xFF48}, {0xFF29,0xFF49}, {0xFF2A,0xFF4A}, {0xFF2B,0xFF4B}, {0xFF2C,0xFF4C},
+	{0xFF2D,0xFF4D}, {0xFF2E,0xFF4E}, {0xFF2F,0xFF4F}, {0xFF30,0xFF50}, {0xFF31,0xFF51}, {0xFF32,0xFF52}, {0xFF33,0xFF53}, {0xFF34,0xFF54},
+	{0xFF35,0xFF55}, {0xFF36,0xFF56}, {0xFF37,0xFF57}, {0xFF38,0xFF58}, {0xFF39,0xFF59}, {0xFF3A,0xFF5A}, {0x10400,0x10428}, {0x10401,0x10429},
+	{0x10402,0x1042A}, {0x10403,0x1042B}, {0x10404,0x1042C}, {0x10405,0x1042D}, {0x10406,0x1042E}, {0x10407,0x1042F}, {0x10408,0x10430}, {0x10409,0x10431},
+	{0x1040A,0x10432}, {0x1040B,0x10433}, {0x1040C,0x10434}, {0x1040D,0x10435}, {0x1040E,0x10436}, {0x1040F,0x10437}, {0x10410,0x10438}, {0x10411,0x10439},
+	{0x10412,0x1043A}, {0x10413,0x1043B}, {0x10414,0x1043C}, {0x10415,0x1043D}, {0x10416,0x1043E}, {0x10417,0x1043F}, {0x10418,0x10440}, {0x10419,0x10441},
+	{0x1041A,0x10442}, {0x1041B,0x10443}, {0x1041C,0x10444}, {0x1041D,0x10445}, {0x1041E,0x10446}, {0x1041F,0x10447}, {0x10420,0x10448}, {0x10421,0x10449},
+	{0x10422,0x1044A}, {0x10423,0x1044B}, {0x10424,0x1044C}, {0x10425,0x1044D}, {0x10426,0x1044E}, {0x10427,0x1044F}, {0x104B0,0x104D8}, {0x104B1,0x104D9},
+	{0x104B2,0x104DA}, {0x104B3,0x104DB}, {0x104B4,0x104DC}, {0x104B5,0x104DD}, {0x104B6,0x104DE}, {0x104B7,0x104DF}, {0x104B8,0x104E0}, {0x104B9,0x104E1},
+	{0x104BA,0x104E2}, {0x104BB,0x104E3}, {0x104BC,0x104E4}, {0x104BD,0x104E5}, {0x104BE,0x104E6}, {0x104BF,0x104E7}, {0x104C0,0x104E8}, {0x104C1,0x104E9},
+	{0x104C2,0x104EA}, {0x104C3,0x104EB}, {0x104C4,0x104EC}, {0x104C5,0x104ED}, {0x104C6,0x104EE}, {0x104C7,0x104EF}, {0x104C8,0x104F0}, {0x104C9,0x104F1},
+	{0x104CA,0x104F2}, {0x104CB,0x104F3}, {0x104CC,0x104F4}, {0x104CD,0x104F5}, {0x104CE,0x104F6}, {0x104CF,0x104F7}, {0x104D0,0x104F8}, {0x104D1,0x104F9},
+	{0x104D2,0x104FA}, {0x104D3,0x104FB}, {0x10570,0x10597}, {0x10571,0x10598}, {0x10572,0x10599}, {0x10573,0x1059A}, {0x10574,0x1059B}, {0x10575,0x1059C},
+	{0x10576,0x1059D}, {0x10577,0x1059E}, {0x10578,0x1059F}, {0x10579,0x105A0}, {0x1057A,0x105A1}, {0x1057C,0x105A3}, {0x1057D,0x105A4}, {0x1057E,0x105A5},
+	{0x1057F,0x105A6}, {0x10580,0x105A7}, {0x10581,0x105A8}, {0x10582,0x105A9}, {0x10583,0x105AA}, {0x10584,0x105AB}, {0x10585,0x105AC}, {0x10586,0x105AD},
+	{0x10587,0x105AE}, {0x10588,0x105AF}, {0x10589,0x105B0}, {0x1058A,0x105B1}, {0x1058C,0x105B3}, {0x1058D,0x105B4}, {0x1058E,0x105B5}, {0x1058F,0x105B6},
+	{0x10590,0x105B7}, {0x10591,0x105B8}, {0x10592,0x105B9}, {0x10594,0x105BB}, {0x10595,0x105BC}, {0x10C80,0x10CC0}, {0x10C81,0x10CC1}, {0x10C82,0x10CC2},
+	{0x10C83,0x10CC3}, {0x10C84,0x10CC4}, {0x10C85,0x10CC5}, {0x10C86,0x10CC6}, {0x10C87,0x10CC7}, {0x10C88,0x10CC8}, {0x10C89,0x10CC9}, {0x10C8A,0x10CCA},
+	{0x10C8B,0x10CCB}, {0x10C8C,0x10CCC}, {0x10C8D,0x10CCD}, {0x10C8E,0x10CCE}, {0x10C8F,0x10CCF}, {0x10C90,0x10CD0}, {0x10C91,0x10CD1}, {0x10C92,0x10CD2},
+	{0x10C93,0x10CD3}, {0x10C94,0x10CD4}, {0x10C95,0x10CD5}, {0x10C96,0x10CD6}, {0x10C97,0x10CD7}, {0x10C98,0x10CD8}, {0x10C99,0x10CD9}, {0x10C9A,0x10CDA},
+	{0x10C9B,0x10CDB}, {0x10C9C,0x10CDC}, {0x10C9D,0x10CDD}, {0x10C9E,0x10CDE}, {0x10C9F,0x10CDF}, {0x10CA0,0x10CE0}, {0x10CA1,0x10CE1}, {0x10CA2,0x10CE2},
+	{0x10CA3,0x10CE3}, {0x10CA4,0x10CE4}, {0x10CA5,0x10CE5}, {0x10CA6,0x10CE6}, {0x10CA7,0x10CE7}, {0x10CA8,0x10CE8}, {0x10CA9,0x10CE9}, {0x10CAA,0x10CEA},
+	{0x10CAB,0x10CEB}, {0x10CAC,0x10CEC}, {0x10CAD,0x10CED}, {0x10CAE,0x10CEE}, {0x10CAF,0x10CEF}, {0x10CB0,0x10CF0}, {0x10CB1,0x10CF1}, {0x10CB2,0x10CF2},
+	{0x118A0,0x118C0}, {0x118A1,0x118C1}, {0x118A2,0x118C2}, {0x118A3,0x118C3}, {0x118A4,0x118C4}, {0x118A5,0x118C5}, {0x118A6,0x118C6}, {0x118A7,0x118C7},
+	{0x118A8,0x118C8}, {0x118A9,0x118C9}, {0x118AA,0x118CA}, {0x118AB,0x118CB}, {0x118AC,0x118CC}, {0x118AD,0x118CD}, {0x118AE,0x118CE}, {0x118AF,0x118CF},
+	{0x118B0,0x118D0}, {0x118B1,0x118D1}, {0x118B2,0x118D2}, {0x118B3,0x118D3}, {0x118B4,0x118D4}, {0x118B5,0x118D5}, {0x118B6,0x118D6}, {0x118B7,0x118D7},
+	{0x118B8,0x118D8}, {0x118B9,0x118D9}, {0x118BA,0x118DA}, {0x118BB,0x118DB}, {0x118BC,0x118DC}, {0x118BD,0x118DD}, {0x118BE,0x118DE}, {0x118BF,0x118DF},
+	{0x16E40,0x16E60}, {0x16E41,0x16E61}, {0x16E42,0x16E62}, {0x16E43,0x16E63}, {0x16E44,0x16E64}, {0x16E45,0x16E65}, {0x16E46,0x16E66}, {0x16E47,0x16E67},
+	{0x16E48,0x16E68}, {0x16E49,0x16E69}, {0x16E4A,0x16E6A}, {0x16E4B,0x16E6B}, {0x16E4C,0x16E6C}, {0x16E4D,0x16E6D}, {0x16E4E,0x16E6E}, {0x16E4F,0x16E6F},
+	{0x16E50,0x16E70}, {0x16E51,0x16E71}, {0x16E52,0x16E72}, {0x16E53,0x16E73}, {0x16E54,0x16E74}, {0x16E55,0x16E75}, {0x16E56,0x16E76}, {0x16E57,0x16E77},
+	{0x16E58,0x16E78}, {0x16E59,0x16E79}, {0x16E5A,0x16E7A}, {0x16E5B,0x16E7B}, {0x16E5C,0x16E7C}, {0x16E5D,0x16E7D}, {0x16E5E,0x16E7E}, {0x16E5F,0x16E7F},
+	{0x1E900,0x1E922}, {0x1E901,0x1E923}, {0x1E902,0x1E924}, {0x1E903,0x1E925}, {0x1E904,0x1E926}, {0x1E905,0x1E927}, {0x1E906,0x1E928}, {0x1E907,0x1E929},
+	{0x1E908,0x1E92A}, {0x1E909,0x1E92B}, {0x1E90A,0x1E92C}, {0x1E90B,0x1E92D}, {0x1E90C,0x1E92E}, {0x1E90D,0x1E92F}, {0x1E90E,0x1E930}, {0x1E90F,0x1E931},
+	{0x1E910,0x1E932}, {0x1E911,0x1E933}, {0x1E912,0x1E934}, {0x1E913,0x1E935}, {0x1E914,0x1E936}, {0x1E915,0x1E937}, {0x1E916,0x1E938}, {0x1E917,0x1E939},
+	{0x1E918,0x1E93A}, {0x1E919,0x1E93B}, {0x1E91A,0x1E93C}, {0x1E91B,0x1E93D}, {0x1E91C,0x1E93E}, {0x1E91D,0x1E93F}, {0x1E91E,0x1E940}, {0x1E91F,0x1E941},
+	{0x1E920,0x1E942}, {0x1E921,0x1E943},
+};
+
+// code point, the two or three code points it folds to (0 pads)
+static const unsigned int FOLD_MULTI[][4] = {
+	{0xDF,0x73,0x73,0x0}, {0x130,0x69,0x307,0x0}, {0x149,0x2BC,0x6E,0x0}, {0x1F0,0x6A,0x30C,0x0}, {0x390,0x3B9,0x308,0x301},
+	{0x3B0,0x3C5,0x308,0x301}, {0x587,0x565,0x582,0x0}, {0x1E96,0x68,0x331,0x0}, {0x1E97,0x74,0x308,0x0}, {0x1E98,0x77,0x30A,0x0},
+	{0x1E99,0x79,0x30A,0x0}, {0x1E9A,0x61,0x2BE,0x0}, {0x1E9E,0x73,0x73,0x0}, {0x1F50,0x3C5,0x313,0x0}, {0x1F52,0x3C5,0x313,0x300},
+	{0x1F54,0x3C5,0x313,0x301}, {0x1F56,0x3C5,0x313,0x342}, {0x1F80,0x1F00,0x3B9,0x0}, {0x1F81,0x1F01,0x3B9,0x0}, {0x1F82,0x1F02,0x3B9,0x0},
+	{0x1F83,0x1F03,0x3B9,0x0}, {0x1F84,0x1F04,0x3B9,0x0}, {0x1F85,0x1F05,0x3B9,0x0}, {0x1F86,0x1F06,0x3B9,0x0}, {0x1F87,0x1F07,0x3B9,0x0},
+	{0x1F88,0x1F00,0x3B9,0x0}, {0x1F89,0x1F01,0x3B9,0x0}, {0x1F8A,0x1F02,0x3B9,0x0}, {0x1F8B,0x1F03,0x3B9,0x0}, {0x1F8C,0x1F04,0x3B9,0x0},
+	{0x1F8D,0x1F05,0x3B9,0x0}, {0x1F8E,0x1F06,0x3B9,0x0}, {0x1F8F,0x1F07,0x3B9,0x0}, {0x1F90,0x1F20,0x3B9,0x0}, {0x1F91,0x1F21,0x3B9,0x0},
+	{0x1F92,0x1F22,0x3B9,0x0}, {0x1F93,0x1F23,0x3B9,0x0}, {0x1F94,0x1F24,0x3B9,0x0}, {0x1F95,0x1F25,0x3B9,0x0}, {0x1F96,0x1F26,0x3B9,0x0},
+	{0x1F97,0x1F27,0x3B9,0x0}, {0x1F98,0x1F20,0x3B9,0x0}, {0x1F99,0x1F21,0x3B9,0x0}, {0x1F9A,0x1F22,0x3B9,0x0}, {0x1F9B,0x1F23,0x3B9,0x0},
+	{0x1F9C,0x1F24,0x3B9,0x0}, {0x1F9D,0x1F25,0x3B9,0x0}, {0x1F9E,0x1F26,0x3B9,0x0}, {0x1F9F,0x1F27,0x3B9,0x0}, {0x1FA0,0x1F60,0x3B9,0x0},
+	{0x1FA1,0x1F61,0x3B9,0x0}, {0x1FA2,0x1F62,0x3B9,0x0}, {0x1FA3,0x1F63,0x3B9,0x0}, {0x1FA4,0x1F64,0x3B9,0x0}, {0x1FA5,0x1F65,0x3B9,0x0},
+	{0x1FA6,0x1F66,0x3B9,0x0}, {0x1FA7,0x1F67,0x3B9,0x0}, {0x1FA8,0x1F60,0x3B9,0x0}, {0x1FA9,0x1F61,0x3B9,0x0}, {0x1FAA,0x1F62,0x3B9,0x0},
+	{0x1FAB,0x1F63,0x3B9,0x0}, {0x1FAC,0x1F64,0x3B9,0x0}, {0x1FAD,0x1F65,0x3B9,0x0}, {0x1FAE,0x1F66,0x3B9,0x0}, {0x1FAF,0x1F67,0x3B9,0x0},
+	{0x1FB2,0x1F70,0x3B9,0x0}, {0x1FB3,0x3B1,0x3B9,0x0}, {0x1FB4,0x3AC,0x3B9,0x0}, {0x1FB6,0x3B1,0x342,0x0}, {0x1FB7,0x3B1,0x342,0x3B9},
+	{0x1FBC,0x3B1,0x3B9,0x0}, {0x1FC2,0x1F74,0x3B9,0x0}, {0x1FC3,0x3B7,0x3B9,0x0}, {0x1FC4,0x3AE,0x3B9,0x0}, {0x1FC6,0x3B7,0x342,0x0},
+	{0x1FC7,0x3B7,0x342,0x3B9}, {0x1FCC,0x3B7,0x3B9,0x0}, {0x1FD2,0x3B9,0x308,0x300}, {0x1FD3,0x3B9,0x308,0x301}, {0x1FD6,0x3B9,0x342,0x0},
+	{0x1FD7,0x3B9,0x308,0x342}, {0x1FE2,0x3C5,0x308,0x300}, {0x1FE3,0x3C5,0x308,0x301}, {0x1FE4,0x3C1,0x313,0x0}, {0x1FE6,0x3C5,0x342,0x0},
+	{0x1FE7,0x3C5,0x308,0x342}, {0x1FF2,0x1F7C,0x3B9,0x0}, {0x1FF3,0x3C9,0x3B9,0x0}, {0x1FF4,0x3CE,0x3B9,0x0}, {0x1FF6,0x3C9,0x342,0x0},
+	{0x1FF7,0x3C9,0x342,0x3B9}, {0x1FFC,0x3C9,0x3B9,0x0}, {0xFB00,0x66,0x66,0x0}, {0xFB01,0x66,0x69,0x0}, {0xFB02,0x66,0x6C,0x0},
+	{0xFB03,0x66,0x66,0x69}, {0xFB04,0x66,0x66,0x6C}, {0xFB05,0x73,0x74,0x0}, {0xFB06,0x73,0x74,0x0}, {0xFB13,0x574,0x576,0x0},
+	{0xFB14,0x574,0x565,0x0}, {0xFB15,0x574,0x56B,0x0}, {0xFB16,0x57E,0x576,0x0}, {0xFB17,0x574,0x56D,0x0},
+};
+
+#endif
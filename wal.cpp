@@ -0,0 +1,407 @@
+#include "wal.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <cerrno>
+#include <cstring>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+using namespace std;
+
+//first bytes of a log file: the magic and the id of the snapshot its changes apply to
+struct LogHeader
+{
+	char magic[8];
+	unsigned long snapshot;
+};
+
+const char LOG_MAGIC[8] = "MLDWAL1";
+
+//records longer than this are taken for damage
+const unsigned int LOG_MAX_RECORD = 1 << 30;
+
+//32-bit FNV-1a over a record's payload
+static unsigned int recordChecksum(const char *data, size_t length) {
+	unsigned int sum = 2166136261u;
+	for (size_t i = 0; i < length; i++) {
+		sum = (sum ^ (unsigned char)data[i]) * 16777619u;
+	}
+	return sum;
+}
+
+//writes all of data to a file descriptor; false on an error
+static bool writeAll(int fd, const char *data, size_t length) {
+	while (length > 0) {
+		ssize_t written = write(fd, data, length);
+		if (written < 0 && errno == EINTR) {
+			continue;
+		}
+		if (written < 0) {
+			return false;
+		}
+		data += written;
+		length -= written;
+	}
+	return true;
+}
+
+//makes the directory entries of a path's directory (renames, new files) durable
+static void syncDirectory(const string& path) {
+	size_t slash = path.rfind('/');
+	string directory = slash == string::npos ? "." : slash == 0 ? "/" : path.substr(0, slash);
+	int fd = open(directory.c_str(), O_RDONLY);
+	if (fd >= 0) {
+		fsync(fd);
+		close(fd);
+	}
+}
+
+//reads a whole file into data; false if it cannot be opened
+static bool readFile(const string& path, string& data) {
+	ifstream in(path, ios::binary);
+	if (!in.is_open()) {
+		return false;
+	}
+	stringstream text;
+	text << in.rdbuf();
+	data = text.str();
+	return true;
+}
+
+//reads the snapshot id a log file starts with; false if it has no valid header
+static bool readHeader(const string& data, unsigned long& snapshot) {
+	LogHeader header;
+	if (data.size() < sizeof(header)) {
+		return false;
+	}
+	memcpy(&header, data.data(), sizeof(header));
+	snapshot = header.snapshot;
+	return memcmp(header.magic, LOG_MAGIC, sizeof(header.magic)) == 0;
+}
+
+//appends a length-prefixed field to a record
+static void putField(string& record, const string& field) {
+	unsigned int length = field.size();
+	record.append((const char*)&length, sizeof(length));
+	record += field;
+}
+
+//reads a length-prefixed field of a payload at pos; false if it runs past the end
+static bool getField(const string& payload, size_t& pos, string& field) {
+	unsigned int length;
+	if (payload.size() - pos < sizeof(length)) {
+		return false;
+	}
+	memcpy(&length, payload.data() + pos, sizeof(length));
+	pos += sizeof(length);
+	if (payload.size() - pos < length) {
+		return false;
+	}
+	field.assign(payload, pos, length);
+	pos += length;
+	return true;
+}
+
+//constructor, nothing is opened until recover()
+MutationLog::MutationLog(const string& path, const string& snapshotPath, const LogOptions& options) : logBytes(0) {
+	this->path = path;
+	this->oldPath = path + ".old";
+	this->snapshotPath = snapshotPath;
+	this->options = options;
+	this->fd = -1;
+	this->pendingRecords = 0;
+	this->oldBytes = 0;
+	this->checkpointPid = 0;
+	this->failed = false;
+	this->stopping = false;
+}
+
+//applies the records of a log file to the table and returns how many there were. A torn or
+//damaged record ends the replay, and the file is cut back to the last whole record.
+unsigned long MutationLog::replay(HashTable& table, const string& file) {
+	string data;
+	unsigned long snapshot;
+	if (!readFile(file, data) || !readHeader(data, snapshot)) {
+		return 0;
+	}
+	size_t pos = sizeof(LogHeader);
+	unsigned long records = 0;
+	string payload, a, b, c;
+	while (data.size() - pos >= 2 * sizeof(unsigned int)) {
+		unsigned int length, sum;
+		memcpy(&length, data.data() + pos, sizeof(length));
+		memcpy(&sum, data.data() + pos + sizeof(length), sizeof(sum));
+		size_t start = pos + 2 * sizeof(unsigned int);
+		if (length == 0 || length > LOG_MAX_RECORD || data.size() - start < length || recordChecksum(data.data() + start, length) != sum) {
+			break;
+		}
+		payload.assign(data, start, length);
+		size_t field = 1;
+		LogOp op = (LogOp)payload[0];
+		if (!getField(payload, field, a) || !getField(payload, field, b) || !getField(payload, field, c) || field != payload.size()) {
+			break;
+		}
+		if (op == LOG_ADD) table.insert(a, b, c);
+		else if (op == LOG_DEL_WORD) table.delWord(a);
+		else if (op == LOG_DEL_TRANSLATION) table.delTranslation(a, b);
+		else if (op == LOG_DEL_MEANING) table.delMeaning(a, b, c);
+		else break;
+		records++;
+		pos = start + length;
+	}
+	if (pos < data.size()) {
+		cout << "Dropped " << data.size() - pos << " damaged bytes at the end of " << file << "." << '\n';
+		if (truncate(file.c_str(), pos) != 0) {
+			cout << "Could not repair " << file << "." << '\n';
+		}
+	}
+	return records;
+}
+
+//opens the live log for appending, creating it with a header if it is missing or has none
+bool MutationLog::openLive() {
+	fd = open(path.c_str(), O_WRONLY | O_APPEND | O_CREAT, 0644);
+	if (fd < 0) {
+		return false;
+	}
+	struct stat info;
+	unsigned long size = fstat(fd, &info) == 0 ? info.st_size : 0;
+	if (size < sizeof(LogHeader)) {
+		LogHeader header;
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, LOG_MAGIC, sizeof(header.magic));
+		header.snapshot = HashTable::snapshotId(snapshotPath);
+		if (ftruncate(fd, 0) != 0 || !writeAll(fd, (const char*)&header, sizeof(header)) || fdatasync(fd) != 0) {
+			close(fd);
+			fd = -1;
+			return false;
+		}
+		size = sizeof(header);
+	}
+	logBytes = size;
+	return true;
+}
+
+//replays what the logs hold on top of a table just loaded from the snapshot with the given id
+//(0 = none), opens the live log and returns the number of changes replayed. An old log left
+//by an interrupted checkpoint is replayed first, unless the snapshot already holds it.
+unsigned long MutationLog::recover(HashTable& table, unsigned long snapshotId) {
+	unsigned long records = 0;
+	string data;
+	unsigned long snapshot;
+	if (readFile(oldPath, data)) {
+		if (readHeader(data, snapshot) && snapshot == snapshotId) {
+			records += replay(table, oldPath);
+			struct stat info;
+			oldBytes = stat(oldPath.c_str(), &info) == 0 ? info.st_size : 0;
+		}
+		else {
+			//the checkpoint finished before the old log could be deleted
+			::remove(oldPath.c_str());
+		}
+	}
+	records += replay(table, path);
+	if (!openLive()) {
+		cout << "Could not open " << path << "; changes will not be logged." << '\n';
+		failed = true;
+	}
+	if (options.sync != SYNC_ALWAYS) {
+		flusher = thread(&MutationLog::flushLoop, this);
+	}
+	return records;
+}
+
+//writes the records waiting so far in one write and, if sync is set and the mode allows it,
+//forces them to disk. Appends may go on while this runs; they join the next group.
+void MutationLog::flush(bool sync) {
+	lock_guard<mutex> writing(writeLock);
+	string batch;
+	{
+		lock_guard<mutex> guard(lock);
+		batch.swap(pending);
+		pendingRecords = 0;
+	}
+	if (batch.empty()) {
+		return;
+	}
+	bool written = fd >= 0 && writeAll(fd, batch.data(), batch.size());
+	if (written) {
+		logBytes += batch.size();
+	}
+	if (written && sync && options.sync != SYNC_OFF) {
+		written = fdatasync(fd) == 0;
+	}
+	if (!written && !failed) {
+		cout << "Could not write to " << path << "; changes may be lost." << '\n';
+		failed = true;
+	}
+}
+
+//commits every group at most groupMillis after its first change
+void MutationLog::flushLoop() {
+	unique_lock<mutex> guard(lock);
+	while (!stopping) {
+		wake.wait(guard, [this]() { return stopping || pendingRecords > 0; });
+		//the first change of a group waits a while for others to share the sync
+		wake.wait_for(guard, chrono::milliseconds(options.groupMillis), [this]() { return stopping; });
+		guard.unlock();
+		flush(true);
+		guard.lock();
+	}
+}
+
+//appends one change; with SYNC_ALWAYS, or when the group is full, it is committed before returning
+void MutationLog::append(LogOp op, const string& a, const string& b, const string& c) {
+	string payload(1, (char)op);
+	putField(payload, a);
+	putField(payload, b);
+	putField(payload, c);
+	unsigned int length = payload.size();
+	unsigned int sum = recordChecksum(payload.data(), payload.size());
+	bool first, full;
+	{
+		lock_guard<mutex> guard(lock);
+		pending.append((const char*)&length, sizeof(length));
+		pending.append((const char*)&sum, sizeof(sum));
+		pending += payload;
+		first = pendingRecords++ == 0;
+		full = pendingRecords >= options.groupRecords;
+	}
+	if (options.sync == SYNC_ALWAYS || full) {
+		flush(true);
+	}
+	else if (first) {
+		wake.notify_one();
+	}
+}
+
+//to be called after each logged change: collects a finished checkpoint and starts one when
+//the live log has outgrown LogOptions::checkpointBytes
+void MutationLog::afterChange(HashTable& table) {
+	reap(false);
+	if (options.checkpointBytes > 0 && checkpointPid == 0 && logBytes >= options.checkpointBytes) {
+		checkpoint(table);
+	}
+}
+
+//moves the live log's changes to the old log and starts an empty live log. The old log is
+//stamped with the snapshot on disk, the one its changes apply to; if an earlier checkpoint
+//failed, the old log is still there and the live changes are appended to it instead.
+bool MutationLog::rotate() {
+	lock_guard<mutex> writing(writeLock);
+	string data;
+	if (!readFile(path, data) || data.size() < sizeof(LogHeader)) {
+		data.assign(sizeof(LogHeader), '\0');
+	}
+	int old = open(oldPath.c_str(), O_WRONLY | O_APPEND);
+	if (old < 0) {
+		//no old log: this one takes its place, under a fresh header
+		old = open(oldPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		LogHeader header;
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, LOG_MAGIC, sizeof(header.magic));
+		header.snapshot = HashTable::snapshotId(snapshotPath);
+		memcpy(&data[0], &header, sizeof(header));
+	}
+	else {
+		data.erase(0, sizeof(LogHeader));
+	}
+	bool moved = old >= 0 && writeAll(old, data.data(), data.size()) && fdatasync(old) == 0;
+	if (old >= 0) {
+		close(old);
+	}
+	if (!moved) {
+		return false;
+	}
+	oldBytes += data.size();
+	close(fd);
+	fd = -1;
+	::remove(path.c_str());
+	bool opened = openLive();
+	//the new files must survive a crash before the snapshot they lead up to replaces the old one
+	syncDirectory(path);
+	return opened;
+}
+
+//commits what is pending, moves the log aside and forks a child that writes the table to the
+//snapshot while this process goes on. Returns false if one is already running or it could not start.
+bool MutationLog::checkpoint(HashTable& table) {
+	reap(false);
+	if (checkpointPid != 0) {
+		return false;
+	}
+	flush(true);
+	if (!rotate()) {
+		cout << "Could not move " << path << " aside for a checkpoint." << '\n';
+		return false;
+	}
+	cout.flush();
+	pid_t pid;
+	{
+		//the child has only this thread, and it allocates: the flusher is parked outside any
+		//write, and so outside the heap, by holding both locks in flush's order over the fork
+		lock_guard<mutex> writing(writeLock);
+		lock_guard<mutex> guard(lock);
+		pid = fork();
+		if (pid == 0) {
+			//the child must neither print nor flush what the parent had buffered
+			cout.rdbuf(nullptr);
+			_exit(table.exportSnapshot(snapshotPath) ? 0 : 1);
+		}
+	}
+	if (pid < 0) {
+		cout << "Could not start a checkpoint; its changes stay in " << oldPath << "." << '\n';
+		return false;
+	}
+	checkpointPid = pid;
+	return true;
+}
+
+//collects the checkpoint child if it has finished (or waits for it) and deletes the old log
+//once its changes are in the snapshot. Returns true if a checkpoint succeeded.
+bool MutationLog::reap(bool wait) {
+	if (checkpointPid == 0) {
+		return false;
+	}
+	int status;
+	pid_t done = waitpid(checkpointPid, &status, wait ? 0 : WNOHANG);
+	if (done == 0) {
+		return false;
+	}
+	checkpointPid = 0;
+	if (done < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+		cout << "The checkpoint could not be written; its changes stay in " << oldPath << "." << '\n';
+		return false;
+	}
+	//the rename that made the snapshot must be durable before its changes leave the log
+	syncDirectory(snapshotPath);
+	::remove(oldPath.c_str());
+	oldBytes = 0;
+	return true;
+}
+
+//returns the snapshot checkpoints write
+const string& MutationLog::getSnapshotPath() {
+	return snapshotPath;
+}
+
+//destructor, commits what is pending and waits for a running checkpoint
+MutationLog::~MutationLog() {
+	{
+		lock_guard<mutex> guard(lock);
+		stopping = true;
+	}
+	wake.notify_one();
+	if (flusher.joinable()) {
+		flusher.join();
+	}
+	flush(true);
+	reap(true);
+	if (fd >= 0) {
+		close(fd);
+	}
+}
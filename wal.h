@@ -0,0 +1,74 @@
+#ifndef _WAL
+#define _WAL
+#include <string>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
+#include <sys/types.h>
+#include "hashtable.h"
+using namespace std;
+
+//when appended changes are forced to disk
+enum SyncMode {
+	SYNC_ALWAYS,	// every change is written and synced before append returns
+	SYNC_BATCH,		// changes are written and synced in groups (group commit)
+	SYNC_OFF		// changes are written in groups and never synced; the OS writes them back
+};
+
+//how a mutation log commits and when it checkpoints
+struct LogOptions
+{
+	SyncMode sync;
+	unsigned int groupRecords;		// changes committed together at most
+	unsigned int groupMillis;		// longest a change waits for the rest of its group
+	unsigned long checkpointBytes;	// log size that starts a background checkpoint (0 = never)
+	LogOptions() : sync(SYNC_BATCH), groupRecords(64), groupMillis(100), checkpointBytes(64UL << 20) {}
+};
+
+//kinds of change a log record holds; bulk loads are not logged but followed by a checkpoint
+enum LogOp { LOG_ADD = 1, LOG_DEL_WORD, LOG_DEL_TRANSLATION, LOG_DEL_MEANING };
+
+//append-only log of the changes made to a table since its base snapshot, replayed on startup.
+//Each record carries its length and a checksum, so a record torn by a crash ends the replay
+//and is cut off. A checkpoint moves the log aside to path + ".old", starts a new one, and
+//forks a child that writes the table to the snapshot; once the child succeeds the old log is
+//deleted. The old log starts with the id of the snapshot its changes apply to, which tells
+//recovery whether an old log left by an interrupted checkpoint is already part of the snapshot.
+class MutationLog
+{
+	private:
+		string path;						// the live log
+		string oldPath;						// changes a running or failed checkpoint covers
+		string snapshotPath;				// snapshot checkpoints write
+		LogOptions options;
+		int fd;								// live log, opened for appending (-1 if it could not be)
+		string pending;						// encoded records not written yet
+		unsigned int pendingRecords;
+		atomic<unsigned long> logBytes;		// size of the live log
+		unsigned long oldBytes;				// size of the old log (0 if there is none)
+		pid_t checkpointPid;				// child writing a checkpoint (0 if none)
+		bool failed;						// a write to the log failed and was reported
+		mutex lock;							// guards pending and pendingRecords
+		mutex writeLock;					// serializes writes to the files
+		condition_variable wake;
+		thread flusher;						// commits groups that did not fill up in time
+		bool stopping;
+		void flush(bool sync);
+		void flushLoop();
+		bool openLive();
+		bool rotate();
+		unsigned long replay(HashTable& table, const string& file);
+		MutationLog(const MutationLog&);
+		MutationLog& operator=(const MutationLog&);
+	public:
+		MutationLog(const string& path, const string& snapshotPath, const LogOptions& options);
+		unsigned long recover(HashTable& table, unsigned long snapshotId);
+		void append(LogOp op, const string& a, const string& b = "", const string& c = "");
+		void afterChange(HashTable& table);
+		bool checkpoint(HashTable& table);
+		bool reap(bool wait);
+		const string& getSnapshotPath();
+		~MutationLog();
+};
+#endif